@@ -37,7 +37,7 @@ class BallOverlay : public ReplaceableScreen
 {
 public:
     BallOverlay(ReplaceableScreen& screen, std::shared_ptr<PKX> pkm)
-        : ReplaceableScreen(&screen, i18n::localize("A_SELECT") + '\n' + i18n::localize("B_BACK")), pkm(pkm), hid(30, 6)
+        : ReplaceableScreen(&screen, i18n::localize(StringId::A_SELECT) + '\n' + i18n::localize(StringId::B_BACK)), pkm(pkm), hid(30, 6)
     {
         hid.update(24);
         hid.select(pkm->ball() - 1);
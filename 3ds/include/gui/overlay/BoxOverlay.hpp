@@ -37,7 +37,10 @@ class BoxOverlay : public ReplaceableScreen
 {
 public:
     BoxOverlay(ReplaceableScreen& screen, std::vector<std::string>& boxes, int& current)
-        : ReplaceableScreen(&screen, i18n::localize("A_SELECT") + '\n' + i18n::localize("B_BACK")), hid(40, 2), strings(boxes), out(current)
+        : ReplaceableScreen(&screen, i18n::localize(StringId::A_SELECT) + '\n' + i18n::localize(StringId::B_BACK)),
+          hid(40, 2),
+          strings(boxes),
+          out(current)
     {
         hid.update(strings.size());
         hid.select(current);
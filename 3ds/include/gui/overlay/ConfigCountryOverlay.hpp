@@ -29,9 +29,10 @@
 
 #include "Button.hpp"
 #include "HidVertical.hpp"
+#include "IdTable.hpp"
 #include "ReplaceableScreen.hpp"
-#include <map>
 #include <memory>
+#include <vector>
 
 class ConfigCountryOverlay : public ReplaceableScreen
 {
@@ -45,8 +46,9 @@ public:
 private:
     void searchBar();
     HidVertical hid;
-    const std::map<u8, std::string>& validCountries;
-    std::map<u8, std::string> countries;
+    const IdTable<u8>& validCountries;
+    // Indices into validCountries of the entries shown
+    std::vector<size_t> countries;
     std::string searchString    = "";
     std::string oldSearchString = "";
     std::unique_ptr<Button> searchButton;
@@ -38,7 +38,10 @@ class FormOverlay : public ReplaceableScreen
 {
 public:
     FormOverlay(ReplaceableScreen& screen, const std::variant<std::shared_ptr<PKX>, std::shared_ptr<PKFilter>>& object, u8 formCount)
-        : ReplaceableScreen(&screen, i18n::localize("A_SELECT") + '\n' + i18n::localize("B_BACK")), object(object), hid(40, 6), formCount(formCount)
+        : ReplaceableScreen(&screen, i18n::localize(StringId::A_SELECT) + '\n' + i18n::localize(StringId::B_BACK)),
+          object(object),
+          hid(40, 6),
+          formCount(formCount)
     {
         hid.update(40);
         if (object.index() == 0)
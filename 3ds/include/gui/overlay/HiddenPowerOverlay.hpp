@@ -36,7 +36,7 @@ class HiddenPowerOverlay : public ReplaceableScreen
 {
 public:
     HiddenPowerOverlay(ReplaceableScreen& screen, std::shared_ptr<PKX> pkm)
-        : ReplaceableScreen(&screen, i18n::localize("A_SELECT") + '\n' + i18n::localize("B_BACK")), pkm(pkm), hid(16, 4)
+        : ReplaceableScreen(&screen, i18n::localize(StringId::A_SELECT) + '\n' + i18n::localize(StringId::B_BACK)), pkm(pkm), hid(16, 4)
     {
         hid.update(16);
         hid.select(pkm->hpType());
@@ -29,10 +29,11 @@
 
 #include "Button.hpp"
 #include "HidVertical.hpp"
+#include "IdTable.hpp"
 #include "PKX.hpp"
 #include "ReplaceableScreen.hpp"
-#include <map>
 #include <memory>
+#include <vector>
 
 class LocationOverlay : public ReplaceableScreen
 {
@@ -47,8 +48,9 @@ private:
     std::shared_ptr<PKX> pkm;
     void searchBar();
     HidVertical hid;
-    const std::map<u16, std::string>& validLocations;
-    std::map<u16, std::string> locations;
+    const IdTable<u16>& validLocations;
+    // Indices into validLocations of the entries shown
+    std::vector<size_t> locations;
     std::string searchString    = "";
     std::string oldSearchString = "";
     std::unique_ptr<Button> searchButton;
@@ -36,7 +36,7 @@ class NatureOverlay : public ReplaceableScreen
 {
 public:
     NatureOverlay(ReplaceableScreen& screen, std::shared_ptr<PKX> pkm)
-        : ReplaceableScreen(&screen, i18n::localize("A_SELECT") + '\n' + i18n::localize("B_BACK")), pkm(pkm), hid(25, 5)
+        : ReplaceableScreen(&screen, i18n::localize(StringId::A_SELECT) + '\n' + i18n::localize(StringId::B_BACK)), pkm(pkm), hid(25, 5)
     {
         hid.update(25);
         hid.select(pkm->nature());
@@ -127,7 +127,7 @@ class SortOverlay : public ReplaceableScreen
 {
 public:
     SortOverlay(ReplaceableScreen& screen, SortType& type)
-        : ReplaceableScreen(&screen, i18n::localize("A_SELECT") + '\n' + i18n::localize("B_BACK")), hid(40, 2), out(type)
+        : ReplaceableScreen(&screen, i18n::localize(StringId::A_SELECT) + '\n' + i18n::localize(StringId::B_BACK)), hid(40, 2), out(type)
     {
         hid.update(vals.size());
         hid.select(int(type));
@@ -40,12 +40,12 @@ public:
     {
         int newBankNum = 0;
         while (std::find_if(strings.begin(), strings.end(), [&newBankNum](const std::pair<std::string, int>& v) {
-            return v.first == i18n::localize("NEW_BANK") + " " + std::to_string(newBankNum);
+            return v.first == i18n::localize(StringId::NEW_BANK) + " " + std::to_string(newBankNum);
         }) != strings.end())
         {
             newBankNum++;
         }
-        strings.emplace_back((i18n::localize("NEW_BANK") + " " + std::to_string(newBankNum)).substr(0, 10), 1);
+        strings.emplace_back((i18n::localize(StringId::NEW_BANK) + " " + std::to_string(newBankNum)).substr(0, 10), 1);
         hid.update(strings.size());
         hid.select(std::distance(strings.begin(),
             std::find_if(strings.begin(), strings.end(), [](const std::pair<std::string, int>& v) { return v.first == Banks::bank->name(); })));
@@ -49,8 +49,10 @@ private:
     bool doQR(void);
     bool toggleFilter(const std::string& lang);
     bool toggleFilter(u8 type);
+    void searchBar(void);
+    void applyFilters(void);
     HidHorizontal hid;
-    std::vector<nlohmann::json> wondercards;
+    std::vector<MysteryGift::giftMatch> wondercards;
     std::vector<std::unique_ptr<Button>> buttons;
     std::vector<std::unique_ptr<ToggleButton>> langFilters;
     std::vector<std::unique_ptr<ToggleButton>> typeFilters;
@@ -61,6 +63,7 @@ private:
     void dumpCard(void) const;
     std::vector<MysteryGift::giftData> gifts;
     std::string langFilter = "";
+    std::string searchString;
     int typeFilter         = -1;
 };
 
@@ -39,7 +39,7 @@
 class InjectorScreen : public Screen
 {
 public:
-    InjectorScreen(nlohmann::json ids);
+    InjectorScreen(const MysteryGift::giftMatch& ids);
     InjectorScreen(std::unique_ptr<WCX> card);
     ~InjectorScreen() {}
     void update(touchPosition* touch) override;
@@ -58,7 +58,7 @@ private:
     int item = 0;
     HidHorizontal hid;
     Language lang = Language::JP;
-    nlohmann::json ids;
+    MysteryGift::giftMatch ids;
     const int emptySlot;
     const std::vector<MysteryGift::giftData> gifts;
 
@@ -33,6 +33,9 @@
 namespace Threads
 {
     void create(ThreadFunc entrypoint, void* arg = nullptr);
+    // A thread that talks to the network, at a priority just below the caller's. Unlike those from create, the caller
+    // joins and frees it. Returns nullptr if it couldn't be created
+    Thread createNetwork(ThreadFunc entrypoint, void* arg = nullptr);
     void destroy(void);
 }
 
@@ -31,272 +31,1604 @@
 #include "archive.hpp"
 #include "banks.hpp"
 #include "gui.hpp"
+#include "mempressure.hpp"
+#include <new>
 
 #define BANK(paths) paths.first
 #define JSON(paths) paths.second
 #define ARCHIVE Configuration::getInstance().useExtData() ? Archive::data() : Archive::sd()
 #define OTHERARCHIVE Configuration::getInstance().useExtData() ? Archive::sd() : Archive::data()
 
+// Extdata files can't change size, so callers need a fallback for when this fails
+static bool setFileSize(FS_Archive archive, const std::string& path, u32 size)
+{
+    FSStream file(archive, path, FS_OPEN_WRITE);
+    Result res = file.good() ? FSFILE_SetSize(file.getRawHandle(), size) : file.result();
+    file.close();
+    return R_SUCCEEDED(res);
+}
+
+// FNV-1a; only used to tell whether a dirty box actually differs from what was saved
+static u64 hashBox(const void* data, size_t size)
+{
+    u64 hash = 0xCBF29CE484222325;
+    for (size_t i = 0; i < size; i++)
+    {
+        hash = (hash ^ ((const u8*)data)[i]) * 0x100000001B3;
+    }
+    return hash;
+}
+
 Bank::Bank(const std::string& name, int maxBoxes) : bankName(name)
 {
+    memoryBudget((size_t)Configuration::getInstance().bankMemory() * 1024);
     load(maxBoxes);
 }
 
-void Bank::load(int maxBoxes)
+void Bank::memoryBudget(size_t bytes)
+{
+    maxResident = std::max((size_t)2, bytes / BOX_SIZE);
+    while (resident > maxResident && evict())
+        ;
+}
+
+void Bank::load(int maxBoxes)
+{
+    bool create = false;
+    pkmCache.invalidate();
+    pages.clear();
+    lastUse.clear();
+    dirty.clear();
+    dirtyBoxes.clear();
+    savedHash.clear();
+    unreadable.clear();
+    namesDirty     = false;
+    resident       = 0;
+    fileVersion    = BANK_VERSION;
+    fileBoxes      = 0;
+    fileSize       = 0;
+    fileDataOffset = sizeof(BankHeader);
+    blocks.clear();
+    needsCheck     = false;
+    prevNameHash   = {};
+    if (name() == "pksm_1" && io::exists("/3ds/PKSM/bank/bank.bin"))
+    {
+        convertFromBankBin();
+    }
+    else
+    {
+        auto paths    = this->paths();
+        bool needSave    = false;
+        bool namesLoaded = false;
+        replayJournal();
+        FSStream in(ARCHIVE, BANK(paths), FS_OPEN_READ);
+        if (in.good())
+        {
+            Gui::waitFrame(i18n::localize(StringId::BANK_LOAD));
+            BankHeader h{"BAD_MGC", 0, 0};
+            size_t size = in.size();
+            in.read((char*)&h, sizeof(BankHeader) - sizeof(int));
+            if (memcmp(&h, BANK_MAGIC.data(), 8))
+            {
+                Gui::warn(i18n::localize(StringId::BANK_CORRUPT));
+                in.close();
+                createBank(maxBoxes);
+                needSave = true;
+            }
+            else
+            {
+                // NOTE: THIS IS THE CONVERSION SECTION. WILL NEED TO BE MODIFIED WHEN THE FORMAT IS CHANGED
+                if (h.version == 1)
+                {
+                    fileDataOffset = sizeof(BankHeader) - sizeof(int);
+                    h.boxes        = (size - fileDataOffset) / BOX_SIZE;
+                    maxBoxes       = h.boxes;
+                    extern nlohmann::json g_banks;
+                    g_banks[bankName] = maxBoxes;
+                    Banks::saveJson();
+                }
+                else
+                {
+                    in.read(&h.boxes, sizeof(int));
+                }
+                fileVersion = h.version;
+
+                bool good = true;
+                if (fileVersion == BANK_VERSION)
+                {
+                    good = h.boxes >= 0 && sizeof(BankHeader) + (h.boxes + 1) * sizeof(BlockInfo) <= size;
+                    if (good)
+                    {
+                        blocks.resize(h.boxes + 1);
+                        good = in.read(blocks.data(), blocks.size() * sizeof(BlockInfo)) == blocks.size() * sizeof(BlockInfo) &&
+                               blocks.back().size <= size && blocks.back().offset <= size - blocks.back().size;
+                    }
+                    if (good)
+                    {
+                        std::vector<u8> names(blocks.back().size);
+                        in.seek(blocks.back().offset, SEEK_SET);
+                        namesLoaded = in.read(names.data(), names.size()) == names.size() && decodeNames(names.data(), names.size(), boxNames);
+                    }
+                }
+                else
+                {
+                    // Versions 1 and 2 are fixed size, and get rewritten in the current format by the save below
+                    h.version = BANK_VERSION;
+                    needSave  = true;
+                }
+                in.close();
+
+                if (good)
+                {
+                    // Only the header is read here; boxes are faulted in from the file when they are first used
+                    header    = h;
+                    fileSize  = size;
+                    fileBoxes = fileVersion == BANK_VERSION ? h.boxes : std::min(h.boxes, (int)((size - fileDataOffset) / BOX_SIZE));
+                    pages.resize(h.boxes);
+                    lastUse.resize(h.boxes, 0);
+                    dirty.resize(h.boxes, 0);
+                    savedHash.resize(h.boxes, 0);
+                    unreadable.resize(h.boxes, false);
+                }
+                else
+                {
+                    Gui::warn(i18n::localize(StringId::BANK_CORRUPT));
+                    createBank(maxBoxes);
+                    needSave = true;
+                }
+            }
+        }
+        else
+        {
+            Gui::waitFrame(i18n::localize(StringId::BANK_CREATE));
+            in.close();
+            createBank(maxBoxes);
+            needSave = true;
+            create   = true;
+        }
+
+        if (namesLoaded)
+        {
+            for (int i = boxNames.size(); i < boxes(); i++)
+            {
+                boxNames[i] = i18n::localize(StringId::STORAGE) + " " + std::to_string(i + 1);
+                needSave    = true;
+            }
+        }
+        else
+        {
+            // Banks older than version 3 keep their box names in a JSON file next to them
+            in = FSStream(ARCHIVE, JSON(paths), FS_OPEN_READ);
+            if (in.good())
+            {
+                size_t jsonSize = in.size();
+                char jsonData[jsonSize + 1];
+                in.read(jsonData, jsonSize);
+                in.close();
+                jsonData[jsonSize] = '\0';
+                boxNames           = nlohmann::json::parse(jsonData, nullptr, false);
+                if (boxNames.is_discarded())
+                {
+                    createJSON();
+                    needSave = true;
+                }
+                else
+                {
+                    for (int i = boxNames.size(); i < boxes(); i++)
+                    {
+                        boxNames[i] = i18n::localize(StringId::STORAGE) + " " + std::to_string(i + 1);
+                        if (!needSave)
+                        {
+                            needSave = true;
+                        }
+                    }
+                }
+            }
+            else
+            {
+                in.close();
+                createJSON();
+                needSave = true;
+            }
+        }
+
+        if (boxes() != maxBoxes)
+        {
+            resize(maxBoxes);
+        }
+
+        if (needSave)
+        {
+            if (create)
+            {
+                saveWithoutBackup();
+            }
+            else
+            {
+                save();
+            }
+        }
+        else
+        {
+            std::vector<u8> names;
+            encodeNames(names);
+            sha256(prevNameHash.data(), names.data(), names.size());
+        }
+
+        if (!indexValid())
+        {
+            writeIndex({});
+        }
+    }
+}
+
+Bank::BankEntry* Bank::page(int box) const
+{
+    if (!pages[box])
+    {
+        // Dirty boxes can't be evicted, so the bank can go over its budget until it is saved
+        if (resident >= maxResident)
+        {
+            evict();
+        }
+        // Other caches are only asked to give memory back when there really isn't any left
+        BankEntry* entries = new (std::nothrow) BankEntry[30];
+        if (!entries)
+        {
+            MemoryPressure::release(BOX_SIZE);
+            entries = new BankEntry[30];
+        }
+        pages[box] = std::unique_ptr<BankEntry[]>(entries);
+        if (readBox(box, pages[box].get()))
+        {
+            unreadable[box] = false;
+        }
+        else if (!unreadable[box])
+        {
+            // Only warned about once; the read is tried again whenever the box is faulted back in
+            unreadable[box] = true;
+            Gui::warn(i18n::localize(StringId::BANK_CORRUPT));
+        }
+        savedHash[box] = hashBox(pages[box].get(), BOX_SIZE);
+        resident++;
+    }
+    lastUse[box] = ++useTick;
+    return pages[box].get();
+}
+
+bool Bank::readBox(int box, BankEntry* out) const
+{
+    if (box >= fileBoxes)
+    {
+        // Added since the last save, so there is nothing on disk for it yet
+        std::fill_n((u8*)out, BOX_SIZE, 0xFF);
+        return true;
+    }
+    bool read = false;
+    FSStream in(ARCHIVE, BANK(paths()), FS_OPEN_READ);
+    if (in.good())
+    {
+        if (fileVersion == BANK_VERSION)
+        {
+            // An encoded box is never larger than a decoded one, so a bigger block can only be a damaged one
+            if (blocks[box].size <= BOX_SIZE)
+            {
+                u8 block[BOX_SIZE];
+                in.seek(blocks[box].offset, SEEK_SET);
+                read = in.read(block, blocks[box].size) == blocks[box].size && decodeBox(block, blocks[box].size, out);
+            }
+        }
+        else
+        {
+            in.seek(fileDataOffset + box * BOX_SIZE, SEEK_SET);
+            read = in.read(out, BOX_SIZE) == BOX_SIZE;
+        }
+    }
+    in.close();
+    if (!read)
+    {
+        std::fill_n((u8*)out, BOX_SIZE, 0xFF);
+    }
+    return read;
+}
+
+bool Bank::boxReadable(int box) const
+{
+    page(box);
+    return !unreadable[box];
+}
+
+void Bank::encodeBox(const BankEntry* entries, std::vector<u8>& out)
+{
+    out.clear();
+    int slot = 0;
+    while (slot < 30)
+    {
+        if ((u32)entries[slot].gen > (u32)Generation::LGPE)
+        {
+            u8 run = 0;
+            while (slot < 30 && (u32)entries[slot].gen > (u32)Generation::LGPE)
+            {
+                run++;
+                slot++;
+            }
+            out.push_back(EMPTY_RUN);
+            out.push_back(run);
+        }
+        else
+        {
+            // Everything past the end of a PKX's data is 0xFF padding
+            u16 length = sizeof(entries[slot].data);
+            while (length > 0 && entries[slot].data[length - 1] == 0xFF)
+            {
+                length--;
+            }
+            out.push_back((u8)entries[slot].gen);
+            out.push_back(length & 0xFF);
+            out.push_back(length >> 8);
+            out.insert(out.end(), entries[slot].data, entries[slot].data + length);
+            slot++;
+        }
+    }
+}
+
+bool Bank::decodeBox(const u8* data, size_t size, BankEntry* out)
+{
+    std::fill_n((u8*)out, BOX_SIZE, 0xFF);
+    size_t pos = 0;
+    int slot   = 0;
+    while (slot < 30 && pos < size)
+    {
+        u8 tag = data[pos++];
+        if (tag == EMPTY_RUN)
+        {
+            if (pos >= size)
+            {
+                return false;
+            }
+            slot += data[pos++];
+        }
+        else
+        {
+            if (tag > (u8)Generation::LGPE || pos + 2 > size)
+            {
+                return false;
+            }
+            u16 length = data[pos] | (data[pos + 1] << 8);
+            pos += 2;
+            if (length > sizeof(out[slot].data) || pos + length > size)
+            {
+                return false;
+            }
+            out[slot].gen = Generation(tag);
+            std::copy(data + pos, data + pos + length, out[slot].data);
+            pos += length;
+            slot++;
+        }
+    }
+    return slot == 30 && pos == size;
+}
+
+void Bank::encodeNames(std::vector<u8>& out) const
+{
+    out.clear();
+    for (int box = 0; box < boxes(); box++)
+    {
+        std::string name = boxName(box);
+        u16 length       = std::min(name.size(), (size_t)0xFFFF);
+        out.push_back(length & 0xFF);
+        out.push_back(length >> 8);
+        out.insert(out.end(), name.begin(), name.begin() + length);
+    }
+}
+
+bool Bank::decodeNames(const u8* data, size_t size, nlohmann::json& out)
+{
+    out        = nlohmann::json::array();
+    size_t pos = 0;
+    while (pos + 2 <= size)
+    {
+        u16 length = data[pos] | (data[pos + 1] << 8);
+        pos += 2;
+        if (pos + length > size)
+        {
+            return false;
+        }
+        out.push_back(std::string((const char*)data + pos, length));
+        pos += length;
+    }
+    return pos == size;
+}
+
+bool Bank::evict() const
+{
+    int victim = -1;
+    for (size_t box = 0; box < pages.size(); box++)
+    {
+        if (pages[box] && !dirty[box] && (victim == -1 || lastUse[box] < lastUse[victim]))
+        {
+            victim = box;
+        }
+    }
+    if (victim == -1)
+    {
+        return false;
+    }
+    pages[victim] = nullptr;
+    resident--;
+    return true;
+}
+
+bool Bank::writeTemp(std::vector<BlockInfo>& newBlocks, const BoxSource& source) const
+{
+    // Boxes that aren't resident are streamed from the old file, so the new one has to be written next to it.
+    // Block sizes have to be known before the file can be created, so boxes are encoded once to lay the file out
+    // and again to write them
+    std::string tmp = BANK(paths()) + ".tmp";
+    auto scratch    = std::unique_ptr<BankEntry[]>(new BankEntry[30]);
+    auto forEachBox = [&](const std::function<void(int, const BankEntry*)>& visit) {
+        if (source)
+        {
+            source(visit);
+            return;
+        }
+        for (int box = 0; box < boxes(); box++)
+        {
+            if (pages[box] && !unreadable[box])
+            {
+                visit(box, pages[box].get());
+            }
+            else
+            {
+                // Boxes that can't be read are passed as null, and their block is copied over as it is
+                visit(box, readBox(box, scratch.get()) ? scratch.get() : nullptr);
+            }
+        }
+    };
+    // Fills block with what is written for a box; fails if that isn't known
+    auto boxBlock = [&](int box, const BankEntry* entries, std::vector<u8>& block) {
+        if (entries)
+        {
+            encodeBox(entries, block);
+            return true;
+        }
+        if (fileVersion != BANK_VERSION)
+        {
+            return false;
+        }
+        block.resize(blocks[box].size);
+        FSStream in(ARCHIVE, BANK(paths()), FS_OPEN_READ);
+        bool read = in.good();
+        if (read)
+        {
+            in.seek(blocks[box].offset, SEEK_SET);
+            read = in.read(block.data(), block.size()) == block.size();
+        }
+        in.close();
+        return read;
+    };
+
+    std::vector<u8> block;
+    bool good = true;
+    newBlocks.resize(boxes() + 1);
+    u32 offset = sizeof(BankHeader) + (std::max(boxes(), BANK_MAX_SIZE) + 1) * sizeof(BlockInfo);
+    encodeNames(block);
+    newBlocks[boxes()] = {offset, (u32)block.size(), blockCapacity(block.size())};
+    offset += newBlocks[boxes()].capacity;
+    forEachBox([&](int box, const BankEntry* entries) {
+        if (good && !(good = boxBlock(box, entries, block)))
+        {
+            return;
+        }
+        newBlocks[box] = {offset, (u32)block.size(), blockCapacity(block.size())};
+        offset += newBlocks[box].capacity;
+    });
+    if (!good)
+    {
+        // Writing the box as empty would lose whatever is in it
+        Gui::warn(i18n::localize(StringId::BANK_CORRUPT));
+        return false;
+    }
+
+    Archive::deleteFile(ARCHIVE, tmp);
+    FSStream out(ARCHIVE, tmp, FS_OPEN_WRITE, offset);
+    if (!out.good())
+    {
+        Gui::error(i18n::localize(StringId::BANK_SAVE_ERROR), out.result());
+        out.close();
+        return false;
+    }
+    out.write(&header, sizeof(BankHeader));
+    out.write(newBlocks.data(), newBlocks.size() * sizeof(BlockInfo));
+    encodeNames(block);
+    out.write(block.data(), block.size());
+    forEachBox([&](int box, const BankEntry* entries) {
+        // A box that reads differently than it did for the layout would overrun its block
+        if (good && R_SUCCEEDED(out.result()) && (good = boxBlock(box, entries, block) && block.size() == newBlocks[box].size))
+        {
+            out.seek(newBlocks[box].offset, SEEK_SET);
+            out.write(block.data(), block.size());
+        }
+    });
+    Result res = out.result();
+    out.close();
+    if (R_FAILED(res) || !good)
+    {
+        if (R_FAILED(res))
+        {
+            Gui::error(i18n::localize(StringId::BANK_SAVE_ERROR), res);
+        }
+        else
+        {
+            Gui::warn(i18n::localize(StringId::BANK_CORRUPT));
+        }
+        Archive::deleteFile(ARCHIVE, tmp);
+        return false;
+    }
+    return true;
+}
+
+void Bank::appendRecord(std::vector<u8>& records, u32 offset, const void* data, u32 length)
+{
+    size_t pos = records.size();
+    records.resize(pos + 2 * sizeof(u32) + length);
+    *(u32*)(records.data() + pos)               = offset;
+    *(u32*)(records.data() + pos + sizeof(u32)) = length;
+    std::copy((const u8*)data, (const u8*)data + length, records.data() + pos + 2 * sizeof(u32));
+}
+
+bool Bank::writeJournal(u32 flags, const std::vector<u8>& records) const
+{
+    std::string journal = BANK(paths()) + ".journal";
+    JournalHeader h;
+    std::copy(JOURNAL_MAGIC.begin(), JOURNAL_MAGIC.end(), h.MAGIC);
+    h.flags  = flags;
+    h.length = records.size();
+    sha256(h.hash, (u8*)records.data(), records.size());
+
+    Archive::deleteFile(ARCHIVE, journal);
+    FSStream out(ARCHIVE, journal, FS_OPEN_WRITE, sizeof(JournalHeader) + records.size());
+    if (out.good())
+    {
+        out.seek(sizeof(JournalHeader), SEEK_SET);
+        out.write(records.data(), records.size());
+        // The header is what makes the journal valid, so it goes in last
+        if (R_SUCCEEDED(out.result()))
+        {
+            out.seek(0, SEEK_SET);
+            out.write(&h, sizeof(JournalHeader));
+        }
+    }
+    Result res = out.result();
+    out.close();
+    if (R_FAILED(res))
+    {
+        Gui::error(i18n::localize(StringId::BANK_SAVE_ERROR), res);
+        Archive::deleteFile(ARCHIVE, journal);
+        return false;
+    }
+    return true;
+}
+
+bool Bank::applyJournal(u32 flags, const u8* records, size_t length) const
+{
+    auto paths = this->paths();
+    Result res = 0;
+    if (flags & REPLACE_BANK)
+    {
+        // Nothing to do if the move finished before an interruption
+        FSStream tmp(ARCHIVE, BANK(paths) + ".tmp", FS_OPEN_READ);
+        bool exists = tmp.good();
+        tmp.close();
+        if (exists)
+        {
+            res = Archive::moveFile(ARCHIVE, BANK(paths) + ".tmp", ARCHIVE, BANK(paths));
+        }
+    }
+    else if (length > 0)
+    {
+        FSStream out(ARCHIVE, BANK(paths), FS_OPEN_WRITE);
+        size_t pos = 0;
+        while (out.good() && R_SUCCEEDED(out.result()) && pos + 2 * sizeof(u32) <= length)
+        {
+            u32 offset = *(const u32*)(records + pos);
+            u32 size   = *(const u32*)(records + pos + sizeof(u32));
+            pos += 2 * sizeof(u32);
+            if (pos + size > length)
+            {
+                break;
+            }
+            out.seek(offset, SEEK_SET);
+            out.write(records + pos, size);
+            pos += size;
+        }
+        res = out.result();
+        out.close();
+    }
+    if (R_FAILED(res))
+    {
+        Gui::error(i18n::localize(StringId::BANK_SAVE_ERROR), res);
+        return false;
+    }
+    return true;
+}
+
+void Bank::replayJournal() const
+{
+    auto paths          = this->paths();
+    std::string journal = BANK(paths) + ".journal";
+    FSStream in(ARCHIVE, journal, FS_OPEN_READ);
+    if (!in.good())
+    {
+        in.close();
+        return;
+    }
+    JournalHeader h;
+    bool valid = false;
+    std::vector<u8> records;
+    if (in.size() >= sizeof(JournalHeader) && in.read(&h, sizeof(JournalHeader)) == sizeof(JournalHeader) &&
+        !memcmp(h.MAGIC, JOURNAL_MAGIC.data(), JOURNAL_MAGIC.size()) && h.length == in.size() - sizeof(JournalHeader))
+    {
+        records.resize(h.length);
+        if (in.read(records.data(), h.length) == h.length)
+        {
+            u8 hash[SHA256_BLOCK_SIZE];
+            sha256(hash, records.data(), records.size());
+            valid = !memcmp(hash, h.hash, SHA256_BLOCK_SIZE);
+        }
+    }
+    in.close();
+
+    // An incomplete journal means the bank itself was never touched, so it is simply dropped
+    if (!valid || applyJournal(h.flags, records.data(), records.size()))
+    {
+        Archive::deleteFile(ARCHIVE, journal);
+        Archive::deleteFile(ARCHIVE, BANK(paths) + ".tmp");
+    }
+}
+
+bool Bank::saveWithoutBackup() const
+{
+    // The backup log can't describe this save, so it must not be extended past it
+    auto deltas = readDeltas();
+    if (!deltas.empty() && deltas.back().first.boxes != BACKUP_BREAK)
+    {
+        DeltaHeader h;
+        std::copy(DELTA_MAGIC.begin(), DELTA_MAGIC.end(), h.MAGIC);
+        h.length  = 0;
+        h.boxes   = BACKUP_BREAK;
+        h.changed = 0;
+        h.unused  = 0;
+        h.time    = time(NULL);
+        sha256(h.hash, nullptr, 0);
+        appendDelta(deltas.back().second + deltas.back().first.length, h, {});
+    }
+    return commit();
+}
+
+bool Bank::commit() const
+{
+    auto paths = this->paths();
+    Gui::waitFrame(i18n::localize(StringId::BANK_SAVE));
+    u32 flags = 0;
+    std::vector<u8> records;
+    std::vector<BlockInfo> newBlocks;
+    u32 newSize = 0;
+    std::vector<u8> names;
+    encodeNames(names);
+    u8 nameHash[SHA256_BLOCK_SIZE];
+    sha256(nameHash, names.data(), names.size());
+    // Blocks never start before this, so the directory can grow up to it
+    u32 dataStart = fileSize;
+    for (auto& block : blocks)
+    {
+        if (block.capacity)
+        {
+            dataStart = std::min(dataStart, block.offset);
+        }
+    }
+    if (fileVersion == BANK_VERSION && sizeof(BankHeader) + (boxes() + 1) * sizeof(BlockInfo) <= dataStart)
+    {
+        // Blocks that changed are rewritten where they are if they still fit in the space allocated for them, and moved
+        // to the end of the file otherwise. A resize only adds or drops blocks at the end of the directory
+        int kept = std::min(fileBoxes, boxes());
+        newBlocks.assign(blocks.begin(), blocks.begin() + kept);
+        newBlocks.resize(boxes() + 1, BlockInfo{0, 0, 0});
+        newBlocks.back() = blocks.back();
+        u32 end          = dataStart;
+        for (auto& block : newBlocks)
+        {
+            end = std::max(end, block.offset + block.capacity);
+        }
+        std::vector<bool> changed(newBlocks.size(), false);
+        auto place = [&](size_t i, const std::vector<u8>& data) {
+            if (data.size() > newBlocks[i].capacity)
+            {
+                newBlocks[i].offset   = end;
+                newBlocks[i].capacity = blockCapacity(data.size());
+                end += newBlocks[i].capacity;
+            }
+            newBlocks[i].size = data.size();
+            appendRecord(records, newBlocks[i].offset, data.data(), data.size());
+            changed[i] = true;
+        };
+
+        appendRecord(records, 0, &header, sizeof(BankHeader));
+        std::sort(dirtyBoxes.begin(), dirtyBoxes.end());
+        std::vector<u8> block;
+        for (int box : dirtyBoxes)
+        {
+            encodeBox(pages[box].get(), block);
+            place(box, block);
+        }
+        auto scratch = std::unique_ptr<BankEntry[]>(new BankEntry[30]);
+        for (int box = kept; box < boxes(); box++)
+        {
+            if (!changed[box])
+            {
+                const BankEntry* entries = pages[box].get();
+                if (!entries)
+                {
+                    readBox(box, scratch.get());
+                    entries = scratch.get();
+                }
+                encodeBox(entries, block);
+                place(box, block);
+            }
+        }
+        if (fileBoxes != boxes() || namesDirty || memcmp(nameHash, prevNameHash.data(), SHA256_BLOCK_SIZE))
+        {
+            place(boxes(), names);
+        }
+
+        if (fileBoxes != boxes())
+        {
+            appendRecord(records, sizeof(BankHeader), newBlocks.data(), newBlocks.size() * sizeof(BlockInfo));
+        }
+        else
+        {
+            for (size_t i = 0; i < newBlocks.size(); i++)
+            {
+                if (changed[i])
+                {
+                    appendRecord(records, sizeof(BankHeader) + i * sizeof(BlockInfo), &newBlocks[i], sizeof(BlockInfo));
+                }
+            }
+        }
+
+        // Moved blocks leave their old space unused, so the bank is compacted once that is most of the file
+        u32 used = 0;
+        for (auto& block : newBlocks)
+        {
+            used += block.capacity;
+        }
+        if (end - dataStart > 2 * used || (end > fileSize && !setFileSize(ARCHIVE, BANK(paths), end)))
+        {
+            records.clear();
+        }
+        else
+        {
+            newSize = end;
+        }
+    }
+    if (records.empty())
+    {
+        if (!writeTemp(newBlocks))
+        {
+            return false;
+        }
+        flags |= REPLACE_BANK;
+        for (auto& block : newBlocks)
+        {
+            newSize = std::max(newSize, block.offset + block.capacity);
+        }
+    }
+
+    bool indexChanged = !dirtyBoxes.empty() || fileBoxes != boxes();
+    if (indexChanged)
+    {
+        markIndexStale();
+    }
+    if (!writeJournal(flags, records))
+    {
+        return false;
+    }
+    // From here on the save can't be lost: if applying it is interrupted, the journal is replayed on the next load
+    // Anything that failed to apply stays dirty, so the next save writes it again along with a fresh journal
+    if (!applyJournal(flags, records.data(), records.size()))
+    {
+        return false;
+    }
+    Archive::deleteFile(ARCHIVE, BANK(paths) + ".journal");
+    if (fileVersion != BANK_VERSION)
+    {
+        // The names are part of the bank now
+        Archive::deleteFile(ARCHIVE, JSON(paths));
+    }
+    if (newSize < fileSize && !(flags & REPLACE_BANK))
+    {
+        // Nothing past the last block is used anymore
+        if (setFileSize(ARCHIVE, BANK(paths), newSize))
+        {
+            fileSize = newSize;
+        }
+    }
+    else
+    {
+        fileSize = newSize;
+    }
+    fileVersion = BANK_VERSION;
+    fileBoxes   = boxes();
+    blocks      = std::move(newBlocks);
+    if (indexChanged)
+    {
+        writeIndex(dirtyBoxes);
+    }
+    std::copy(nameHash, nameHash + SHA256_BLOCK_SIZE, prevNameHash.begin());
+    for (int box : dirtyBoxes)
+    {
+        dirty[box]     = 0;
+        savedHash[box] = hashBox(pages[box].get(), BOX_SIZE);
+    }
+    dirtyBoxes.clear();
+    namesDirty = false;
+    needsCheck = false;
+    return true;
+}
+
+bool Bank::save() const
+{
+    if (Configuration::getInstance().autoBackup())
+    {
+        PendingDelta delta;
+        if (backup(delta))
+        {
+            if (!commit())
+            {
+                return false;
+            }
+            // If the record can't be added, the log must not be extended past this save either
+            if (!appendDelta(delta.offset, delta.header, delta.payload))
+            {
+                delta.header.length  = 0;
+                delta.header.boxes   = BACKUP_BREAK;
+                delta.header.changed = 0;
+                sha256(delta.header.hash, nullptr, 0);
+                appendDelta(delta.offset, delta.header, {});
+            }
+            return true;
+        }
+        if (!Gui::showChoiceMessage(i18n::localize(StringId::BACKUP_FAIL_SAVE_1), i18n::localize(StringId::BACKUP_FAIL_SAVE_2)))
+        {
+            return false;
+        }
+    }
+    return saveWithoutBackup();
+}
+
+void Bank::resize(size_t boxes)
+{
+    if ((int)boxes != this->boxes())
+    {
+        Gui::showResizeStorage();
+        for (size_t i = boxes; i < pages.size(); i++)
+        {
+            if (pages[i])
+            {
+                resident--;
+            }
+        }
+        pages.resize(boxes);
+        lastUse.resize(boxes, 0);
+        dirty.resize(boxes, 0);
+        savedHash.resize(boxes, 0);
+        unreadable.resize(boxes, false);
+        dirtyBoxes.erase(std::remove_if(dirtyBoxes.begin(), dirtyBoxes.end(), [boxes](int box) { return box >= (int)boxes; }), dirtyBoxes.end());
+        header.boxes = boxes;
+
+        for (size_t i = boxNames.size(); i < boxes; i++)
+        {
+            boxNames[i] = i18n::localize(StringId::STORAGE) + " " + std::to_string(i + 1);
+        }
+
+        pkmCache.invalidate();
+        save();
+    }
+}
+
+std::shared_ptr<PKX> Bank::entryPkm(Generation gen, const u8* data)
+{
+    switch (gen)
+    {
+        case Generation::FOUR:
+            return std::make_shared<PK4>(const_cast<u8*>(data), false, false);
+        case Generation::FIVE:
+            return std::make_shared<PK5>(const_cast<u8*>(data), false, false);
+        case Generation::SIX:
+            return std::make_shared<PK6>(const_cast<u8*>(data), false, false);
+        case Generation::SEVEN:
+            return std::make_shared<PK7>(const_cast<u8*>(data), false, false);
+        case Generation::LGPE:
+            return std::make_shared<PB7>(const_cast<u8*>(data), false);
+        case Generation::UNUSED:
+        default:
+            return std::make_shared<PK7>();
+    }
+}
+
+std::shared_ptr<PKX> Bank::pkm(int box, int slot) const
+{
+    const BankEntry& entry = page(box)[slot];
+    return entryPkm(entry.gen, entry.data);
+}
+
+bool Bank::indexValid() const
+{
+    FSStream in(ARCHIVE, BANK(paths()) + ".idx", FS_OPEN_READ);
+    BankIndex::Header h;
+    bool valid = in.good() && in.read(&h, sizeof(h)) == sizeof(h) && in.size() == sizeof(h) + boxes() * 30 * sizeof(BankIndex::Entry) &&
+                 !memcmp(h.MAGIC, BankIndex::MAGIC.data(), BankIndex::MAGIC.size()) && h.version == BankIndex::VERSION &&
+                 (int)h.boxes == boxes() && !h.stale;
+    in.close();
+    return valid;
+}
+
+void Bank::markIndexStale() const
+{
+    FSStream out(ARCHIVE, BANK(paths()) + ".idx", FS_OPEN_WRITE);
+    if (out.good())
+    {
+        u32 stale = 1;
+        out.seek(offsetof(BankIndex::Header, stale), SEEK_SET);
+        out.write(&stale, sizeof(u32));
+    }
+    out.close();
+}
+
+void Bank::writeIndex(const std::vector<int>& boxes) const
+{
+    std::string path = BANK(paths()) + ".idx";
+    BankIndex::Header h;
+    std::copy(BankIndex::MAGIC.begin(), BankIndex::MAGIC.end(), h.MAGIC);
+    h.version = BankIndex::VERSION;
+    h.boxes   = this->boxes();
+    h.stale   = 0;
+
+    // Only a stale flag left by the save that is being finished is acceptable here
+    FSStream in(ARCHIVE, path, FS_OPEN_READ);
+    BankIndex::Header old;
+    bool rebuild = !in.good() || in.read(&old, sizeof(old)) != sizeof(old) || memcmp(old.MAGIC, h.MAGIC, sizeof(h.MAGIC)) ||
+                   old.version != h.version || in.size() != sizeof(h) + old.boxes * 30 * sizeof(BankIndex::Entry);
+    in.close();
+    // After a resize only the boxes that were added need entries, if the file can be resized
+    int firstNew = h.boxes;
+    if (!rebuild && old.boxes != h.boxes)
+    {
+        rebuild  = !setFileSize(ARCHIVE, path, sizeof(h) + h.boxes * 30 * sizeof(BankIndex::Entry));
+        firstNew = std::min(old.boxes, h.boxes);
+    }
+
+    if (rebuild)
+    {
+        Archive::deleteFile(ARCHIVE, path);
+        firstNew = 0;
+    }
+    FSStream out = rebuild ? FSStream(ARCHIVE, path, FS_OPEN_WRITE, sizeof(h) + h.boxes * 30 * sizeof(BankIndex::Entry))
+                           : FSStream(ARCHIVE, path, FS_OPEN_WRITE);
+    if (!out.good())
+    {
+        out.close();
+        return;
+    }
+    // Boxes that aren't resident are streamed rather than paged in, like filterBoxes does
+    auto scratch  = std::unique_ptr<BankEntry[]>(new BankEntry[30]);
+    bool complete = true;
+    auto write    = [&](int box) {
+        const BankEntry* entries = pages[box].get();
+        if (!entries || unreadable[box])
+        {
+            if (!readBox(box, scratch.get()))
+            {
+                // Left out of the index, which stays stale so that it is rebuilt once the box can be read
+                complete = false;
+                return;
+            }
+            entries = scratch.get();
+        }
+        BankIndex::Entry index[30];
+        for (int slot = 0; slot < 30; slot++)
+        {
+            index[slot] = BankIndex::entry(*entryPkm(entries[slot].gen, entries[slot].data));
+        }
+        out.seek(sizeof(h) + box * sizeof(index), SEEK_SET);
+        out.write(index, sizeof(index));
+    };
+    for (int box : boxes)
+    {
+        if (box < firstNew)
+        {
+            write(box);
+        }
+    }
+    for (int box = firstNew; box < this->boxes() && R_SUCCEEDED(out.result()); box++)
+    {
+        write(box);
+    }
+    // Written last, so that a partially written index stays stale
+    if (R_SUCCEEDED(out.result()) && complete)
+    {
+        out.seek(0, SEEK_SET);
+        out.write(&h, sizeof(h));
+    }
+    out.close();
+}
+
+void Bank::pkm(std::shared_ptr<PKX> pkm, int box, int slot)
+{
+    BankEntry& entry = page(box)[slot];
+    // What is shown for the box isn't what is on disk, so saving it would overwrite the real slots
+    if (unreadable[box])
+    {
+        return;
+    }
+    pkmCache.invalidate(box * 30 + slot);
+    if (!dirty[box])
+    {
+        dirtyBoxes.push_back(box);
+    }
+    dirty[box] |= BIT(slot);
+    needsCheck = true;
+    if (pkm->species() == 0)
+    {
+        std::fill_n((char*)&entry, sizeof(BankEntry), 0xFF);
+        return;
+    }
+    entry.gen = pkm->generation();
+    std::copy(pkm->rawData(), pkm->rawData() + pkm->getLength(), entry.data);
+    if (pkm->getLength() < 260)
+    {
+        std::fill_n(entry.data + pkm->getLength(), 260 - pkm->getLength(), 0xFF);
+    }
+}
+
+std::shared_ptr<const PKX> Bank::cachedPkm(int box, int slot) const
 {
-    bool create = false;
-    if (data)
-    {
-        delete[] data;
-        data = nullptr;
-    }
-    needsCheck = false;
-    if (name() == "pksm_1" && io::exists("/3ds/PKSM/bank/bank.bin"))
+    int index                      = box * 30 + slot;
+    std::shared_ptr<const PKX> ret = pkmCache.find(index);
+    if (!ret)
     {
-        convertFromBankBin();
+        ret = pkm(box, slot);
+        pkmCache.insert(index, ret);
     }
-    else
+    return ret;
+}
+
+std::vector<bool> Bank::filterBoxes(const PKFilter& filter) const
+{
+    std::vector<bool> ret;
+    ret.reserve(boxes() * 30);
+    // Indexed by Generation; compiled on first use since most banks only hold a couple of generations
+    std::array<std::optional<PKFilter::Compiled>, 5> compiled;
+    // Scanning shouldn't push the boxes the user is looking at out of memory, so boxes that aren't resident are streamed
+    auto scratch = std::unique_ptr<BankEntry[]>(new BankEntry[30]);
+    for (int box = 0; box < boxes(); box++)
     {
-        auto paths    = this->paths();
-        bool needSave = false;
-        FSStream in(ARCHIVE, BANK(paths), FS_OPEN_READ);
-        if (in.good())
+        const BankEntry* entries = pages[box].get();
+        if (!entries)
         {
-            Gui::waitFrame(i18n::localize("BANK_LOAD"));
-            BankHeader h{"BAD_MGC", 0, 0};
-            size = in.size();
-            in.read((char*)&h, sizeof(BankHeader) - sizeof(int));
-            if (memcmp(&h, BANK_MAGIC.data(), 8))
+            readBox(box, scratch.get());
+            entries = scratch.get();
+        }
+        for (int slot = 0; slot < 30; slot++)
+        {
+            size_t gen = (size_t)entries[slot].gen;
+            if (gen >= compiled.size())
             {
-                Gui::warn(i18n::localize("BANK_CORRUPT"));
-                in.close();
-                createBank(maxBoxes);
-                needSave = true;
+                ret.push_back(false);
+                continue;
             }
-            else
+            if (!compiled[gen])
             {
-                // NOTE: THIS IS THE CONVERSION SECTION. WILL NEED TO BE MODIFIED WHEN THE FORMAT IS CHANGED
-                if (h.version == 1)
-                {
-                    h.boxes  = (size - (sizeof(BankHeader) - sizeof(int))) / sizeof(BankEntry) / 30;
-                    maxBoxes = h.boxes;
-                    extern nlohmann::json g_banks;
-                    g_banks[bankName] = maxBoxes;
-                    Banks::saveJson();
-                    data      = new u8[size = size + sizeof(int)];
-                    h.version = BANK_VERSION;
-                    needSave  = true;
-                }
-                else
-                {
-                    data = new u8[size];
-                    in.read(&h.boxes, sizeof(int));
-                }
-                std::copy((char*)&h, (char*)(&h + 1), data);
-                in.read(data + sizeof(BankHeader), size - sizeof(BankHeader));
-                in.close();
+                compiled[gen] = filter.compile(entries[slot].gen);
             }
+            ret.push_back((*compiled[gen])(entries[slot].data));
         }
-        else
+    }
+    return ret;
+}
+
+bool Bank::forEachEntry(const std::string& name, const std::function<void(int box, int slot, Generation gen, const u8* data)>& callback)
+{
+    return readFile(false, BANK(paths(name)), callback);
+}
+
+bool Bank::buildIndex(const std::string& name)
+{
+    std::string path = BANK(paths(name));
+    int boxes        = 0;
+    std::vector<BankIndex::Entry> entries;
+    bool good = readFile(
+        false, path,
+        [&entries](int box, int slot, Generation gen, const u8* data) {
+            if (entries.size() < (size_t)(box + 1) * 30)
+            {
+                entries.resize((box + 1) * 30, BankIndex::empty());
+            }
+            entries[box * 30 + slot] = BankIndex::entry(*entryPkm(gen, data));
+        },
+        &boxes);
+    if (!good)
+    {
+        return false;
+    }
+    entries.resize(boxes * 30, BankIndex::empty());
+
+    BankIndex::Header h;
+    std::copy(BankIndex::MAGIC.begin(), BankIndex::MAGIC.end(), h.MAGIC);
+    h.version = BankIndex::VERSION;
+    h.boxes   = boxes;
+    h.stale   = 0;
+
+    Archive::deleteFile(ARCHIVE, path + ".idx");
+    FSStream out(ARCHIVE, path + ".idx", FS_OPEN_WRITE, sizeof(h) + entries.size() * sizeof(BankIndex::Entry));
+    if (out.good())
+    {
+        out.write(&h, sizeof(h));
+        out.write(entries.data(), entries.size() * sizeof(BankIndex::Entry));
+    }
+    Result res = out.result();
+    out.close();
+    if (R_FAILED(res))
+    {
+        Archive::deleteFile(ARCHIVE, path + ".idx");
+        return false;
+    }
+    return true;
+}
+
+bool Bank::readFile(bool sd, const std::string& path, const std::function<void(int box, int slot, Generation gen, const u8* data)>& callback,
+    int* boxes, nlohmann::json* names)
+{
+    FSStream in(sd ? Archive::sd() : (ARCHIVE), path, FS_OPEN_READ);
+    BankHeader h;
+    size_t size = in.size();
+    if (!in.good() || in.read(&h, sizeof(BankHeader) - sizeof(int)) != sizeof(BankHeader) - sizeof(int) || memcmp(h.MAGIC, BANK_MAGIC.data(), 8))
+    {
+        in.close();
+        return false;
+    }
+    u32 dataOffset = sizeof(BankHeader);
+    if (h.version == 1)
+    {
+        dataOffset = sizeof(BankHeader) - sizeof(int);
+        h.boxes    = (size - dataOffset) / BOX_SIZE;
+    }
+    else
+    {
+        in.read(&h.boxes, sizeof(int));
+    }
+    std::vector<BlockInfo> directory;
+    if (h.version == BANK_VERSION)
+    {
+        if (h.boxes < 0 || sizeof(BankHeader) + (h.boxes + 1) * sizeof(BlockInfo) > size)
         {
-            Gui::waitFrame(i18n::localize("BANK_CREATE"));
             in.close();
-            createBank(maxBoxes);
-            needSave = true;
-            create = true;
+            return false;
         }
-
-        in = FSStream(ARCHIVE, JSON(paths), FS_OPEN_READ);
-        if (in.good())
+        directory.resize(h.boxes + 1);
+        in.read(directory.data(), directory.size() * sizeof(BlockInfo));
+    }
+    if (boxes)
+    {
+        *boxes = h.boxes;
+    }
+    if (names)
+    {
+        *names = nlohmann::json::array();
+        if (!directory.empty() && directory.back().size <= size)
         {
-            size_t jsonSize = in.size();
-            char jsonData[jsonSize + 1];
-            in.read(jsonData, jsonSize);
-            in.close();
-            jsonData[jsonSize] = '\0';
-            boxNames           = nlohmann::json::parse(jsonData, nullptr, false);
-            if (boxNames.is_discarded())
+            std::vector<u8> table(directory.back().size);
+            in.seek(directory.back().offset, SEEK_SET);
+            if (in.read(table.data(), table.size()) != table.size() || !decodeNames(table.data(), table.size(), *names))
             {
-                createJSON();
-                needSave = true;
+                *names = nlohmann::json::array();
             }
-            else
+        }
+    }
+    if (!callback)
+    {
+        in.close();
+        return true;
+    }
+
+    // Worker threads have small stacks, so nothing box sized goes on the stack
+    auto entries = std::unique_ptr<BankEntry[]>(new BankEntry[30]);
+    std::vector<u8> block(BOX_SIZE);
+    for (int box = 0; box < h.boxes && in.good(); box++)
+    {
+        bool read = false;
+        if (h.version == BANK_VERSION)
+        {
+            // Blocks bigger than a decoded box are damaged, like in readBox
+            if (directory[box].size <= BOX_SIZE)
             {
-                for (int i = boxNames.size(); i < boxes(); i++)
-                {
-                    boxNames[i] = i18n::localize("STORAGE") + " " + std::to_string(i + 1);
-                    if (!needSave)
-                    {
-                        needSave = true;
-                    }
-                }
+                in.seek(directory[box].offset, SEEK_SET);
+                read = in.read(block.data(), directory[box].size) == directory[box].size &&
+                       decodeBox(block.data(), directory[box].size, entries.get());
             }
         }
         else
         {
-            in.close();
-            createJSON();
-            needSave = true;
+            in.seek(dataOffset + box * BOX_SIZE, SEEK_SET);
+            read = in.read(entries.get(), BOX_SIZE) == BOX_SIZE;
         }
-
-        if (boxes() != maxBoxes)
+        if (!read)
         {
-            resize(maxBoxes);
+            std::fill_n((u8*)entries.get(), BOX_SIZE, 0xFF);
         }
+        for (int slot = 0; slot < 30; slot++)
+        {
+            callback(box, slot, entries[slot].gen, entries[slot].data);
+        }
+    }
+    in.close();
+    return true;
+}
 
-        if (needSave)
+bool Bank::backup(PendingDelta& delta) const
+{
+    Gui::waitFrame(i18n::localize(StringId::BANK_BACKUP));
+    auto paths       = this->paths();
+    std::string base = backupPath() + ".bak";
+    std::string log  = backupPath() + ".delta";
+    auto deltas      = readDeltas();
+    u32 logSize      = deltas.empty() ? 0 : deltas.back().second + deltas.back().first.length;
+
+    FSStream in(Archive::sd(), base, FS_OPEN_READ);
+    bool haveBase = in.good();
+    in.close();
+    // Without a log the base may be left over from an older backup scheme or from a deleted bank of the same name, so it
+    // can't be trusted to match the bank as it is on disk
+    if (!haveBase || deltas.empty() || logSize > fileSize || deltas.back().first.boxes == BACKUP_BREAK)
+    {
+        // Start over from the bank as it is on disk now
+        Archive::copyFile(Archive::sd(), base, Archive::sd(), base + ".old");
+        Archive::copyFile(Archive::sd(), log, Archive::sd(), log + ".old");
+        Archive::copyFile(Archive::sd(), "/3ds/PKSM/backups/" + bankName + ".json.bak", Archive::sd(), "/3ds/PKSM/backups/" + bankName + ".json.bak.old");
+        Archive::deleteFile(Archive::sd(), log);
+        Result res = Archive::copyFile(ARCHIVE, BANK(paths), Archive::sd(), base);
+        if (R_FAILED(res))
         {
-            if (create)
-            {
-                saveWithoutBackup();
-            }
-            else
-            {
-                save();
-            }
+            return false;
         }
-        else
+        // Banks from before version 3 still have their names in a separate file
+        Archive::copyFile(ARCHIVE, JSON(paths), Archive::sd(), "/3ds/PKSM/backups/" + bankName + ".json.bak");
+        logSize = 0;
+    }
+
+    // Everything this save is about to write: changed boxes, boxes added since the last save, and the names
+    std::vector<int> changed = dirtyBoxes;
+    for (int box = fileBoxes; box < boxes(); box++)
+    {
+        changed.push_back(box);
+    }
+    std::sort(changed.begin(), changed.end());
+    changed.erase(std::unique(changed.begin(), changed.end()), changed.end());
+
+    std::vector<u8> payload;
+    std::vector<u8> block;
+    auto scratch = std::unique_ptr<BankEntry[]>(new BankEntry[30]);
+    for (int box : changed)
+    {
+        const BankEntry* entries = pages[box].get();
+        if (!entries)
         {
-            sha256(prevHash.data(), data, size);
-            std::string nameData = boxNames.dump(2);
-            sha256(prevNameHash.data(), (u8*)nameData.data(), nameData.size());
+            readBox(box, scratch.get());
+            entries = scratch.get();
         }
+        encodeBox(entries, block);
+        u32 record[2] = {(u32)box, (u32)block.size()};
+        payload.insert(payload.end(), (u8*)record, (u8*)(record + 2));
+        payload.insert(payload.end(), block.begin(), block.end());
     }
+    encodeNames(block);
+    payload.insert(payload.end(), block.begin(), block.end());
+
+    DeltaHeader& h = delta.header;
+    std::copy(DELTA_MAGIC.begin(), DELTA_MAGIC.end(), h.MAGIC);
+    h.length  = payload.size();
+    h.boxes   = boxes();
+    h.changed = changed.size();
+    h.unused  = 0;
+    h.time    = time(NULL);
+    sha256(h.hash, payload.data(), payload.size());
+    delta.offset  = logSize;
+    delta.payload = std::move(payload);
+    return true;
 }
 
-bool Bank::saveWithoutBackup() const
+bool Bank::appendDelta(u32 offset, const DeltaHeader& header, const std::vector<u8>& payload) const
 {
-    auto paths = this->paths();
-    Gui::waitFrame(i18n::localize("BANK_SAVE"));
-    Archive::deleteFile(ARCHIVE, BANK(paths));
-    FSStream out(ARCHIVE, BANK(paths), FS_OPEN_WRITE, sizeof(BankHeader) + sizeof(BankEntry) * boxes() * 30);
+    std::string log = backupPath() + ".delta";
+    u32 size        = offset + sizeof(DeltaHeader) + payload.size();
+    FSStream out(Archive::sd(), log, FS_OPEN_WRITE, size);
+    // The sized constructor doesn't resize an existing file, and whatever was past a damaged record has to go
+    u64 actual = 0;
+    if (out.good() && R_SUCCEEDED(FSFILE_GetSize(out.getRawHandle(), &actual)) && actual != size)
+    {
+        FSFILE_SetSize(out.getRawHandle(), size);
+    }
     if (out.good())
     {
-        out.write(data, sizeof(BankHeader) + sizeof(BankEntry) * boxes() * 30);
-        out.close();
+        out.seek(offset, SEEK_SET);
+        out.write(&header, sizeof(DeltaHeader));
+        out.write(payload.data(), payload.size());
+    }
+    Result res = out.good() ? out.result() : -1;
+    out.close();
+    return R_SUCCEEDED(res);
+}
 
-        std::string jsonData = boxNames.dump(2);
-        Archive::deleteFile(ARCHIVE, JSON(paths));
-        out = FSStream(ARCHIVE, JSON(paths), FS_OPEN_WRITE, jsonData.size());
-        if (out.good())
-        {
-            out.write(jsonData.data(), jsonData.size() + 1);
-            sha256(prevHash.data(), data, sizeof(BankHeader) + sizeof(BankEntry) * boxes() * 30);
-            sha256(prevNameHash.data(), (u8*)jsonData.data(), jsonData.size());
-        }
-        else
+std::vector<std::pair<Bank::DeltaHeader, u32>> Bank::readDeltas() const
+{
+    std::vector<std::pair<DeltaHeader, u32>> ret;
+    FSStream in(Archive::sd(), backupPath() + ".delta", FS_OPEN_READ);
+    if (!in.good())
+    {
+        in.close();
+        return ret;
+    }
+    // Only headers are read; records are written whole, so only the last one can have been cut short
+    u32 offset = 0;
+    DeltaHeader h;
+    while (offset + sizeof(DeltaHeader) <= in.size())
+    {
+        in.seek(offset, SEEK_SET);
+        if (in.read(&h, sizeof(DeltaHeader)) != sizeof(DeltaHeader) || memcmp(h.MAGIC, DELTA_MAGIC.data(), DELTA_MAGIC.size()) ||
+            h.length > in.size() - offset - sizeof(DeltaHeader))
         {
-            Gui::error(i18n::localize("BANK_NAME_ERROR"), out.result());
+            break;
         }
-        out.close();
-        return true;
+        ret.emplace_back(h, offset + sizeof(DeltaHeader));
+        offset += sizeof(DeltaHeader) + h.length;
     }
-    else
+    if (!ret.empty())
     {
-        Gui::error(i18n::localize("BANK_SAVE_ERROR"), out.result());
-        out.close();
-        return false;
+        std::vector<u8> payload(ret.back().first.length);
+        in.seek(ret.back().second, SEEK_SET);
+        u8 hash[SHA256_BLOCK_SIZE];
+        bool good = in.read(payload.data(), payload.size()) == payload.size();
+        sha256(hash, payload.data(), payload.size());
+        if (!good || memcmp(hash, ret.back().first.hash, SHA256_BLOCK_SIZE))
+        {
+            ret.pop_back();
+        }
     }
-
-    needsCheck = false;
+    in.close();
+    return ret;
 }
 
-bool Bank::save() const
+std::vector<Bank::BackupPoint> Bank::backups() const
 {
-    if (Configuration::getInstance().autoBackup())
+    std::vector<BackupPoint> ret;
+    int baseBoxes;
+    if (!readFile(true, backupPath() + ".bak", nullptr, &baseBoxes))
+    {
+        return ret;
+    }
+    ret.push_back({0, 0, baseBoxes, 0});
+    for (auto& delta : readDeltas())
     {
-        if (!backup() && !Gui::showChoiceMessage(i18n::localize("BACKUP_FAIL_SAVE_1"), i18n::localize("BACKUP_FAIL_SAVE_2")))
+        if (delta.first.boxes == BACKUP_BREAK)
         {
-            return false;
+            break;
         }
+        ret.push_back({(u32)ret.size(), (time_t)delta.first.time, (int)delta.first.boxes, delta.first.changed});
     }
-    return saveWithoutBackup();
+    return ret;
 }
 
-void Bank::resize(size_t boxes)
+bool Bank::restore(u32 point)
 {
-    size_t newSize = sizeof(BankHeader) + sizeof(BankEntry) * boxes * 30;
-    auto paths     = this->paths();
-    if (newSize != size)
+    auto points = backups();
+    if (point >= points.size())
     {
-        Gui::showResizeStorage();
-        u8* newData = new u8[newSize];
-        std::copy(data, data + std::min(newSize, size), newData);
-        delete[] data;
-        if (newSize > size)
+        return false;
+    }
+    Gui::waitFrame(i18n::localize(StringId::BANK_LOAD));
+
+    // Only the names and where each box's newest record is are kept; the boxes themselves are streamed from the backup into
+    // a new bank file, so a restore stays within the memory budget however big the bank is
+    int restoredBoxes = std::max(points[point].boxes, 0);
+    // Offset of the box's newest record in the log and its size, or a size of 0 if the box is as it was in the base
+    std::vector<std::pair<u32, u32>> latest(restoredBoxes, {0, 0});
+    nlohmann::json names;
+    if (!readFile(true, backupPath() + ".bak", nullptr, nullptr, &names))
+    {
+        return false;
+    }
+    if (names.empty())
+    {
+        FSStream in(Archive::sd(), "/3ds/PKSM/backups/" + bankName + ".json.bak", FS_OPEN_READ);
+        if (in.good())
         {
-            std::fill_n(newData + size, newSize - size, 0xFF);
+            std::string json(in.size(), '\0');
+            in.read(json.data(), json.size());
+            names = nlohmann::json::parse(json, nullptr, false);
+            if (names.is_discarded() || !names.is_array())
+            {
+                names = nlohmann::json::array();
+            }
         }
-        data = newData;
-
-        ((BankHeader*)data)->boxes = boxes;
+        in.close();
+    }
 
-        for (size_t i = boxNames.size(); i < boxes; i++)
+    auto deltas = readDeltas();
+    std::vector<u8> block(BOX_SIZE);
+    FSStream log(Archive::sd(), backupPath() + ".delta", FS_OPEN_READ);
+    for (u32 i = 0; i < point && log.good(); i++)
+    {
+        u32 start  = deltas[i].second;
+        u32 length = deltas[i].first.length;
+        SHA256_CTX ctx;
+        u8 hash[SHA256_BLOCK_SIZE];
+        sha256_init(&ctx);
+        for (u32 pos = 0; pos < length; pos += block.size())
+        {
+            u32 size = std::min((u32)block.size(), length - pos);
+            log.seek(start + pos, SEEK_SET);
+            log.read(block.data(), size);
+            sha256_update(&ctx, block.data(), size);
+        }
+        sha256_final(&ctx, hash);
+        if (memcmp(hash, deltas[i].first.hash, SHA256_BLOCK_SIZE))
         {
-            boxNames[i] = i18n::localize("STORAGE") + " " + std::to_string(i + 1);
+            log.close();
+            Gui::warn(i18n::localize(StringId::BANK_CORRUPT));
+            return false;
         }
 
-        size = newSize;
-        save();
+        u32 pos = 0;
+        for (u32 record = 0; record < deltas[i].first.changed && pos + 2 * sizeof(u32) <= length; record++)
+        {
+            u32 info[2];
+            log.seek(start + pos, SEEK_SET);
+            log.read(info, sizeof(info));
+            pos += sizeof(info);
+            if (pos + info[1] > length)
+            {
+                pos = length + 1;
+                break;
+            }
+            if (info[0] < latest.size())
+            {
+                latest[info[0]] = {start + pos, info[1]};
+            }
+            pos += info[1];
+        }
+        if (pos <= length)
+        {
+            std::vector<u8> table(length - pos);
+            log.seek(start + pos, SEEK_SET);
+            log.read(table.data(), table.size());
+            decodeNames(table.data(), table.size(), names);
+        }
     }
-}
 
-std::shared_ptr<PKX> Bank::pkm(int box, int slot) const
-{
-    BankEntry* bank = (BankEntry*)(data + sizeof(BankHeader));
-    int index       = box * 30 + slot;
-    switch (bank[index].gen)
-    {
-        case Generation::FOUR:
-            return std::make_shared<PK4>(bank[index].data, false, false);
-        case Generation::FIVE:
-            return std::make_shared<PK5>(bank[index].data, false, false);
-        case Generation::SIX:
-            return std::make_shared<PK6>(bank[index].data, false, false);
-        case Generation::SEVEN:
-            return std::make_shared<PK7>(bank[index].data, false, false);
-        case Generation::LGPE:
-            return std::make_shared<PB7>(bank[index].data, false);
-        case Generation::UNUSED:
-        default:
-            return std::make_shared<PK7>();
-    }
-}
+    auto restored     = std::unique_ptr<BankEntry[]>(new BankEntry[30]);
+    BoxSource source = [&](const std::function<void(int, const BankEntry*)>& visit) {
+        auto finish = [&](int box) {
+            if (latest[box].second > 0)
+            {
+                u32 size = std::min((u32)BOX_SIZE, latest[box].second);
+                log.seek(latest[box].first, SEEK_SET);
+                if (log.read(block.data(), size) != latest[box].second || !decodeBox(block.data(), size, restored.get()))
+                {
+                    std::fill_n((u8*)restored.get(), BOX_SIZE, 0xFF);
+                }
+            }
+            visit(box, restored.get());
+        };
+        int next = 0;
+        readFile(true, backupPath() + ".bak", [&](int box, int slot, Generation gen, const u8* data) {
+            if (box < restoredBoxes)
+            {
+                restored[slot].gen = gen;
+                std::copy(data, data + sizeof(restored[slot].data), restored[slot].data);
+                if (slot == 29)
+                {
+                    finish(box);
+                    next = box + 1;
+                }
+            }
+        });
+        // Boxes added after the base was taken
+        for (; next < restoredBoxes; next++)
+        {
+            std::fill_n((u8*)restored.get(), BOX_SIZE, 0xFF);
+            finish(next);
+        }
+    };
 
-void Bank::pkm(std::shared_ptr<PKX> pkm, int box, int slot)
-{
-    BankEntry* bank = (BankEntry*)(data + sizeof(BankHeader));
-    int index       = box * 30 + slot;
-    BankEntry newEntry;
-    if (pkm->species() == 0)
+    // Whatever hasn't been saved is dropped either way, so on failure the bank is just reloaded as it is on disk
+    int oldBoxes = boxes();
+    header.boxes = restoredBoxes;
+    boxNames     = names;
+    for (int i = boxNames.size(); i < boxes(); i++)
     {
-        std::fill_n((char*)&newEntry, sizeof(BankEntry), 0xFF);
-        bank[index] = newEntry;
-        needsCheck  = true;
-        return;
+        boxNames[i] = i18n::localize(StringId::STORAGE) + " " + std::to_string(i + 1);
     }
-    newEntry.gen = pkm->generation();
-    std::copy(pkm->rawData(), pkm->rawData() + pkm->getLength(), newEntry.data);
-    if (pkm->getLength() < 260)
+    markIndexStale();
+    std::vector<BlockInfo> newBlocks;
+    bool good = writeTemp(newBlocks, source) && writeJournal(REPLACE_BANK, {}) && applyJournal(REPLACE_BANK, nullptr, 0);
+    if (!good)
     {
-        std::fill_n(newEntry.data + pkm->getLength(), 260 - pkm->getLength(), 0xFF);
+        log.close();
+        load(oldBoxes);
+        return false;
     }
-    bank[index] = newEntry;
-    needsCheck  = true;
-}
+    Archive::deleteFile(ARCHIVE, BANK(paths()) + ".journal");
+    // The names are part of the bank now
+    Archive::deleteFile(ARCHIVE, JSON(paths()));
 
-bool Bank::backup() const
-{
-    Gui::waitFrame(i18n::localize("BANK_BACKUP"));
-    auto paths = this->paths();
-    Archive::copyFile(Archive::sd(), "/3ds/PKSM/backups/" + bankName + ".bnk.bak", Archive::sd(), "/3ds/PKSM/backups/" + bankName + ".bnk.bak.old");
-    Archive::copyFile(Archive::sd(), "/3ds/PKSM/backups/" + bankName + ".json.bak", Archive::sd(), "/3ds/PKSM/backups/" + bankName + ".json.bak.old");
-    Result res = Archive::copyFile(ARCHIVE, BANK(paths), Archive::sd(), "/3ds/PKSM/backups/" + bankName + ".bnk.bak");
-    if (R_FAILED(res))
+    // The restored bank becomes a new point after the ones that were restorable, unless backups are off
+    u32 offset = points.size() > 1 ? deltas[points.size() - 2].second + deltas[points.size() - 2].first.length : 0;
+    DeltaHeader h;
+    std::copy(DELTA_MAGIC.begin(), DELTA_MAGIC.end(), h.MAGIC);
+    h.boxes   = restoredBoxes;
+    h.changed = restoredBoxes;
+    h.unused  = 0;
+    h.time    = time(NULL);
+    if (Configuration::getInstance().autoBackup())
     {
-        return false;
+        // Same layout as a record from backup(), streamed: the payload goes in first and the header last
+        FSStream out(Archive::sd(), backupPath() + ".delta", FS_OPEN_WRITE);
+        SHA256_CTX ctx;
+        sha256_init(&ctx);
+        u32 length = 0;
+        auto write = [&](const void* data, u32 size) {
+            out.seek(offset + sizeof(DeltaHeader) + length, SEEK_SET);
+            out.write(data, size);
+            sha256_update(&ctx, (const u8*)data, size);
+            length += size;
+        };
+        std::vector<u8> encoded;
+        if (out.good())
+        {
+            source([&](int box, const BankEntry* entries) {
+                encodeBox(entries, encoded);
+                u32 info[2] = {(u32)box, (u32)encoded.size()};
+                write(info, sizeof(info));
+                write(encoded.data(), encoded.size());
+            });
+            encodeNames(encoded);
+            write(encoded.data(), encoded.size());
+            h.length = length;
+            sha256_final(&ctx, h.hash);
+            if (R_SUCCEEDED(out.result()))
+            {
+                out.seek(offset, SEEK_SET);
+                out.write(&h, sizeof(DeltaHeader));
+            }
+            FSFILE_SetSize(out.getRawHandle(), offset + sizeof(DeltaHeader) + length);
+        }
+        good = out.good() && R_SUCCEEDED(out.result());
+        out.close();
+    }
+    log.close();
+    if (!Configuration::getInstance().autoBackup() || !good)
+    {
+        h.length  = 0;
+        h.boxes   = BACKUP_BREAK;
+        h.changed = 0;
+        sha256(h.hash, nullptr, 0);
+        appendDelta(offset, h, {});
     }
-    Archive::copyFile(ARCHIVE, JSON(paths), Archive::sd(), "/3ds/PKSM/backups/" + bankName + ".json.bak");
+
+    extern nlohmann::json g_banks;
+    g_banks[bankName] = restoredBoxes;
+    Banks::saveJson();
+    load(restoredBoxes);
     return true;
 }
 
@@ -307,7 +1639,12 @@ std::string Bank::boxName(int box) const
 
 void Bank::boxName(std::string name, int box)
 {
-    boxNames[box] = name;
+    if (boxNames[box] != name)
+    {
+        boxNames[box] = name;
+        namesDirty    = true;
+        needsCheck    = true;
+    }
 }
 
 void Bank::createJSON()
@@ -315,21 +1652,28 @@ void Bank::createJSON()
     boxNames = nlohmann::json::array();
     for (int i = 0; i < boxes(); i++)
     {
-        boxNames[i] = i18n::localize("STORAGE") + " " + std::to_string(i + 1);
+        boxNames[i] = i18n::localize(StringId::STORAGE) + " " + std::to_string(i + 1);
     }
 }
 
 void Bank::createBank(int maxBoxes)
 {
-    if (data)
-    {
-        delete[] data;
-    }
-    data = new u8[size = sizeof(BankHeader) + sizeof(BankEntry) * maxBoxes * 30];
-    std::copy(BANK_MAGIC.data(), BANK_MAGIC.data() + BANK_MAGIC.size(), data);
-    *(int*)(data + 8)  = BANK_VERSION;
-    *(int*)(data + 12) = maxBoxes;
-    std::fill_n(data + sizeof(BankHeader), sizeof(BankEntry) * boxes() * 30, 0xFF);
+    std::copy(BANK_MAGIC.data(), BANK_MAGIC.data() + BANK_MAGIC.size(), header.MAGIC);
+    header.version = BANK_VERSION;
+    header.boxes   = maxBoxes;
+    pages.clear();
+    pages.resize(maxBoxes);
+    lastUse.assign(maxBoxes, 0);
+    dirty.assign(maxBoxes, 0);
+    dirtyBoxes.clear();
+    savedHash.assign(maxBoxes, 0);
+    unreadable.assign(maxBoxes, false);
+    resident       = 0;
+    fileVersion    = BANK_VERSION;
+    fileBoxes      = 0;
+    fileSize       = 0;
+    fileDataOffset = sizeof(BankHeader);
+    blocks.clear();
 }
 
 bool Bank::hasChanged() const
@@ -338,17 +1682,19 @@ bool Bank::hasChanged() const
     {
         return false;
     }
-    u8 hash[SHA256_BLOCK_SIZE];
-    sha256(hash, data, sizeof(BankHeader) + sizeof(BankEntry) * boxes() * 30);
-    if (memcmp(hash, prevHash.data(), SHA256_BLOCK_SIZE))
+    if (namesDirty)
     {
         return true;
     }
-    std::string jsonData = boxNames.dump(2);
-    sha256(hash, (u8*)jsonData.data(), jsonData.size());
-    if (memcmp(hash, prevNameHash.data(), SHA256_BLOCK_SIZE))
+    // Boxes whose slots were written back to what is already on disk aren't really changed, so they stop being dirty
+    for (auto it = dirtyBoxes.begin(); it != dirtyBoxes.end();)
     {
-        return true;
+        if (hashBox(pages[*it].get(), BOX_SIZE) != savedHash[*it])
+        {
+            return true;
+        }
+        dirty[*it] = 0;
+        it         = dirtyBoxes.erase(it);
     }
     needsCheck = false;
     return false;
@@ -357,7 +1703,7 @@ bool Bank::hasChanged() const
 void Bank::convertFromBankBin()
 {
     bool deleteOld = true;
-    Gui::waitFrame(i18n::localize("BANK_CONVERT"));
+    Gui::waitFrame(i18n::localize(StringId::BANK_CONVERT));
     FSStream stream(Archive::sd(), "/3ds/PKSM/bank/bank.bin", FS_OPEN_READ);
     size_t oldSize = stream.size();
     u8* oldData    = new u8[oldSize];
@@ -367,21 +1713,17 @@ void Bank::convertFromBankBin()
     }
     else
     {
-        Gui::error(i18n::localize("BANK_BAD_CONVERT"), stream.result());
+        Gui::error(i18n::localize(StringId::BANK_BAD_CONVERT), stream.result());
         delete[] oldData;
         stream.close();
         return;
     }
     stream.close();
 
-    data = new u8[size = sizeof(BankHeader) + sizeof(BankEntry) * oldSize / 232];
-    std::copy(BANK_MAGIC.data(), BANK_MAGIC.data() + BANK_MAGIC.size(), data);
-    ((BankHeader*)data)->version = BANK_VERSION;
-    ((BankHeader*)data)->boxes   = oldSize / 232 / 30;
+    createBank(oldSize / 232 / 30);
     extern nlohmann::json g_banks;
-    g_banks["pksm_1"] = ((BankHeader*)data)->boxes;
-    std::fill_n(data + sizeof(BankHeader), sizeof(BankEntry) * boxes() * 30, 0xFF);
-    boxNames = nlohmann::json::array();
+    g_banks["pksm_1"] = boxes();
+    boxNames          = nlohmann::json::array();
 
     for (int box = 0; box < std::min((int)oldSize / (232 * 30), boxes()); box++)
     {
@@ -428,7 +1770,7 @@ void Bank::convertFromBankBin()
 
     for (int i = 0; i < boxes(); i++)
     {
-        boxNames[i] = i18n::localize("STORAGE") + " " + std::to_string(i + 1);
+        boxNames[i] = i18n::localize(StringId::STORAGE) + " " + std::to_string(i + 1);
     }
 
     stream = FSStream(Archive::sd(), "/3ds/PKSM/backups/bank.bin", FS_OPEN_WRITE, oldSize);
@@ -451,7 +1793,7 @@ const std::string& Bank::name() const
 
 int Bank::boxes() const
 {
-    return ((BankHeader*)data)->boxes;
+    return header.boxes;
 }
 
 bool Bank::setName(const std::string& name)
@@ -465,12 +1807,15 @@ bool Bank::setName(const std::string& name)
         bankName = oldName;
         return false;
     }
-    if (R_FAILED(Archive::moveFile(ARCHIVE, JSON(oldPaths), ARCHIVE, JSON(newPaths))))
+    // Only banks that haven't been saved since version 3 have a separate names file
+    // The index can be rebuilt, so failing to move it doesn't matter
+    Archive::moveFile(ARCHIVE, BANK(oldPaths) + ".idx", ARCHIVE, BANK(newPaths) + ".idx");
+    if (fileVersion != BANK_VERSION && R_FAILED(Archive::moveFile(ARCHIVE, JSON(oldPaths), ARCHIVE, JSON(newPaths))))
     {
         bankName = oldName;
         if (R_FAILED(Archive::moveFile(ARCHIVE, BANK(newPaths), ARCHIVE, BANK(oldPaths))))
         {
-            Gui::warn(i18n::localize("CRITICAL_BANK_ERROR_1"), i18n::localize("CRITICAL_BANK_ERROR_2"));
+            Gui::warn(i18n::localize(StringId::CRITICAL_BANK_ERROR_1), i18n::localize(StringId::CRITICAL_BANK_ERROR_2));
             return false;
         }
         return false;
@@ -479,13 +1824,18 @@ bool Bank::setName(const std::string& name)
 }
 
 std::pair<std::string, std::string> Bank::paths() const
+{
+    return paths(bankName);
+}
+
+std::pair<std::string, std::string> Bank::paths(const std::string& name)
 {
     if (Configuration::getInstance().useExtData())
     {
-        return {"/banks/" + bankName + ".bnk", "/banks/" + bankName + ".json"};
+        return {"/banks/" + name + ".bnk", "/banks/" + name + ".json"};
     }
     else
     {
-        return {"/3ds/PKSM/banks/" + bankName + ".bnk", "/3ds/PKSM/banks/" + bankName + ".json"};
+        return {"/3ds/PKSM/banks/" + name + ".bnk", "/3ds/PKSM/banks/" + name + ".json"};
     }
 }
@@ -50,24 +50,24 @@ Configuration::Configuration()
         if (!mJson.is_object())
         {
             loadFromRomfs();
-            Gui::warn(i18n::localize(mJson["language"], "CONFIGURATION_FILE_CORRUPTED_1"),
-                i18n::localize(mJson["language"], "CONFIGURATION_USING_DEFAULT"), mJson["language"]);
+            Gui::warn(i18n::localize(mJson["language"], StringId::CONFIGURATION_FILE_CORRUPTED_1),
+                i18n::localize(mJson["language"], StringId::CONFIGURATION_USING_DEFAULT), mJson["language"]);
             return;
         }
 
         if (!(mJson.contains("version") && mJson["version"].is_number_integer()))
         {
             loadFromRomfs();
-            Gui::warn(i18n::localize(mJson["language"], "CONFIGURATION_INCORRECT_FORMAT"),
-                i18n::localize(mJson["language"], "CONFIGURATION_USING_DEFAULT"), mJson["language"]);
+            Gui::warn(i18n::localize(mJson["language"], StringId::CONFIGURATION_INCORRECT_FORMAT),
+                i18n::localize(mJson["language"], StringId::CONFIGURATION_USING_DEFAULT), mJson["language"]);
             return;
         }
 
         if (!(mJson.contains("language") && mJson["language"].is_number_integer()))
         {
             loadFromRomfs();
-            Gui::warn(i18n::localize(mJson["language"], "CONFIGURATION_INCORRECT_FORMAT"),
-                i18n::localize(mJson["language"], "CONFIGURATION_USING_DEFAULT"), mJson["language"]);
+            Gui::warn(i18n::localize(mJson["language"], StringId::CONFIGURATION_INCORRECT_FORMAT),
+                i18n::localize(mJson["language"], StringId::CONFIGURATION_USING_DEFAULT), mJson["language"]);
             return;
         }
 
@@ -76,7 +76,8 @@ Configuration::Configuration()
             if (mJson["version"].get<int>() > CURRENT_VERSION)
             {
                 loadFromRomfs();
-                Gui::warn(i18n::localize(mJson["language"], "THE_FUCK"), i18n::localize(mJson["language"], "DO_NOT_DOWNGRADE"), mJson["language"]);
+                Gui::warn(i18n::localize(mJson["language"], StringId::THE_FUCK), i18n::localize(mJson["language"], StringId::DO_NOT_DOWNGRADE),
+                    mJson["language"]);
                 return;
             }
             if (mJson["version"].get<int>() < 2)
@@ -94,8 +95,8 @@ Configuration::Configuration()
                 if (!(mJson.contains("defaults") && mJson["defaults"].is_object()))
                 {
                     loadFromRomfs();
-                    Gui::warn(i18n::localize(mJson["language"], "CONFIGURATION_INCORRECT_FORMAT"),
-                        i18n::localize(mJson["language"], "CONFIGURATION_USING_DEFAULT"), mJson["language"]);
+                    Gui::warn(i18n::localize(mJson["language"], StringId::CONFIGURATION_INCORRECT_FORMAT),
+                        i18n::localize(mJson["language"], StringId::CONFIGURATION_USING_DEFAULT), mJson["language"]);
                     return;
                 }
                 mJson["defaults"]["country"] = countryData[3];
@@ -111,8 +112,8 @@ Configuration::Configuration()
                         if (!game.is_object())
                         {
                             loadFromRomfs();
-                            Gui::warn(i18n::localize(mJson["language"], "CONFIGURATION_INCORRECT_FORMAT"),
-                                i18n::localize(mJson["language"], "CONFIGURATION_USING_DEFAULT"), mJson["language"]);
+                            Gui::warn(i18n::localize(mJson["language"], StringId::CONFIGURATION_INCORRECT_FORMAT),
+                                i18n::localize(mJson["language"], StringId::CONFIGURATION_USING_DEFAULT), mJson["language"]);
                             return;
                         }
 
@@ -139,8 +140,8 @@ Configuration::Configuration()
                     !(mJson["defaults"].contains("pid") && mJson["defaults"]["pid"].is_number_integer()))
                 {
                     loadFromRomfs();
-                    Gui::warn(i18n::localize(mJson["language"], "CONFIGURATION_INCORRECT_FORMAT"),
-                        i18n::localize(mJson["language"], "CONFIGURATION_USING_DEFAULT"), mJson["language"]);
+                    Gui::warn(i18n::localize(mJson["language"], StringId::CONFIGURATION_INCORRECT_FORMAT),
+                        i18n::localize(mJson["language"], StringId::CONFIGURATION_USING_DEFAULT), mJson["language"]);
                     return;
                 }
                 mJson["defaults"]["tid"] = mJson["defaults"]["pid"];
@@ -153,6 +154,14 @@ Configuration::Configuration()
                 mJson["alphaChannel"] = false;
                 mJson["autoUpdate"]   = true;
             }
+            if (mJson["version"].get<int>() < 9)
+            {
+                mJson["bankMemory"] = 1024;
+            }
+            if (mJson["version"].get<int>() < 10)
+            {
+                mJson["giftMemory"] = 256;
+            }
 
             mJson["version"] = CURRENT_VERSION;
             save();
@@ -174,6 +183,8 @@ Configuration::Configuration()
             !(mJson.contains("patronCode") && mJson["patronCode"].is_string()) ||
             !(mJson.contains("alphaChannel") && mJson["alphaChannel"].is_boolean()) ||
             !(mJson.contains("autoUpdate") && mJson["autoUpdate"].is_boolean()) ||
+            !(mJson.contains("bankMemory") && mJson["bankMemory"].is_number_integer()) ||
+            !(mJson.contains("giftMemory") && mJson["giftMemory"].is_number_integer()) ||
             !(mJson["defaults"].contains("tid") && mJson["defaults"]["tid"].is_number_integer()) ||
             !(mJson["defaults"].contains("sid") && mJson["defaults"]["sid"].is_number_integer()) ||
             !(mJson["defaults"].contains("ot") && mJson["defaults"]["ot"].is_string()) ||
@@ -187,8 +198,8 @@ Configuration::Configuration()
         // clang-format on
         {
             loadFromRomfs();
-            Gui::warn(i18n::localize(mJson["language"], "CONFIGURATION_INCORRECT_FORMAT"),
-                i18n::localize(mJson["language"], "CONFIGURATION_USING_DEFAULT"), mJson["language"]);
+            Gui::warn(i18n::localize(mJson["language"], StringId::CONFIGURATION_INCORRECT_FORMAT),
+                i18n::localize(mJson["language"], StringId::CONFIGURATION_USING_DEFAULT), mJson["language"]);
             return;
         }
 
@@ -201,8 +212,8 @@ Configuration::Configuration()
                     if (!save.is_string())
                     {
                         loadFromRomfs();
-                        Gui::warn(i18n::localize(mJson["language"], "CONFIGURATION_INCORRECT_FORMAT"),
-                            i18n::localize(mJson["language"], "CONFIGURATION_USING_DEFAULT"), mJson["language"]);
+                        Gui::warn(i18n::localize(mJson["language"], StringId::CONFIGURATION_INCORRECT_FORMAT),
+                            i18n::localize(mJson["language"], StringId::CONFIGURATION_USING_DEFAULT), mJson["language"]);
                         return;
                     }
                 }
@@ -210,8 +221,8 @@ Configuration::Configuration()
             else
             {
                 loadFromRomfs();
-                Gui::warn(i18n::localize(mJson["language"], "CONFIGURATION_INCORRECT_FORMAT"),
-                    i18n::localize(mJson["language"], "CONFIGURATION_USING_DEFAULT"), mJson["language"]);
+                Gui::warn(i18n::localize(mJson["language"], StringId::CONFIGURATION_INCORRECT_FORMAT),
+                    i18n::localize(mJson["language"], StringId::CONFIGURATION_USING_DEFAULT), mJson["language"]);
                 return;
             }
         }
@@ -31,9 +31,11 @@
 #include "archive.hpp"
 #include "banks.hpp"
 #include "fetch.hpp"
+#include "fetchmulti.hpp"
 #include "gui.hpp"
 #include "i18n.hpp"
 #include "loader.hpp"
+#include "mysterygift.hpp"
 #include "random.hpp"
 #include "revision.h"
 #include "sha256.h"
@@ -84,7 +86,9 @@ static Result downloadAdditionalAssets(void)
             {0xea, 0x7f, 0x92, 0x86, 0x0a, 0x9b, 0x4d, 0x50, 0x3a, 0x0c, 0x2a, 0x6e, 0x48, 0x60, 0xfb, 0x93, 0x1f, 0xd3, 0xd7, 0x7d, 0x6a, 0xbb, 0x1d,
                 0xdb, 0xac, 0x59, 0xeb, 0xf1, 0x66, 0x34, 0xa4, 0x91}}};
 
-    for (auto item : assets)
+    // The assets are fetched alongside each other, and all of them are waited for so none is left half written on return
+    std::vector<std::pair<asset*, std::shared_ptr<FetchMulti::Request>>> downloads;
+    for (auto& item : assets)
     {
         bool downloadAsset = true;
         if (io::exists(item.path))
@@ -104,15 +108,34 @@ static Result downloadAdditionalAssets(void)
             u32 status;
             ACU_GetWifiStatus(&status);
             if (status == 0)
-                return -1;
+            {
+                res = -1;
+                break;
+            }
 #endif
-            Result res1 = Fetch::download(item.url, item.path);
-            if (R_FAILED(res1))
-                return res1;
-            if (!matchSha256HashFromFile(item.path, item.hash))
+            auto request = FetchMulti::download(item.url, item.path);
+            if (!request)
             {
-                std::remove(item.path.c_str());
-                return -1;
+                res = -1;
+                break;
+            }
+            downloads.emplace_back(&item, request);
+        }
+    }
+
+    for (auto& download : downloads)
+    {
+        CURLcode cres = download.second->wait();
+        if (R_SUCCEEDED(res))
+        {
+            if (cres != CURLE_OK)
+            {
+                res = -cres;
+            }
+            else if (!matchSha256HashFromFile(download.first->path, download.first->hash))
+            {
+                std::remove(download.first->path.c_str());
+                res = -1;
             }
         }
     }
@@ -178,11 +201,11 @@ static bool update(std::string execPath)
     {
         if (auto fetch = Fetch::init("https://flagbrew.org/patron/updateCheck", true, true, &retString, nullptr, "code=" + patronCode))
         {
-            Gui::waitFrame(i18n::localize("UPDATE_CHECKING"));
+            Gui::waitFrame(i18n::localize(StringId::UPDATE_CHECKING));
             CURLcode res = fetch->perform();
             if (res != CURLE_OK)
             {
-                Gui::error(i18n::localize("CURL_ERROR"), abs(res));
+                Gui::error(i18n::localize(StringId::CURL_ERROR), abs(res));
             }
             else
             {
@@ -207,13 +230,13 @@ static bool update(std::string execPath)
                         }
                         break;
                     case 401:
-                        Gui::warn(i18n::localize("NOT_PATRON"), i18n::localize("INCIDENT_LOGGED"));
+                        Gui::warn(i18n::localize(StringId::NOT_PATRON), i18n::localize(StringId::INCIDENT_LOGGED));
                         break;
                     case 502:
-                        Gui::error(i18n::localize("HTTP_OFFLINE"), status_code);
+                        Gui::error(i18n::localize(StringId::HTTP_OFFLINE), status_code);
                         break;
                     default:
-                        Gui::error(i18n::localize("HTTP_UNKNOWN_ERROR"), status_code);
+                        Gui::error(i18n::localize(StringId::HTTP_UNKNOWN_ERROR), status_code);
                         break;
                 }
             }
@@ -221,11 +244,11 @@ static bool update(std::string execPath)
     }
     else if (auto fetch = Fetch::init("https://api.github.com/repos/FlagBrew/PKSM/releases/latest", false, true, &retString, nullptr, ""))
     {
-        Gui::waitFrame(i18n::localize("UPDATE_CHECKING"));
+        Gui::waitFrame(i18n::localize(StringId::UPDATE_CHECKING));
         CURLcode res = fetch->perform();
         if (res != CURLE_OK)
         {
-            Gui::error(i18n::localize("CURL_ERROR"), abs(res));
+            Gui::error(i18n::localize(StringId::CURL_ERROR), abs(res));
         }
         else
         {
@@ -238,7 +261,7 @@ static bool update(std::string execPath)
                     nlohmann::json retJson = nlohmann::json::parse(retString, nullptr, false);
                     if (retJson.is_discarded())
                     {
-                        Gui::warn(i18n::localize("UPDATE_CHECK_ERROR_BAD_JSON_1"), i18n::localize("UPDATE_CHECK_ERROR_BAD_JSON_2"));
+                        Gui::warn(i18n::localize(StringId::UPDATE_CHECK_ERROR_BAD_JSON_1), i18n::localize(StringId::UPDATE_CHECK_ERROR_BAD_JSON_2));
                     }
                     else if (retJson["tag_name"].get<std::string>() > StringUtils::format("%d.%d.%d", VERSION_MAJOR, VERSION_MINOR, VERSION_MICRO))
                     {
@@ -257,28 +280,28 @@ static bool update(std::string execPath)
                     break;
                 }
                 case 502:
-                    Gui::error(i18n::localize("HTTP_OFFLINE"), status_code);
+                    Gui::error(i18n::localize(StringId::HTTP_OFFLINE), status_code);
                     break;
                 default:
-                    Gui::error(i18n::localize("HTTP_UNKNOWN_ERROR"), status_code);
+                    Gui::error(i18n::localize(StringId::HTTP_UNKNOWN_ERROR), status_code);
                     break;
             }
         }
     }
     if (!url.empty())
     {
-        Gui::waitFrame(i18n::localize("UPDATE_FOUND"));
+        Gui::waitFrame(i18n::localize(StringId::UPDATE_FOUND));
         std::string fileName = path.substr(path.find_last_of('/') + 1);
         Result res =
             Fetch::download(url, path, Configuration::getInstance().alphaChannel() ? "code=" + patronCode : "", progress_callback, &fileName);
         if (R_FAILED(res))
         {
-            Gui::error(i18n::localize("UPDATE_FOUND_BUT_FAILED_DOWNLOAD"), res);
+            Gui::error(i18n::localize(StringId::UPDATE_FOUND_BUT_FAILED_DOWNLOAD), res);
             Archive::deleteFile(Archive::sd(), path);
             return false;
         }
 
-        Gui::waitFrame(i18n::localize("UPDATE_INSTALLING"));
+        Gui::waitFrame(i18n::localize(StringId::UPDATE_INSTALLING));
         if (execPath != "")
         {
             Archive::deleteFile(Archive::sd(), execPath);
@@ -295,14 +318,14 @@ static bool update(std::string execPath)
             {
                 if (R_FAILED(res = AM_GetCiaFileInfo(MEDIATYPE_SD, &title, ciaFile.getRawHandle())))
                 {
-                    Gui::error(i18n::localize("BAD_CIA_FILE"), res);
+                    Gui::error(i18n::localize(StringId::BAD_CIA_FILE), res);
                     ciaFile.close();
                     return false;
                 }
 
                 if (R_FAILED(res = AM_StartCiaInstall(MEDIATYPE_SD, &dstHandle)))
                 {
-                    Gui::error(i18n::localize("CIA_INSTALL_START_FAIL"), res);
+                    Gui::error(i18n::localize(StringId::CIA_INSTALL_START_FAIL), res);
                     ciaFile.close();
                     return false;
                 }
@@ -318,7 +341,7 @@ static bool update(std::string execPath)
                     bytesRead = ciaFile.read(buf, 0x1000);
                     if (R_FAILED(ciaFile.result()))
                     {
-                        Gui::error(i18n::localize("CIA_UPDATE_READ_FAIL"), ciaFile.result());
+                        Gui::error(i18n::localize(StringId::CIA_UPDATE_READ_FAIL), ciaFile.result());
                         ciaFile.close();
                         FSFILE_Close(dstHandle);
                         return false;
@@ -326,7 +349,7 @@ static bool update(std::string execPath)
 
                     if (R_FAILED(res = FSFILE_Write(dstHandle, &bytesWritten, offset, buf, bytesRead, FS_WRITE_FLUSH)))
                     {
-                        Gui::error(i18n::localize("CIA_UPDATE_WRITE_FAIL"), res);
+                        Gui::error(i18n::localize(StringId::CIA_UPDATE_WRITE_FAIL), res);
                         ciaFile.close();
                         FSFILE_Close(dstHandle);
                         return false;
@@ -350,7 +373,7 @@ static bool update(std::string execPath)
 
                 if (R_FAILED(res = AM_FinishCiaInstall(dstHandle)))
                 {
-                    Gui::error(i18n::localize("CIA_INSTALL_FINISH_FAIL"), res);
+                    Gui::error(i18n::localize(StringId::CIA_INSTALL_FINISH_FAIL), res);
                     ciaFile.close();
                     return false;
                 }
@@ -411,6 +434,8 @@ Result App::init(const std::string& execPath)
     {
         return consoleDisplayError("socInit failed.", -1);
     }
+    if (R_FAILED(res = FetchMulti::init()))
+        return consoleDisplayError("FetchMulti::init failed.", res);
 
     if (R_FAILED(res = downloadAdditionalAssets()))
         return consoleDisplayError(
@@ -443,7 +468,7 @@ Result App::init(const std::string& execPath)
         }
         if (R_FAILED(res))
         {
-            Gui::warn(i18n::localize("UPDATE_SUCCESS_1"), i18n::localize("UPDATE_SUCCESS_2"));
+            Gui::warn(i18n::localize(StringId::UPDATE_SUCCESS_1), i18n::localize(StringId::UPDATE_SUCCESS_2));
         }
         return -1;
     }
@@ -466,7 +491,10 @@ Result App::exit(void)
 {
     svcCloseHandle(hbldrHandle);
     TitleLoader::exit();
+    MysteryGift::exit();
     Gui::exit();
+    FetchMulti::exit();
+    Fetch::exit();
     socExit();
     acExit();
     Threads::destroy();
@@ -28,6 +28,7 @@
 #include "FSStream.hpp"
 #include "archive.hpp"
 #include "json.hpp"
+#include <atomic>
 
 nlohmann::json g_banks;
 
@@ -114,6 +115,9 @@ bool Banks::loadBank(const std::string& name, const std::optional<int>& maxBoxes
     return false;
 }
 
+// Bank::backup's copy and delta log, and the names file of banks from before version 3, plus the previous generation of each
+static constexpr std::string_view backupSuffixes[] = {".bnk.bak", ".bnk.delta", ".json.bak", ".bnk.bak.old", ".bnk.delta.old", ".json.bak.old"};
+
 void Banks::removeBank(const std::string& name)
 {
     if (g_banks.size() == 1)
@@ -136,6 +140,16 @@ void Banks::removeBank(const std::string& name)
         remove(("/3ds/PKSM/banks/" + name + ".json").c_str());
         Archive::deleteFile(Archive::data(), "/banks/" + name + ".bnk");
         Archive::deleteFile(Archive::data(), "/banks/" + name + ".json");
+        // A journal left behind by an interrupted save must not be replayed onto a new bank with the same name
+        remove(("/3ds/PKSM/banks/" + name + ".bnk.journal").c_str());
+        Archive::deleteFile(Archive::data(), "/banks/" + name + ".bnk.journal");
+        remove(("/3ds/PKSM/banks/" + name + ".bnk.idx").c_str());
+        Archive::deleteFile(Archive::data(), "/banks/" + name + ".bnk.idx");
+        // Nor may new deltas be logged against this bank's backup
+        for (auto suffix : backupSuffixes)
+        {
+            Archive::deleteFile(Archive::sd(), "/3ds/PKSM/backups/" + name + std::string(suffix));
+        }
         for (auto i = g_banks.begin(); i != g_banks.end(); i++)
         {
             if (i.key() == name)
@@ -175,6 +189,13 @@ void Banks::renameBank(const std::string& oldName, const std::string& newName)
             Archive::moveFile(Archive::data(), "/banks/" + oldName + ".json", Archive::data(), "/banks/" + newName + ".json");
             Archive::moveFile(Archive::sd(), "/3ds/PKSM/banks/" + oldName + ".bnk", Archive::sd(), "/3ds/PKSM/banks/" + newName + ".bnk");
             Archive::moveFile(Archive::sd(), "/3ds/PKSM/banks/" + oldName + ".json", Archive::sd(), "/3ds/PKSM/banks/" + newName + ".json");
+            Archive::moveFile(Archive::data(), "/banks/" + oldName + ".bnk.idx", Archive::data(), "/banks/" + newName + ".bnk.idx");
+            Archive::moveFile(Archive::sd(), "/3ds/PKSM/banks/" + oldName + ".bnk.idx", Archive::sd(), "/3ds/PKSM/banks/" + newName + ".bnk.idx");
+        }
+        for (auto suffix : backupSuffixes)
+        {
+            Archive::moveFile(Archive::sd(), "/3ds/PKSM/backups/" + oldName + std::string(suffix), Archive::sd(),
+                "/3ds/PKSM/backups/" + newName + std::string(suffix));
         }
         g_banks[newName] = g_banks[oldName];
         g_banks.erase(oldName);
@@ -214,3 +235,169 @@ Result Banks::swapSD(bool toSD)
     }
     return res;
 }
+
+static bool searchIndex(const std::string& name, int boxes, const BankIndex::Query& query, std::vector<BankIndex::Match>& out)
+{
+    std::string path = Configuration::getInstance().useExtData() ? "/banks/" + name + ".bnk.idx" : "/3ds/PKSM/banks/" + name + ".bnk.idx";
+    FSStream in(Configuration::getInstance().useExtData() ? Archive::data() : Archive::sd(), path, FS_OPEN_READ);
+    BankIndex::Header h;
+    if (!in.good() || in.read(&h, sizeof(h)) != sizeof(h) || memcmp(h.MAGIC, BankIndex::MAGIC.data(), BankIndex::MAGIC.size()) ||
+        h.version != BankIndex::VERSION || (int)h.boxes != boxes || h.stale || in.size() != sizeof(h) + boxes * 30 * sizeof(BankIndex::Entry))
+    {
+        in.close();
+        return false;
+    }
+    BankIndex::Entry entries[30];
+    for (int box = 0; box < boxes; box++)
+    {
+        if (in.read(entries, sizeof(entries)) != sizeof(entries))
+        {
+            break;
+        }
+        for (int slot = 0; slot < 30; slot++)
+        {
+            if (query.matches(entries[slot]))
+            {
+                out.push_back({name, box, slot, entries[slot]});
+            }
+        }
+    }
+    in.close();
+    return true;
+}
+
+std::vector<BankIndex::Match> Banks::search(const BankIndex::Query& query)
+{
+    std::vector<BankIndex::Match> ret;
+    for (auto& [name, boxes] : bankNames())
+    {
+        if (!searchIndex(name, boxes, query, ret))
+        {
+            // Banks that haven't been opened since indexes were added have to be read once to build theirs. The loaded bank
+            // may have unsaved changes, but its index reflects the file just the same
+            if (Bank::buildIndex(name))
+            {
+                searchIndex(name, boxes, query, ret);
+            }
+        }
+    }
+    return ret;
+}
+
+namespace
+{
+    struct ScanState
+    {
+        const PKFilter* query;
+        const std::function<void(const Banks::SlotRef&, std::shared_ptr<PKX>)>* executor;
+        std::vector<std::pair<std::string, int>> banks;
+        std::vector<std::vector<Banks::SlotRef>> results;
+        // Index of the bank that is already loaded, which is scanned by the calling thread instead
+        size_t skip;
+        std::atomic<size_t> next;
+        LightLock executorLock;
+    };
+
+    void scanWorker(ScanState* state)
+    {
+        // Indexed by Generation, compiled on first use
+        std::array<std::optional<PKFilter::Compiled>, 5> compiled;
+        size_t i;
+        while ((i = state->next++) < state->banks.size())
+        {
+            if (i == state->skip)
+            {
+                continue;
+            }
+            const std::string& name = state->banks[i].first;
+            Bank::forEachEntry(name, [&](int box, int slot, Generation gen, const u8* data) {
+                if ((size_t)gen >= compiled.size())
+                {
+                    return;
+                }
+                if (!compiled[(size_t)gen])
+                {
+                    compiled[(size_t)gen] = state->query->compile(gen);
+                }
+                if ((*compiled[(size_t)gen])(data))
+                {
+                    state->results[i].push_back({name, box, slot});
+                    if (*state->executor)
+                    {
+                        auto pkm = Bank::entryPkm(gen, data);
+                        LightLock_Lock(&state->executorLock);
+                        (*state->executor)(state->results[i].back(), pkm);
+                        LightLock_Unlock(&state->executorLock);
+                    }
+                }
+            });
+        }
+    }
+}
+
+std::vector<Banks::SlotRef> Banks::forEachSlot(
+    const PKFilter& query, const std::function<void(const SlotRef&, std::shared_ptr<PKX>)>& executor, int workers)
+{
+    ScanState state;
+    state.query    = &query;
+    state.executor = &executor;
+    state.banks    = bankNames();
+    state.results.resize(state.banks.size());
+    state.skip = state.banks.size();
+    state.next = 0;
+    LightLock_Init(&state.executorLock);
+    for (size_t i = 0; bank && i < state.banks.size(); i++)
+    {
+        if (state.banks[i].first == bank->name())
+        {
+            state.skip = i;
+            break;
+        }
+    }
+
+    s32 prio = 0;
+    svcGetThreadPriority(&prio, CUR_THREAD_HANDLE);
+    std::vector<Thread> threads;
+    for (int i = 0; i < workers; i++)
+    {
+        Thread thread = threadCreate((ThreadFunc)scanWorker, &state, 0x8000, prio + 1, -2, false);
+        if (thread)
+        {
+            threads.push_back(thread);
+        }
+    }
+
+    if (state.skip < state.banks.size())
+    {
+        std::vector<bool> matches = bank->filterBoxes(query);
+        for (size_t i = 0; i < matches.size(); i++)
+        {
+            if (matches[i])
+            {
+                state.results[state.skip].push_back({bank->name(), int(i / 30), int(i % 30)});
+                if (executor)
+                {
+                    auto pkm = bank->pkm(i / 30, i % 30);
+                    LightLock_Lock(&state.executorLock);
+                    executor(state.results[state.skip].back(), pkm);
+                    LightLock_Unlock(&state.executorLock);
+                }
+            }
+        }
+    }
+
+    // Also covers the case where no thread could be created
+    scanWorker(&state);
+    for (auto& thread : threads)
+    {
+        threadJoin(thread, U64_MAX);
+        threadFree(thread);
+    }
+
+    std::vector<SlotRef> ret;
+    for (auto& result : state.results)
+    {
+        ret.insert(ret.end(), std::make_move_iterator(result.begin()), std::make_move_iterator(result.end()));
+    }
+    return ret;
+}
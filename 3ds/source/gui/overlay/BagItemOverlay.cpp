@@ -77,13 +77,12 @@ void BagItemOverlay::update(touchPosition* touch)
 
     if (!searchString.empty() && searchString != oldSearchString)
     {
+        std::vector<u16> matches = i18n::searchIndex(Configuration::getInstance().language(), SearchCategory::ITEMS).prefix(searchString);
         items.clear();
         items.emplace_back(validItems[0]);
         for (size_t i = 1; i < validItems.size(); i++)
         {
-            std::string itemName = validItems[i].first->substr(0, searchString.size());
-            StringUtils::toLower(itemName);
-            if (itemName == searchString)
+            if (std::binary_search(matches.begin(), matches.end(), validItems[i].second))
             {
                 items.emplace_back(validItems[i]);
             }
@@ -139,7 +138,7 @@ void BagItemOverlay::searchBar()
 {
     SwkbdState state;
     swkbdInit(&state, SWKBD_TYPE_NORMAL, 2, 20);
-    swkbdSetHintText(&state, i18n::localize("ITEM").c_str());
+    swkbdSetHintText(&state, i18n::localize(StringId::ITEM).c_str());
     swkbdSetValidation(&state, SWKBD_ANYTHING, 0, 0);
     char input[25]  = {0};
     SwkbdButton ret = swkbdInputText(&state, input, sizeof(input));
@@ -147,6 +146,5 @@ void BagItemOverlay::searchBar()
     if (ret == SWKBD_BUTTON_CONFIRM)
     {
         searchString = input;
-        StringUtils::toLower(searchString);
     }
 }
@@ -51,8 +51,8 @@ CloudOverlay::CloudOverlay(ReplaceableScreen& screen, CloudAccess& acc) : Replac
             access.sortDir(!access.sortAscending());
             return access.sortAscending();
         },
-        ui_sheet_button_editor_idx, i18n::localize("ASCENDING"), FONT_SIZE_12, COLOR_BLACK, ui_sheet_button_editor_idx, i18n::localize("DESCENDING"),
-        FONT_SIZE_12, COLOR_BLACK, nullptr, true);
+        ui_sheet_button_editor_idx, i18n::localize(StringId::ASCENDING), FONT_SIZE_12, COLOR_BLACK, ui_sheet_button_editor_idx,
+        i18n::localize(StringId::DESCENDING), FONT_SIZE_12, COLOR_BLACK, nullptr, true);
     tbutton->setState(access.sortAscending());
     buttons.push_back(std::move(tbutton));
     tbutton = std::make_unique<ToggleButton>(106, 144, 108, 28,
@@ -60,8 +60,8 @@ CloudOverlay::CloudOverlay(ReplaceableScreen& screen, CloudAccess& acc) : Replac
             access.filterLegal(!access.filterLegal());
             return access.sortAscending();
         },
-        ui_sheet_button_editor_idx, i18n::localize("LEGALITY_LEGAL"), FONT_SIZE_12, COLOR_BLACK, ui_sheet_button_editor_idx,
-        i18n::localize("LEGALITY_ANY"), FONT_SIZE_12, COLOR_BLACK, nullptr, true);
+        ui_sheet_button_editor_idx, i18n::localize(StringId::LEGALITY_LEGAL), FONT_SIZE_12, COLOR_BLACK, ui_sheet_button_editor_idx,
+        i18n::localize(StringId::LEGALITY_ANY), FONT_SIZE_12, COLOR_BLACK, nullptr, true);
     tbutton->setState(access.filterLegal());
     buttons.push_back(std::move(tbutton));
     buttons.push_back(std::make_unique<ClickButton>(283, 211, 34, 28,
@@ -99,7 +99,7 @@ void CloudOverlay::drawBottom() const
     {
         button->draw();
     }
-    Gui::text(i18n::localize("CLOUD_SORT_FILTER"), 25, 5, FONT_SIZE_12, FONT_SIZE_12, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
+    Gui::text(i18n::localize(StringId::CLOUD_SORT_FILTER), 25, 5, FONT_SIZE_12, FONT_SIZE_12, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
     Gui::text(i18n::localize(sortTypeToString(access.sortType())), 160, 96, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK, TextPosX::CENTER,
         TextPosY::CENTER, 108);
 }
@@ -29,12 +29,15 @@
 #include "gui.hpp"
 
 ConfigCountryOverlay::ConfigCountryOverlay(ReplaceableScreen& screen)
-    : ReplaceableScreen(&screen, i18n::localize("A_SELECT") + '\n' + i18n::localize("B_BACK")),
+    : ReplaceableScreen(&screen, i18n::localize(StringId::A_SELECT) + '\n' + i18n::localize(StringId::B_BACK)),
       hid(40, 2),
-      validCountries(i18n::rawCountries(Configuration::getInstance().language())),
-      countries(validCountries)
+      validCountries(i18n::rawCountries(Configuration::getInstance().language()))
 {
-    instructions.addBox(false, 75, 30, 170, 23, COLOR_GREY, i18n::localize("SEARCH"), COLOR_WHITE);
+    for (size_t i = 0; i < validCountries.size(); i++)
+    {
+        countries.push_back(i);
+    }
+    instructions.addBox(false, 75, 30, 170, 23, COLOR_GREY, i18n::localize(StringId::SEARCH), COLOR_WHITE);
     searchButton = std::make_unique<ClickButton>(75, 30, 170, 23,
         [this]() {
             searchBar();
@@ -42,15 +45,13 @@ ConfigCountryOverlay::ConfigCountryOverlay(ReplaceableScreen& screen)
         },
         ui_sheet_emulated_box_search_idx, "", 0, 0);
     hid.update(countries.size());
-    hid.select(std::distance(countries.begin(), std::find_if(countries.begin(), countries.end(), [](const std::pair<u16, std::string>& pair) {
-        return pair.first == Configuration::getInstance().defaultCountry();
-    })));
+    hid.select(validCountries.indexOf(Configuration::getInstance().defaultCountry()));
 }
 
 void ConfigCountryOverlay::drawBottom() const
 {
     dim();
-    Gui::text(i18n::localize("EDITOR_INST"), 160, 115, FONT_SIZE_18, FONT_SIZE_18, COLOR_WHITE, TextPosX::CENTER, TextPosY::TOP);
+    Gui::text(i18n::localize(StringId::EDITOR_INST), 160, 115, FONT_SIZE_18, FONT_SIZE_18, COLOR_WHITE, TextPosX::CENTER, TextPosY::TOP);
     searchButton->draw();
     Gui::sprite(ui_sheet_icon_search_idx, 79, 33);
     Gui::text(searchString, 95, 32, FONT_SIZE_12, FONT_SIZE_12, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
@@ -66,20 +67,14 @@ void ConfigCountryOverlay::drawTop() const
     Gui::drawSolidRect(x, y, 1, 11, COLOR_YELLOW);
     Gui::drawSolidRect(x, y + 10, 198, 1, COLOR_YELLOW);
     Gui::drawSolidRect(x + 197, y, 1, 11, COLOR_YELLOW);
-    // Stupid non random-access iterators
-    std::map<u8, std::string>::const_iterator locIt = countries.begin();
-    for (size_t i = 0; i < hid.page() * hid.maxVisibleEntries(); i++)
-    {
-        locIt++;
-    }
     for (size_t i = 0; i < hid.maxVisibleEntries(); i++)
     {
         x = i < hid.maxVisibleEntries() / 2 ? 4 : 203;
         if (hid.page() * hid.maxVisibleEntries() + i < countries.size())
         {
-            Gui::text(std::to_string(locIt->first) + " - " + locIt->second, x, (i % (hid.maxVisibleEntries() / 2)) * 12, FONT_SIZE_9, FONT_SIZE_9,
-                COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
-            locIt++;
+            size_t entry = countries[hid.page() * hid.maxVisibleEntries() + i];
+            Gui::text(std::to_string(validCountries.id(entry)) + " - " + validCountries.name(entry), x,
+                (i % (hid.maxVisibleEntries() / 2)) * 12, FONT_SIZE_9, FONT_SIZE_9, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
         }
         else
         {
@@ -108,20 +103,24 @@ void ConfigCountryOverlay::update(touchPosition* touch)
     if (!searchString.empty() && searchString != oldSearchString)
     {
         countries.clear();
-        for (auto i = validCountries.begin(); i != validCountries.end(); i++)
+        for (size_t i = 0; i < validCountries.size(); i++)
         {
-            std::string locName = i->second.substr(0, searchString.size());
+            std::string locName = validCountries.name(i).substr(0, searchString.size());
             StringUtils::toLower(locName);
             if (locName == searchString)
             {
-                countries.emplace(*i);
+                countries.push_back(i);
             }
         }
         oldSearchString = searchString;
     }
     else if (searchString.empty() && !oldSearchString.empty())
     {
-        countries       = validCountries;
+        countries.clear();
+        for (size_t i = 0; i < validCountries.size(); i++)
+        {
+            countries.push_back(i);
+        }
         oldSearchString = searchString = "";
     }
     if (hid.fullIndex() >= countries.size())
@@ -135,12 +134,7 @@ void ConfigCountryOverlay::update(touchPosition* touch)
     {
         if (countries.size() > 0)
         {
-            auto locIt = countries.begin();
-            for (size_t i = 0; i < hid.fullIndex(); i++)
-            {
-                locIt++;
-            }
-            Configuration::getInstance().defaultCountry(locIt->first);
+            Configuration::getInstance().defaultCountry(validCountries.id(countries[hid.fullIndex()]));
         }
         parent->removeOverlay();
         return;
@@ -156,7 +150,7 @@ void ConfigCountryOverlay::searchBar()
 {
     SwkbdState state;
     swkbdInit(&state, SWKBD_TYPE_NORMAL, 2, 20);
-    swkbdSetHintText(&state, i18n::localize("COUNTRY").c_str());
+    swkbdSetHintText(&state, i18n::localize(StringId::COUNTRY).c_str());
     swkbdSetValidation(&state, SWKBD_ANYTHING, 0, 0);
     char input[25]  = {0};
     SwkbdButton ret = swkbdInputText(&state, input, sizeof(input));
@@ -29,12 +29,15 @@
 #include "gui.hpp"
 
 ConfigSubRegionOverlay::ConfigSubRegionOverlay(ReplaceableScreen& screen)
-    : ReplaceableScreen(&screen, i18n::localize("A_SELECT") + '\n' + i18n::localize("B_BACK")),
+    : ReplaceableScreen(&screen, i18n::localize(StringId::A_SELECT) + '\n' + i18n::localize(StringId::B_BACK)),
       hid(40, 2),
-      validSubRegions(i18n::rawSubregions(Configuration::getInstance().language(), Configuration::getInstance().defaultCountry())),
-      subregions(validSubRegions)
+      validSubRegions(i18n::rawSubregions(Configuration::getInstance().language(), Configuration::getInstance().defaultCountry()))
 {
-    instructions.addBox(false, 75, 30, 170, 23, COLOR_GREY, i18n::localize("SEARCH"), COLOR_WHITE);
+    for (size_t i = 0; i < validSubRegions.size(); i++)
+    {
+        subregions.push_back(i);
+    }
+    instructions.addBox(false, 75, 30, 170, 23, COLOR_GREY, i18n::localize(StringId::SEARCH), COLOR_WHITE);
     searchButton = std::make_unique<ClickButton>(75, 30, 170, 23,
         [this]() {
             searchBar();
@@ -42,15 +45,13 @@ ConfigSubRegionOverlay::ConfigSubRegionOverlay(ReplaceableScreen& screen)
         },
         ui_sheet_emulated_box_search_idx, "", 0, 0);
     hid.update(subregions.size());
-    hid.select(std::distance(subregions.begin(), std::find_if(subregions.begin(), subregions.end(), [](const std::pair<u16, std::string>& pair) {
-        return pair.first == Configuration::getInstance().defaultRegion();
-    })));
+    hid.select(validSubRegions.indexOf(Configuration::getInstance().defaultRegion()));
 }
 
 void ConfigSubRegionOverlay::drawBottom() const
 {
     dim();
-    Gui::text(i18n::localize("EDITOR_INST"), 160, 115, FONT_SIZE_18, FONT_SIZE_18, COLOR_WHITE, TextPosX::CENTER, TextPosY::TOP);
+    Gui::text(i18n::localize(StringId::EDITOR_INST), 160, 115, FONT_SIZE_18, FONT_SIZE_18, COLOR_WHITE, TextPosX::CENTER, TextPosY::TOP);
     searchButton->draw();
     Gui::sprite(ui_sheet_icon_search_idx, 79, 33);
     Gui::text(searchString, 95, 32, FONT_SIZE_12, FONT_SIZE_12, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
@@ -66,20 +67,14 @@ void ConfigSubRegionOverlay::drawTop() const
     Gui::drawSolidRect(x, y, 1, 11, COLOR_YELLOW);
     Gui::drawSolidRect(x, y + 10, 198, 1, COLOR_YELLOW);
     Gui::drawSolidRect(x + 197, y, 1, 11, COLOR_YELLOW);
-    // Stupid non random-access iterators
-    std::map<u8, std::string>::const_iterator locIt = subregions.begin();
-    for (size_t i = 0; i < hid.page() * hid.maxVisibleEntries(); i++)
-    {
-        locIt++;
-    }
     for (size_t i = 0; i < hid.maxVisibleEntries(); i++)
     {
         x = i < hid.maxVisibleEntries() / 2 ? 4 : 203;
         if (hid.page() * hid.maxVisibleEntries() + i < subregions.size())
         {
-            Gui::text(std::to_string(locIt->first) + " - " + locIt->second, x, (i % (hid.maxVisibleEntries() / 2)) * 12, FONT_SIZE_9, FONT_SIZE_9,
-                COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
-            locIt++;
+            size_t entry = subregions[hid.page() * hid.maxVisibleEntries() + i];
+            Gui::text(std::to_string(validSubRegions.id(entry)) + " - " + validSubRegions.name(entry), x,
+                (i % (hid.maxVisibleEntries() / 2)) * 12, FONT_SIZE_9, FONT_SIZE_9, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
         }
         else
         {
@@ -108,20 +103,24 @@ void ConfigSubRegionOverlay::update(touchPosition* touch)
     if (!searchString.empty() && searchString != oldSearchString)
     {
         subregions.clear();
-        for (auto i = validSubRegions.begin(); i != validSubRegions.end(); i++)
+        for (size_t i = 0; i < validSubRegions.size(); i++)
         {
-            std::string locName = i->second.substr(0, searchString.size());
+            std::string locName = validSubRegions.name(i).substr(0, searchString.size());
             StringUtils::toLower(locName);
             if (locName == searchString)
             {
-                subregions.emplace(*i);
+                subregions.push_back(i);
             }
         }
         oldSearchString = searchString;
     }
     else if (searchString.empty() && !oldSearchString.empty())
     {
-        subregions      = validSubRegions;
+        subregions.clear();
+        for (size_t i = 0; i < validSubRegions.size(); i++)
+        {
+            subregions.push_back(i);
+        }
         oldSearchString = searchString = "";
     }
     if (hid.fullIndex() >= subregions.size())
@@ -135,12 +134,7 @@ void ConfigSubRegionOverlay::update(touchPosition* touch)
     {
         if (subregions.size() > 0)
         {
-            auto locIt = subregions.begin();
-            for (size_t i = 0; i < hid.fullIndex(); i++)
-            {
-                locIt++;
-            }
-            Configuration::getInstance().defaultRegion(locIt->first);
+            Configuration::getInstance().defaultRegion(validSubRegions.id(subregions[hid.fullIndex()]));
         }
         parent->removeOverlay();
         return;
@@ -156,7 +150,7 @@ void ConfigSubRegionOverlay::searchBar()
 {
     SwkbdState state;
     swkbdInit(&state, SWKBD_TYPE_NORMAL, 2, 20);
-    swkbdSetHintText(&state, i18n::localize("SUBREGION").c_str());
+    swkbdSetHintText(&state, i18n::localize(StringId::SUBREGION).c_str());
     swkbdSetValidation(&state, SWKBD_ANYTHING, 0, 0);
     char input[25]  = {0};
     SwkbdButton ret = swkbdInputText(&state, input, sizeof(input));
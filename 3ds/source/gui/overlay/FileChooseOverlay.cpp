@@ -29,7 +29,7 @@
 #include "i18n.hpp"
 
 FileChooseOverlay::FileChooseOverlay(ReplaceableScreen& screen, std::string& retString, const std::string& rootString)
-    : ReplaceableScreen(&screen, i18n::localize("A_SELECT") + '\n' + i18n::localize("B_BACK")),
+    : ReplaceableScreen(&screen, i18n::localize(StringId::A_SELECT) + '\n' + i18n::localize(StringId::B_BACK)),
       currDirString("/"),
       rootString(rootString),
       currDir("/"),
@@ -89,7 +89,7 @@ void FileChooseOverlay::updateEntries()
     currFiles.clear();
     if (!currDir.good())
     {
-        Gui::warn(i18n::localize("FOLDER_DOESNT_EXIST"));
+        Gui::warn(i18n::localize(StringId::FOLDER_DOESNT_EXIST));
         return;
     }
     for (size_t i = 0; i < currDir.count(); i++)
@@ -146,7 +146,7 @@ void FileChooseOverlay::update(touchPosition* touch)
             }
             else
             {
-                if (Gui::showChoiceMessage(i18n::localize("FILE_CONFIRM_CHOICE"), '\'' + currFiles[hid.fullIndex()].first + '\''))
+                if (Gui::showChoiceMessage(i18n::localize(StringId::FILE_CONFIRM_CHOICE), '\'' + currFiles[hid.fullIndex()].first + '\''))
                 {
                     string = currDirString + currFiles[hid.fullIndex()].first;
                     parent->removeOverlay();
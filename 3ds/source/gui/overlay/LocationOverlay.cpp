@@ -29,14 +29,17 @@
 #include "gui.hpp"
 
 LocationOverlay::LocationOverlay(ReplaceableScreen& screen, std::shared_ptr<PKX> pkm, bool met)
-    : ReplaceableScreen(&screen, i18n::localize("A_SELECT") + '\n' + i18n::localize("B_BACK")),
+    : ReplaceableScreen(&screen, i18n::localize(StringId::A_SELECT) + '\n' + i18n::localize(StringId::B_BACK)),
       pkm(pkm),
       hid(40, 2),
       validLocations(i18n::locations(Configuration::getInstance().language(), pkm->generation())),
-      locations(validLocations),
       met(met)
 {
-    instructions.addBox(false, 75, 30, 170, 23, COLOR_GREY, i18n::localize("SEARCH"), COLOR_WHITE);
+    for (size_t i = 0; i < validLocations.size(); i++)
+    {
+        locations.push_back(i);
+    }
+    instructions.addBox(false, 75, 30, 170, 23, COLOR_GREY, i18n::localize(StringId::SEARCH), COLOR_WHITE);
     searchButton = std::make_unique<ClickButton>(75, 30, 170, 23,
         [this]() {
             searchBar();
@@ -44,15 +47,13 @@ LocationOverlay::LocationOverlay(ReplaceableScreen& screen, std::shared_ptr<PKX>
         },
         ui_sheet_emulated_box_search_idx, "", 0, 0);
     hid.update(locations.size());
-    hid.select(std::distance(locations.begin(), std::find_if(locations.begin(), locations.end(), [pkm, met](const std::pair<u16, std::string>& pair) {
-        return pair.first == (met ? pkm->metLocation() : pkm->eggLocation());
-    })));
+    hid.select(validLocations.indexOf(met ? pkm->metLocation() : pkm->eggLocation()));
 }
 
 void LocationOverlay::drawBottom() const
 {
     dim();
-    Gui::text(i18n::localize("EDITOR_INST"), 160, 115, FONT_SIZE_18, FONT_SIZE_18, COLOR_WHITE, TextPosX::CENTER, TextPosY::TOP);
+    Gui::text(i18n::localize(StringId::EDITOR_INST), 160, 115, FONT_SIZE_18, FONT_SIZE_18, COLOR_WHITE, TextPosX::CENTER, TextPosY::TOP);
     searchButton->draw();
     Gui::sprite(ui_sheet_icon_search_idx, 79, 33);
     Gui::text(searchString, 95, 32, FONT_SIZE_12, FONT_SIZE_12, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
@@ -68,20 +69,14 @@ void LocationOverlay::drawTop() const
     Gui::drawSolidRect(x, y, 1, 11, COLOR_YELLOW);
     Gui::drawSolidRect(x, y + 10, 198, 1, COLOR_YELLOW);
     Gui::drawSolidRect(x + 197, y, 1, 11, COLOR_YELLOW);
-    // Stupid non random-access iterators
-    std::map<u16, std::string>::const_iterator locIt = locations.begin();
-    for (size_t i = 0; i < hid.page() * hid.maxVisibleEntries(); i++)
-    {
-        locIt++;
-    }
     for (size_t i = 0; i < hid.maxVisibleEntries(); i++)
     {
         x = i < hid.maxVisibleEntries() / 2 ? 4 : 203;
         if (hid.page() * hid.maxVisibleEntries() + i < locations.size())
         {
-            Gui::text(std::to_string(locIt->first) + " - " + locIt->second, x, (i % (hid.maxVisibleEntries() / 2)) * 12, FONT_SIZE_9, FONT_SIZE_9,
-                COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
-            locIt++;
+            size_t location = locations[hid.page() * hid.maxVisibleEntries() + i];
+            Gui::text(std::to_string(validLocations.id(location)) + " - " + validLocations.name(location), x,
+                (i % (hid.maxVisibleEntries() / 2)) * 12, FONT_SIZE_9, FONT_SIZE_9, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
         }
         else
         {
@@ -110,20 +105,23 @@ void LocationOverlay::update(touchPosition* touch)
     if (!searchString.empty() && searchString != oldSearchString)
     {
         locations.clear();
-        for (auto i = validLocations.begin(); i != validLocations.end(); i++)
+        for (u16 location : i18n::locationIndex(Configuration::getInstance().language(), pkm->generation()).prefix(searchString))
         {
-            std::string locName = i->second.substr(0, searchString.size());
-            StringUtils::toLower(locName);
-            if (locName == searchString)
+            size_t i = validLocations.indexOf(location);
+            if (i < validLocations.size())
             {
-                locations.emplace(*i);
+                locations.push_back(i);
             }
         }
         oldSearchString = searchString;
     }
     else if (searchString.empty() && !oldSearchString.empty())
     {
-        locations       = validLocations;
+        locations.clear();
+        for (size_t i = 0; i < validLocations.size(); i++)
+        {
+            locations.push_back(i);
+        }
         oldSearchString = searchString = "";
     }
     if (hid.fullIndex() >= locations.size())
@@ -137,18 +135,14 @@ void LocationOverlay::update(touchPosition* touch)
     {
         if (locations.size() > 0)
         {
-            auto locIt = locations.begin();
-            for (size_t i = 0; i < hid.fullIndex(); i++)
-            {
-                locIt++;
-            }
+            u16 location = validLocations.id(locations[hid.fullIndex()]);
             if (met)
             {
-                pkm->metLocation(locIt->first);
+                pkm->metLocation(location);
             }
             else
             {
-                pkm->eggLocation(locIt->first);
+                pkm->eggLocation(location);
             }
         }
         parent->removeOverlay();
@@ -165,7 +159,7 @@ void LocationOverlay::searchBar()
 {
     SwkbdState state;
     swkbdInit(&state, SWKBD_TYPE_NORMAL, 2, 20);
-    swkbdSetHintText(&state, i18n::localize(met ? "MET_LOCATION" : "EGG_LOCATION").c_str());
+    swkbdSetHintText(&state, i18n::localize(met ? StringId::MET_LOCATION : StringId::EGG_LOCATION).c_str());
     swkbdSetValidation(&state, SWKBD_ANYTHING, 0, 0);
     char input[25]  = {0};
     SwkbdButton ret = swkbdInputText(&state, input, sizeof(input));
@@ -173,6 +167,5 @@ void LocationOverlay::searchBar()
     if (ret == SWKBD_BUTTON_CONFIRM)
     {
         searchString = input;
-        StringUtils::toLower(searchString);
     }
 }
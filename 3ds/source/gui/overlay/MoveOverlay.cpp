@@ -62,9 +62,12 @@ namespace
 }
 
 MoveOverlay::MoveOverlay(ReplaceableScreen& screen, const std::variant<std::shared_ptr<PKX>, std::shared_ptr<PKFilter>>& object, int moveIndex)
-    : ReplaceableScreen(&screen, i18n::localize("A_SELECT") + '\n' + i18n::localize("B_BACK")), object(object), moveIndex(moveIndex), hid(40, 2)
+    : ReplaceableScreen(&screen, i18n::localize(StringId::A_SELECT) + '\n' + i18n::localize(StringId::B_BACK)),
+      object(object),
+      moveIndex(moveIndex),
+      hid(40, 2)
 {
-    instructions.addBox(false, 75, 30, 170, 23, COLOR_GREY, i18n::localize("SEARCH"), COLOR_WHITE);
+    instructions.addBox(false, 75, 30, 170, 23, COLOR_GREY, i18n::localize(StringId::SEARCH), COLOR_WHITE);
     const std::vector<std::string>& rawMoves = i18n::rawMoves(Configuration::getInstance().language());
     for (int i = 1; i <= TitleLoader::save->maxMove(); i++)
     {
@@ -122,7 +125,7 @@ MoveOverlay::~MoveOverlay()
 void MoveOverlay::drawBottom() const
 {
     dim();
-    Gui::text(i18n::localize("EDITOR_INST"), 160, 115, FONT_SIZE_18, FONT_SIZE_18, COLOR_WHITE, TextPosX::CENTER, TextPosY::TOP);
+    Gui::text(i18n::localize(StringId::EDITOR_INST), 160, 115, FONT_SIZE_18, FONT_SIZE_18, COLOR_WHITE, TextPosX::CENTER, TextPosY::TOP);
     searchButton->draw();
     Gui::sprite(ui_sheet_icon_search_idx, 79, 33);
     Gui::text(searchString, 95, 32, FONT_SIZE_12, FONT_SIZE_12, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
@@ -173,13 +176,12 @@ void MoveOverlay::update(touchPosition* touch)
 
     if (!searchString.empty() && searchString != oldSearchString)
     {
+        std::vector<u16> matches = i18n::searchIndex(Configuration::getInstance().language(), SearchCategory::MOVES).prefix(searchString);
         moves.clear();
         moves.emplace_back(validMoves[0]);
         for (size_t i = 1; i < validMoves.size(); i++)
         {
-            std::string itemName = validMoves[i].second.substr(0, searchString.size());
-            StringUtils::toLower(itemName);
-            if (itemName == searchString)
+            if (std::binary_search(matches.begin(), matches.end(), validMoves[i].first))
             {
                 moves.emplace_back(validMoves[i]);
             }
@@ -238,7 +240,7 @@ void MoveOverlay::searchBar()
 {
     SwkbdState state;
     swkbdInit(&state, SWKBD_TYPE_NORMAL, 2, 20);
-    swkbdSetHintText(&state, i18n::localize("ITEM").c_str());
+    swkbdSetHintText(&state, i18n::localize(StringId::ITEM).c_str());
     swkbdSetValidation(&state, SWKBD_ANYTHING, 0, 0);
     char input[25]  = {0};
     SwkbdButton ret = swkbdInputText(&state, input, sizeof(input));
@@ -246,6 +248,5 @@ void MoveOverlay::searchBar()
     if (ret == SWKBD_BUTTON_CONFIRM)
     {
         searchString = input;
-        StringUtils::toLower(searchString);
     }
 }
@@ -33,14 +33,14 @@ static constexpr std::string_view stats[] = {"ATTACK", "DEFENSE", "SPEED", "SPAT
 void NatureOverlay::drawBottom() const
 {
     dim();
-    Gui::text(i18n::localize("EDITOR_INST"), 160, 115, FONT_SIZE_18, FONT_SIZE_18, COLOR_WHITE, TextPosX::CENTER, TextPosY::TOP);
+    Gui::text(i18n::localize(StringId::EDITOR_INST), 160, 115, FONT_SIZE_18, FONT_SIZE_18, COLOR_WHITE, TextPosX::CENTER, TextPosY::TOP);
 }
 
 void NatureOverlay::drawTop() const
 {
     Gui::sprite(ui_sheet_part_editor_6x6_idx, 0, 0);
 
-    Gui::text(i18n::localize("NEUTRAL"), 0 + 65 / 2, 12, FONT_SIZE_11, FONT_SIZE_11, COLOR_YELLOW, TextPosX::CENTER, TextPosY::TOP);
+    Gui::text(i18n::localize(StringId::NEUTRAL), 0 + 65 / 2, 12, FONT_SIZE_11, FONT_SIZE_11, COLOR_YELLOW, TextPosX::CENTER, TextPosY::TOP);
     for (int i = 0; i < 5; i++)
     {
         Gui::text(std::string("-") + i18n::localize(std::string(stats[i])), i * 67 + 99, 12, FONT_SIZE_11, FONT_SIZE_11, COLOR_WHITE,
@@ -66,9 +66,9 @@ namespace
 }
 
 PkmItemOverlay::PkmItemOverlay(ReplaceableScreen& screen, std::shared_ptr<PKX> pkm)
-    : ReplaceableScreen(&screen, i18n::localize("A_SELECT") + '\n' + i18n::localize("B_BACK")), pkm(pkm), hid(40, 2)
+    : ReplaceableScreen(&screen, i18n::localize(StringId::A_SELECT) + '\n' + i18n::localize(StringId::B_BACK)), pkm(pkm), hid(40, 2)
 {
-    instructions.addBox(false, 75, 30, 170, 23, COLOR_GREY, i18n::localize("SEARCH"), COLOR_WHITE);
+    instructions.addBox(false, 75, 30, 170, 23, COLOR_GREY, i18n::localize(StringId::SEARCH), COLOR_WHITE);
     const std::vector<std::string>& rawItems = i18n::rawItems(Configuration::getInstance().language());
     for (int i = 1; i <= TitleLoader::save->maxItem(); i++)
     {
@@ -110,7 +110,7 @@ PkmItemOverlay::PkmItemOverlay(ReplaceableScreen& screen, std::shared_ptr<PKX> p
 void PkmItemOverlay::drawBottom() const
 {
     dim();
-    Gui::text(i18n::localize("EDITOR_INST"), 160, 115, FONT_SIZE_18, FONT_SIZE_18, COLOR_WHITE, TextPosX::CENTER, TextPosY::TOP);
+    Gui::text(i18n::localize(StringId::EDITOR_INST), 160, 115, FONT_SIZE_18, FONT_SIZE_18, COLOR_WHITE, TextPosX::CENTER, TextPosY::TOP);
     searchButton->draw();
     Gui::sprite(ui_sheet_icon_search_idx, 79, 33);
     Gui::text(searchString, 95, 32, FONT_SIZE_12, FONT_SIZE_12, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
@@ -161,13 +161,12 @@ void PkmItemOverlay::update(touchPosition* touch)
 
     if (!searchString.empty() && searchString != oldSearchString)
     {
+        std::vector<u16> matches = i18n::searchIndex(Configuration::getInstance().language(), SearchCategory::ITEMS).prefix(searchString);
         items.clear();
         items.emplace_back(validItems[0]);
         for (size_t i = 1; i < validItems.size(); i++)
         {
-            std::string itemName = validItems[i].second.substr(0, searchString.size());
-            StringUtils::toLower(itemName);
-            if (itemName == searchString)
+            if (std::binary_search(matches.begin(), matches.end(), validItems[i].first))
             {
                 items.emplace_back(validItems[i]);
             }
@@ -203,7 +202,7 @@ void PkmItemOverlay::searchBar()
 {
     SwkbdState state;
     swkbdInit(&state, SWKBD_TYPE_NORMAL, 2, 20);
-    swkbdSetHintText(&state, i18n::localize("ITEM").c_str());
+    swkbdSetHintText(&state, i18n::localize(StringId::ITEM).c_str());
     swkbdSetValidation(&state, SWKBD_ANYTHING, 0, 0);
     char input[25]  = {0};
     SwkbdButton ret = swkbdInputText(&state, input, sizeof(input));
@@ -211,6 +210,5 @@ void PkmItemOverlay::searchBar()
     if (ret == SWKBD_BUTTON_CONFIRM)
     {
         searchString = input;
-        StringUtils::toLower(searchString);
     }
 }
@@ -31,9 +31,9 @@
 #include "loader.hpp"
 
 SpeciesOverlay::SpeciesOverlay(ReplaceableScreen& screen, const std::variant<std::shared_ptr<PKX>, std::shared_ptr<PKFilter>>& object)
-    : ReplaceableScreen(&screen, i18n::localize("A_SELECT") + '\n' + i18n::localize("B_BACK")), object(object), hid(40, 8)
+    : ReplaceableScreen(&screen, i18n::localize(StringId::A_SELECT) + '\n' + i18n::localize(StringId::B_BACK)), object(object), hid(40, 8)
 {
-    instructions.addBox(false, 75, 30, 170, 23, COLOR_GREY, i18n::localize("SEARCH"), COLOR_WHITE);
+    instructions.addBox(false, 75, 30, 170, 23, COLOR_GREY, i18n::localize(StringId::SEARCH), COLOR_WHITE);
     searchButton = std::make_unique<ClickButton>(75, 30, 170, 23,
         [this]() {
             searchBar();
@@ -97,7 +97,7 @@ SpeciesOverlay::SpeciesOverlay(ReplaceableScreen& screen, const std::variant<std
 void SpeciesOverlay::drawBottom() const
 {
     dim();
-    Gui::text(i18n::localize("EDITOR_INST"), 160, 115, FONT_SIZE_18, FONT_SIZE_18, COLOR_WHITE, TextPosX::CENTER, TextPosY::TOP);
+    Gui::text(i18n::localize(StringId::EDITOR_INST), 160, 115, FONT_SIZE_18, FONT_SIZE_18, COLOR_WHITE, TextPosX::CENTER, TextPosY::TOP);
     searchButton->draw();
     Gui::sprite(ui_sheet_icon_search_idx, 79, 33);
     Gui::text(searchString, 95, 32, FONT_SIZE_12, FONT_SIZE_12, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
@@ -154,41 +154,18 @@ void SpeciesOverlay::update(touchPosition* touch)
     if (!searchString.empty() && searchString != oldSearchString)
     {
         dispPkm.clear();
-        if (TitleLoader::save->generation() != Generation::LGPE)
-        {
-            for (int i = 1; i <= TitleLoader::save->maxSpecies(); i++)
-            {
-                std::string speciesName = i18n::species(Configuration::getInstance().language(), i).substr(0, searchString.size());
-                StringUtils::toLower(speciesName);
-                if (speciesName == searchString)
-                {
-                    dispPkm.push_back(i);
-                }
-            }
-        }
-        else
+        for (u16 species : i18n::searchIndex(Configuration::getInstance().language(), SearchCategory::SPECIES).prefix(searchString))
         {
-            std::string speciesName;
-            for (size_t i = 1; i <= 151; i++)
+            if (TitleLoader::save->generation() != Generation::LGPE)
             {
-                speciesName = i18n::species(Configuration::getInstance().language(), i).substr(0, searchString.size());
-                StringUtils::toLower(speciesName);
-                if (speciesName == searchString)
+                if (species >= 1 && species <= TitleLoader::save->maxSpecies())
                 {
-                    dispPkm.push_back(i);
+                    dispPkm.push_back(species);
                 }
             }
-            speciesName = i18n::species(Configuration::getInstance().language(), 808).substr(0, searchString.size());
-            StringUtils::toLower(speciesName);
-            if (speciesName == searchString)
-            {
-                dispPkm.push_back(808);
-            }
-            speciesName = i18n::species(Configuration::getInstance().language(), 809).substr(0, searchString.size());
-            StringUtils::toLower(speciesName);
-            if (speciesName == searchString)
+            else if ((species >= 1 && species <= 151) || species == 808 || species == 809)
             {
-                dispPkm.push_back(809);
+                dispPkm.push_back(species);
             }
         }
         oldSearchString = searchString;
@@ -295,7 +272,7 @@ void SpeciesOverlay::searchBar()
 {
     SwkbdState state;
     swkbdInit(&state, SWKBD_TYPE_NORMAL, 2, 20);
-    swkbdSetHintText(&state, i18n::localize("SPECIES").c_str());
+    swkbdSetHintText(&state, i18n::localize(StringId::SPECIES).c_str());
     swkbdSetValidation(&state, SWKBD_ANYTHING, 0, 0);
     char input[25]  = {0};
     SwkbdButton ret = swkbdInputText(&state, input, sizeof(input));
@@ -303,6 +280,5 @@ void SpeciesOverlay::searchBar()
     if (ret == SWKBD_BUTTON_CONFIRM)
     {
         searchString = input;
-        StringUtils::toLower(searchString);
     }
 }
@@ -31,7 +31,7 @@ VersionOverlay::VersionOverlay(ReplaceableScreen& screen, std::shared_ptr<PKX> p
     for (size_t i = 0; i < i18n::numGameStrings(Configuration::getInstance().language()); i++)
     {
         const std::string& str = i18n::game(Configuration::getInstance().language(), i);
-        if (str != i18n::localize("INVALID_GAME"))
+        if (str != i18n::localize(StringId::INVALID_GAME))
         {
             games.emplace_back((u8)i, str);
         }
@@ -44,7 +44,7 @@ VersionOverlay::VersionOverlay(ReplaceableScreen& screen, std::shared_ptr<PKX> p
 void VersionOverlay::drawBottom() const
 {
     dim();
-    Gui::text(i18n::localize("EDITOR_INST"), 160, 115, FONT_SIZE_18, FONT_SIZE_18, COLOR_WHITE, TextPosX::CENTER, TextPosY::TOP);
+    Gui::text(i18n::localize(StringId::EDITOR_INST), 160, 115, FONT_SIZE_18, FONT_SIZE_18, COLOR_WHITE, TextPosX::CENTER, TextPosY::TOP);
 }
 
 void VersionOverlay::drawTop() const
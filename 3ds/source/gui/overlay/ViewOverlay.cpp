@@ -85,7 +85,7 @@ void ViewOverlay::drawTop() const
         Gui::text(i18n::localize(std::string(displayKeys[i + 10])), 238, 16 + i * 20, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK, TextPosX::LEFT,
             TextPosY::TOP);
     }
-    Gui::text(i18n::localize("MOVES"), 252, 136, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
+    Gui::text(i18n::localize(StringId::MOVES), 252, 136, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
 
     if (pkm)
     {
@@ -106,7 +106,8 @@ void ViewOverlay::drawTop() const
             Gui::sprite(ui_sheet_icon_genderless_idx, 129, 10);
         }
         Gui::text(
-            StringUtils::format(i18n::localize("LVL"), pkm->level()), 143, 10, FONT_SIZE_9, FONT_SIZE_9, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
+            StringUtils::format(i18n::localize(StringId::LVL), pkm->level()), 143, 10, FONT_SIZE_9, FONT_SIZE_9, COLOR_WHITE, TextPosX::LEFT,
+            TextPosY::TOP);
         if (pkm->shiny())
         {
             Gui::sprite(ui_sheet_icon_shiny_idx, 191, 5);
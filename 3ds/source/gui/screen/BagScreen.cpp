@@ -31,7 +31,8 @@
 #include "loader.hpp"
 
 BagScreen::BagScreen()
-    : Screen(i18n::localize("A_ITEM_EDIT") + '\n' + i18n::localize("L_POUCH") + '\n' + i18n::localize("R_ITEM") + '\n' + i18n::localize("B_BACK")),
+    : Screen(i18n::localize(StringId::A_ITEM_EDIT) + '\n' + i18n::localize(StringId::L_POUCH) + '\n' + i18n::localize(StringId::R_ITEM) + '\n' +
+             i18n::localize(StringId::B_BACK)),
       limits(TitleLoader::save->pouches()),
       allowedItems(TitleLoader::save->validItems())
 {
@@ -579,7 +580,7 @@ void BagScreen::setCount(int selected)
     {
         SwkbdState state;
         swkbdInit(&state, SWKBD_TYPE_NUMPAD, 2, item->generation() == Generation::SEVEN ? 4 : 5);
-        swkbdSetHintText(&state, i18n::localize("ITEMS").c_str());
+        swkbdSetHintText(&state, i18n::localize(StringId::ITEMS).c_str());
         swkbdSetValidation(&state, SWKBD_NOTBLANK_NOTEMPTY, 0, 0);
         char input[6]   = {0};
         SwkbdButton ret = swkbdInputText(&state, input, sizeof(input));
@@ -30,8 +30,8 @@
 void BankSelectionScreen::drawBottom() const
 {
     Gui::sprite(ui_sheet_part_info_bottom_idx, 0, 0);
-    Gui::text(i18n::localize("X_RENAME") + "\n" + i18n::localize("Y_RESIZE") + "\n" + i18n::localize("START_DELETE"), 160, 120, FONT_SIZE_18,
-        FONT_SIZE_18, COLOR_BLACK, TextPosX::CENTER, TextPosY::CENTER);
+    Gui::text(i18n::localize(StringId::X_RENAME) + "\n" + i18n::localize(StringId::Y_RESIZE) + "\n" + i18n::localize(StringId::START_DELETE), 160,
+        120, FONT_SIZE_18, FONT_SIZE_18, COLOR_BLACK, TextPosX::CENTER, TextPosY::CENTER);
 }
 
 void BankSelectionScreen::drawTop() const
@@ -70,7 +70,7 @@ void BankSelectionScreen::update(touchPosition* touch)
         auto& res = strings[hid.fullIndex()];
         if (res.first != Banks::bank->name())
         {
-            if (Banks::bank->hasChanged() && Gui::showChoiceMessage(i18n::localize("BANK_SAVE_CHANGES")))
+            if (Banks::bank->hasChanged() && Gui::showChoiceMessage(i18n::localize(StringId::BANK_SAVE_CHANGES)))
             {
                 Banks::bank->save();
             }
@@ -103,7 +103,7 @@ void BankSelectionScreen::update(touchPosition* touch)
         }
         if (strings.size() > 2)
         {
-            if (Gui::showChoiceMessage(StringUtils::format(i18n::localize("BANK_DELETE"), strings[hid.fullIndex()].first.c_str())))
+            if (Gui::showChoiceMessage(StringUtils::format(i18n::localize(StringId::BANK_DELETE), strings[hid.fullIndex()].first.c_str())))
             {
                 auto i = strings.begin() + hid.fullIndex();
                 Banks::removeBank(i->first);
@@ -122,7 +122,7 @@ void BankSelectionScreen::renameBank()
         swkbdInit(&state, SWKBD_TYPE_NORMAL, 2, 10);
         first = false;
     }
-    swkbdSetHintText(&state, i18n::localize("BANK_NAME").c_str());
+    swkbdSetHintText(&state, i18n::localize(StringId::BANK_NAME).c_str());
     swkbdSetValidation(&state, SWKBD_NOTBLANK_NOTEMPTY, 0, 0);
     char input[41]  = {0};
     SwkbdButton ret = swkbdInputText(&state, input, sizeof(input));
@@ -133,7 +133,7 @@ void BankSelectionScreen::renameBank()
         if (std::find_if(strings.begin(), strings.end(), [&string](const std::pair<std::string, int>& v) { return v.first == string; }) !=
             strings.end())
         {
-            Gui::warn(i18n::localize("NO_DUPES"));
+            Gui::warn(i18n::localize(StringId::NO_DUPES));
         }
         else
         {
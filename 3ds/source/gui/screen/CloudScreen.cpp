@@ -38,8 +38,8 @@
 #include <sys/stat.h>
 
 CloudScreen::CloudScreen(int storageBox, std::shared_ptr<PKFilter> filter)
-    : Screen(i18n::localize("A_PICKUP") + '\n' + i18n::localize("X_SHARE") + '\n' + i18n::localize("START_SORT_FILTER") + '\n' +
-             i18n::localize("L_BOX_PREV") + '\n' + i18n::localize("R_BOX_NEXT") + '\n' + i18n::localize("B_BACK")),
+    : Screen(i18n::localize(StringId::A_PICKUP) + '\n' + i18n::localize(StringId::X_SHARE) + '\n' + i18n::localize(StringId::START_SORT_FILTER) +
+             '\n' + i18n::localize(StringId::L_BOX_PREV) + '\n' + i18n::localize(StringId::R_BOX_NEXT) + '\n' + i18n::localize(StringId::B_BACK)),
       storageBox(storageBox),
       filter(filter == nullptr ? std::make_shared<PKFilter>() : filter)
 {
@@ -48,13 +48,16 @@ CloudScreen::CloudScreen(int storageBox, std::shared_ptr<PKFilter> filter)
             Gui::setScreen(std::make_unique<FilterScreen>(this->filter));
             return true;
         },
-        ui_sheet_button_editor_idx, i18n::localize("FILTER"), FONT_SIZE_12, COLOR_BLACK);
+        ui_sheet_button_editor_idx, i18n::localize(StringId::FILTER), FONT_SIZE_12, COLOR_BLACK);
     mainButtons[1] = std::make_unique<Button>(
-        212, 109, 108, 28, [this]() { return this->showViewer(); }, ui_sheet_button_editor_idx, i18n::localize("VIEW"), FONT_SIZE_12, COLOR_BLACK);
+        212, 109, 108, 28, [this]() { return this->showViewer(); }, ui_sheet_button_editor_idx, i18n::localize(StringId::VIEW), FONT_SIZE_12,
+        COLOR_BLACK);
     mainButtons[2] = std::make_unique<Button>(
-        212, 140, 108, 28, [this]() { return this->releasePkm(); }, ui_sheet_button_editor_idx, i18n::localize("RELEASE"), FONT_SIZE_12, COLOR_BLACK);
+        212, 140, 108, 28, [this]() { return this->releasePkm(); }, ui_sheet_button_editor_idx, i18n::localize(StringId::RELEASE), FONT_SIZE_12,
+        COLOR_BLACK);
     mainButtons[3] = std::make_unique<Button>(
-        212, 171, 108, 28, [this]() { return this->dumpPkm(); }, ui_sheet_button_editor_idx, i18n::localize("DUMP"), FONT_SIZE_12, COLOR_BLACK);
+        212, 171, 108, 28, [this]() { return this->dumpPkm(); }, ui_sheet_button_editor_idx, i18n::localize(StringId::DUMP), FONT_SIZE_12,
+        COLOR_BLACK);
     mainButtons[4] = std::make_unique<Button>(283, 211, 34, 28, [this]() { return this->backButton(); }, ui_sheet_button_back_idx, "", 0.0f, 0);
     mainButtons[5] =
         std::make_unique<AccelButton>(8, 15, 17, 24, [this]() { return this->prevBox(true); }, ui_sheet_res_null_idx, "", 0.0f, 0, 10, 5);
@@ -104,7 +107,7 @@ void CloudScreen::drawBottom() const
         u16 x = 4;
         for (u8 column = 0; column < 6; column++)
         {
-            std::shared_ptr<PKX> pokemon = Banks::bank->pkm(storageBox, row * 6 + column);
+            std::shared_ptr<const PKX> pokemon = Banks::bank->cachedPkm(storageBox, row * 6 + column);
             if (pokemon->species() > 0)
             {
                 float blend = *pokemon == *filter ? 0.0f : 0.5f;
@@ -164,19 +167,19 @@ void CloudScreen::drawTop() const
         if (access.isLegal(cursorIndex - 1))
         {
             Gui::sprite(ui_sheet_textbox_legal_idx, 261, 34);
-            Gui::text(i18n::localize("LEGALITY_LEGAL"), 394, 38, FONT_SIZE_14, FONT_SIZE_14, COLOR_WHITE, TextPosX::RIGHT, TextPosY::TOP);
+            Gui::text(i18n::localize(StringId::LEGALITY_LEGAL), 394, 38, FONT_SIZE_14, FONT_SIZE_14, COLOR_WHITE, TextPosX::RIGHT, TextPosY::TOP);
         }
         else
         {
             Gui::sprite(ui_sheet_emulated_textbox_illegal_idx, 261, 34);
-            Gui::text(i18n::localize("LEGALITY_ILLEGAL"), 394, 38, FONT_SIZE_14, FONT_SIZE_14, COLOR_WHITE, TextPosX::RIGHT, TextPosY::TOP);
+            Gui::text(i18n::localize(StringId::LEGALITY_ILLEGAL), 394, 38, FONT_SIZE_14, FONT_SIZE_14, COLOR_WHITE, TextPosX::RIGHT, TextPosY::TOP);
         }
     }
 
     Gui::sprite(ui_sheet_bar_boxname_empty_idx, 44, 21);
     Gui::text("\uE004", 45 + 24 / 2, 24, FONT_SIZE_14, FONT_SIZE_14, COLOR_BLACK, TextPosX::CENTER, TextPosY::TOP);
     Gui::text("\uE005", 225 + 24 / 2, 24, FONT_SIZE_14, FONT_SIZE_14, COLOR_BLACK, TextPosX::CENTER, TextPosY::TOP);
-    Gui::text(StringUtils::format(i18n::localize("CLOUD_BOX"), access.page()), 69 + 156 / 2, 24, FONT_SIZE_14, FONT_SIZE_14, COLOR_BLACK,
+    Gui::text(StringUtils::format(i18n::localize(StringId::CLOUD_BOX), access.page()), 69 + 156 / 2, 24, FONT_SIZE_14, FONT_SIZE_14, COLOR_BLACK,
         TextPosX::CENTER, TextPosY::TOP);
 
     Gui::sprite(ui_sheet_storagemenu_cross_idx, 36, 50);
@@ -241,7 +244,7 @@ void CloudScreen::drawTop() const
         Gui::text(infoMon->nickname(), 276, 61, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
         std::string info = "#" + std::to_string(infoMon->species());
         Gui::text(info, 273, 77, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
-        info      = i18n::localize("LV") + std::to_string(infoMon->level());
+        info      = i18n::localize(StringId::LV) + std::to_string(infoMon->level());
         auto text = Gui::parseText(info, FONT_SIZE_12, 0.0f);
         int width = text->maxWidth(FONT_SIZE_12);
         Gui::text(text, 375 - width, 77, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
@@ -283,12 +286,12 @@ void CloudScreen::drawTop() const
             Gui::type(Configuration::getInstance().language(), firstType, 300, 115);
         }
 
-        info = infoMon->otName() + '\n' + i18n::localize("LOADER_ID") + std::to_string(infoMon->versionTID());
+        info = infoMon->otName() + '\n' + i18n::localize(StringId::LOADER_ID) + std::to_string(infoMon->versionTID());
         Gui::text(info, 276, 141, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
 
         Gui::text(i18n::nature(Configuration::getInstance().language(), infoMon->nature()), 276, 181, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK,
             TextPosX::LEFT, TextPosY::TOP);
-        info  = i18n::localize("IV") + ": ";
+        info  = i18n::localize(StringId::IV) + ": ";
         text  = Gui::parseText(info, FONT_SIZE_12, 0.0f);
         width = text->maxWidth(FONT_SIZE_12);
         Gui::text(text, 276, 197, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
@@ -304,7 +307,7 @@ void CloudScreen::update(touchPosition* touch)
 {
     if (!access.good())
     {
-        Gui::warn(i18n::localize("OFFLINE_ERROR"));
+        Gui::warn(i18n::localize(StringId::OFFLINE_ERROR));
         Gui::screenBack();
         return;
     }
@@ -333,7 +336,7 @@ void CloudScreen::update(touchPosition* touch)
     {
         if (infoMon && !cloudChosen)
         {
-            if (!Gui::showChoiceMessage(i18n::localize("SHARE_SEND_CONFIRM")))
+            if (!Gui::showChoiceMessage(i18n::localize(StringId::SHARE_SEND_CONFIRM)))
             {
                 return;
             }
@@ -341,7 +344,7 @@ void CloudScreen::update(touchPosition* touch)
         }
         else
         {
-            if (!Gui::showChoiceMessage(i18n::localize("SHARE_CODE_ENTER_PROMPT")))
+            if (!Gui::showChoiceMessage(i18n::localize(StringId::SHARE_CODE_ENTER_PROMPT)))
             {
                 return;
             }
@@ -512,12 +515,18 @@ void CloudScreen::update(touchPosition* touch)
 
 void CloudScreen::pickup()
 {
+    // Whatever is put into a box that couldn't be read would be dropped
+    if (!cloudChosen && !Banks::bank->boxReadable(storageBox))
+    {
+        Gui::warn(i18n::localize(StringId::BANK_CORRUPT));
+        return;
+    }
     if (!moveMon)
     {
         if (cloudChosen)
         {
             auto cloudMon = access.pkm(cursorIndex - 1);
-            if (cloudMon && cloudMon->species() != 0 && Gui::showChoiceMessage(i18n::localize("GPSS_DOWNLOAD")))
+            if (cloudMon && cloudMon->species() != 0 && Gui::showChoiceMessage(i18n::localize(StringId::GPSS_DOWNLOAD)))
             {
                 moveMon = access.fetchPkm(cursorIndex - 1);
             }
@@ -538,11 +547,11 @@ void CloudScreen::pickup()
     }
     else
     {
-        if (cloudChosen && Gui::showChoiceMessage(i18n::localize("SHARE_SEND_CONFIRM")))
+        if (cloudChosen && Gui::showChoiceMessage(i18n::localize(StringId::SHARE_SEND_CONFIRM)))
         {
             if (!access.pkm(moveMon))
             {
-                Gui::warn(i18n::localize("DATA_SEND_FAIL"));
+                Gui::warn(i18n::localize(StringId::DATA_SEND_FAIL));
             }
             moveMon = nullptr;
         }
@@ -568,7 +577,7 @@ bool CloudScreen::prevBox(bool forceBottom)
     {
         if (!access.prevPage())
         {
-            Gui::warn(i18n::localize("OFFLINE_ERROR"));
+            Gui::warn(i18n::localize(StringId::OFFLINE_ERROR));
             Gui::screenBack();
             return true;
         }
@@ -588,7 +597,7 @@ bool CloudScreen::prevBoxTop()
 {
     if (!access.prevPage())
     {
-        Gui::warn(i18n::localize("OFFLINE_ERROR"));
+        Gui::warn(i18n::localize(StringId::OFFLINE_ERROR));
         Gui::screenBack();
         return true;
     }
@@ -601,7 +610,7 @@ bool CloudScreen::nextBox(bool forceBottom)
     {
         if (!access.nextPage())
         {
-            Gui::warn(i18n::localize("OFFLINE_ERROR"));
+            Gui::warn(i18n::localize(StringId::OFFLINE_ERROR));
             Gui::screenBack();
             return true;
         }
@@ -621,7 +630,7 @@ bool CloudScreen::nextBoxTop()
 {
     if (!access.nextPage())
     {
-        Gui::warn(i18n::localize("OFFLINE_ERROR"));
+        Gui::warn(i18n::localize(StringId::OFFLINE_ERROR));
         Gui::screenBack();
         return true;
     }
@@ -659,7 +668,7 @@ bool CloudScreen::releasePkm()
     if (!cloudChosen && cursorIndex != 0)
     {
         auto pkm = Banks::bank->pkm(storageBox, cursorIndex - 1);
-        if (pkm && pkm->encryptionConstant() != 0 && pkm->species() != 0 && Gui::showChoiceMessage(i18n::localize("BANK_CONFIRM_RELEASE")))
+        if (pkm && pkm->encryptionConstant() != 0 && pkm->species() != 0 && Gui::showChoiceMessage(i18n::localize(StringId::BANK_CONFIRM_RELEASE)))
         {
             Banks::bank->pkm(std::make_shared<PK7>(), storageBox, cursorIndex - 1);
             return false;
@@ -673,7 +682,7 @@ bool CloudScreen::dumpPkm()
     if (!cloudChosen && cursorIndex != 0)
     {
         auto pkm = Banks::bank->pkm(storageBox, cursorIndex - 1);
-        if (pkm && pkm->encryptionConstant() != 0 && pkm->species() != 0 && Gui::showChoiceMessage(i18n::localize("BANK_CONFIRM_DUMP")))
+        if (pkm && pkm->encryptionConstant() != 0 && pkm->species() != 0 && Gui::showChoiceMessage(i18n::localize(StringId::BANK_CONFIRM_DUMP)))
         {
             char stringDate[12]   = {0};
             char stringTime[11]   = {0};
@@ -700,7 +709,7 @@ bool CloudScreen::dumpPkm()
                 }
                 else
                 {
-                    Gui::error(i18n::localize("FAILED_OPEN_DUMP"), out.result());
+                    Gui::error(i18n::localize(StringId::FAILED_OPEN_DUMP), out.result());
                 }
                 out.close();
             }
@@ -772,7 +781,7 @@ void CloudScreen::shareSend()
     }
 
     std::string writeData = "";
-    if (auto fetch = Fetch::init("https://flagbrew.org/gpss/share", false, true, &writeData, headers, ""))
+    if (auto fetch = Fetch::init(GPSS_SERVER "/gpss/share", false, true, &writeData, headers, ""))
     {
         auto mimeThing       = fetch->mimeInit();
         curl_mimepart* field = curl_mime_addpart(mimeThing.get());
@@ -784,7 +793,7 @@ void CloudScreen::shareSend()
         CURLcode res = fetch->perform();
         if (res != CURLE_OK)
         {
-            Gui::error(i18n::localize("CURL_ERROR"), abs(res));
+            Gui::error(i18n::localize(StringId::CURL_ERROR), abs(res));
         }
         else
         {
@@ -793,16 +802,16 @@ void CloudScreen::shareSend()
             {
                 case 200:
                 case 201:
-                    Gui::warn(i18n::localize("SHARE_DOWNLOAD_CODE"), writeData);
+                    Gui::warn(i18n::localize(StringId::SHARE_DOWNLOAD_CODE), writeData);
                     break;
                 case 400:
-                    Gui::error(i18n::localize("SHARE_FAILED_CHECK"), status_code);
+                    Gui::error(i18n::localize(StringId::SHARE_FAILED_CHECK), status_code);
                     break;
                 case 502:
-                    Gui::error(i18n::localize("HTTP_OFFLINE"), status_code);
+                    Gui::error(i18n::localize(StringId::HTTP_OFFLINE), status_code);
                     break;
                 default:
-                    Gui::error(i18n::localize("HTTP_UNKNOWN_ERROR"), status_code);
+                    Gui::error(i18n::localize(StringId::HTTP_UNKNOWN_ERROR), status_code);
                     break;
             }
         }
@@ -821,7 +830,7 @@ void CloudScreen::shareReceive()
     }
     swkbdSetFeatures(&state, SWKBD_FIXED_WIDTH);
     swkbdSetValidation(&state, SWKBD_FIXEDLEN, 0, 0);
-    swkbdSetButton(&state, SwkbdButton::SWKBD_BUTTON_MIDDLE, i18n::localize("QR_SCANNER").c_str(), false);
+    swkbdSetButton(&state, SwkbdButton::SWKBD_BUTTON_MIDDLE, i18n::localize(StringId::QR_SCANNER).c_str(), false);
     char input[11]  = {0};
     SwkbdButton ret = swkbdInputText(&state, input, sizeof(input));
     input[10]       = '\0';
@@ -838,7 +847,7 @@ void CloudScreen::shareReceive()
     }
     if (ret == SWKBD_BUTTON_CONFIRM)
     {
-        const std::string url  = "https://flagbrew.org/gpss/download/" + std::string(input);
+        const std::string url  = GPSS_SERVER "/gpss/download/" + std::string(input);
         std::string retB64Data = "";
         if (auto fetch = Fetch::init(url, false, true, &retB64Data, nullptr, ""))
         {
@@ -849,7 +858,7 @@ void CloudScreen::shareReceive()
             res = fetch->perform();
             if (res != CURLE_OK)
             {
-                Gui::error(i18n::localize("CURL_ERROR"), abs(res));
+                Gui::error(i18n::localize(StringId::CURL_ERROR), abs(res));
             }
             else
             {
@@ -860,13 +869,13 @@ void CloudScreen::shareReceive()
                         break;
                     case 400:
                     case 404:
-                        Gui::error(i18n::localize("SHARE_INVALID_CODE"), status_code);
+                        Gui::error(i18n::localize(StringId::SHARE_INVALID_CODE), status_code);
                         return;
                     case 502:
-                        Gui::error(i18n::localize("HTTP_OFFLINE"), status_code);
+                        Gui::error(i18n::localize(StringId::HTTP_OFFLINE), status_code);
                         return;
                     default:
-                        Gui::error(i18n::localize("HTTP_UNKNOWN_ERROR"), status_code);
+                        Gui::error(i18n::localize(StringId::HTTP_UNKNOWN_ERROR), status_code);
                         return;
                 }
                 auto retData = base64_decode(retB64Data.data(), retB64Data.size());
@@ -890,13 +899,13 @@ void CloudScreen::shareReceive()
                 }
                 if (retData.size() != targetLength)
                 {
-                    Gui::error(i18n::localize("SHARE_ERROR_INCORRECT_VERSION"), retData.size());
+                    Gui::error(i18n::localize(StringId::SHARE_ERROR_INCORRECT_VERSION), retData.size());
                     return;
                 }
 
                 auto pkm = PKX::getPKM(gen, retData.data());
 
-                if (!cloudChosen && cursorIndex != 0)
+                if (!cloudChosen && cursorIndex != 0 && Banks::bank->boxReadable(storageBox))
                 {
                     Banks::bank->pkm(pkm, storageBox, cursorIndex - 1);
                 }
@@ -69,7 +69,7 @@ static void inputOT()
         swkbdInit(&state, SWKBD_TYPE_NORMAL, 2, 12);
         first = false;
     }
-    swkbdSetHintText(&state, i18n::localize("OT_NAME").c_str());
+    swkbdSetHintText(&state, i18n::localize(StringId::OT_NAME).c_str());
     swkbdSetValidation(&state, SWKBD_NOTBLANK_NOTEMPTY, 0, 0);
     char input[25]  = {0};
     SwkbdButton ret = swkbdInputText(&state, input, sizeof(input));
@@ -89,7 +89,7 @@ static void inputPatronCode()
         swkbdInit(&state, SWKBD_TYPE_QWERTY, 2, 22);
         first = false;
     }
-    swkbdSetHintText(&state, i18n::localize("PATRON_CODE").c_str());
+    swkbdSetHintText(&state, i18n::localize(StringId::PATRON_CODE).c_str());
     std::string patronCode = Configuration::getInstance().patronCode();
     swkbdSetInitialText(&state, patronCode.c_str());
     swkbdSetValidation(&state, SWKBD_NOTBLANK_NOTEMPTY, 0, 0);
@@ -152,22 +152,22 @@ void ConfigScreen::initButtons()
             currentTab = 0;
             return false;
         },
-        ui_sheet_res_null_idx, i18n::localize("LANGUAGE"), FONT_SIZE_11, COLOR_WHITE, ui_sheet_emulated_button_tab_unselected_idx,
-        i18n::localize("LANGUAGE"), FONT_SIZE_11, COLOR_BLACK, &tabs, false));
+        ui_sheet_res_null_idx, i18n::localize(StringId::LANGUAGE), FONT_SIZE_11, COLOR_WHITE, ui_sheet_emulated_button_tab_unselected_idx,
+        i18n::localize(StringId::LANGUAGE), FONT_SIZE_11, COLOR_BLACK, &tabs, false));
     tabs.push_back(std::make_unique<ToggleButton>(108, 2, 104, 17,
         [&]() {
             currentTab = 1;
             return false;
         },
-        ui_sheet_res_null_idx, i18n::localize("DEFAULTS"), FONT_SIZE_11, COLOR_WHITE, ui_sheet_emulated_button_tab_unselected_idx,
-        i18n::localize("DEFAULTS"), FONT_SIZE_11, COLOR_BLACK, &tabs, false));
+        ui_sheet_res_null_idx, i18n::localize(StringId::DEFAULTS), FONT_SIZE_11, COLOR_WHITE, ui_sheet_emulated_button_tab_unselected_idx,
+        i18n::localize(StringId::DEFAULTS), FONT_SIZE_11, COLOR_BLACK, &tabs, false));
     tabs.push_back(std::make_unique<ToggleButton>(215, 2, 104, 17,
         [&]() {
             currentTab = 2;
             return false;
         },
-        ui_sheet_res_null_idx, i18n::localize("MISC"), FONT_SIZE_11, COLOR_WHITE, ui_sheet_emulated_button_tab_unselected_idx, i18n::localize("MISC"),
-        FONT_SIZE_11, COLOR_BLACK, &tabs, false));
+        ui_sheet_res_null_idx, i18n::localize(StringId::MISC), FONT_SIZE_11, COLOR_WHITE, ui_sheet_emulated_button_tab_unselected_idx,
+        i18n::localize(StringId::MISC), FONT_SIZE_11, COLOR_BLACK, &tabs, false));
     tabs[0]->setState(true);
 
     // First column of language buttons
@@ -449,22 +449,22 @@ void ConfigScreen::drawBottom() const
     // if (currentTab != 0)
     // {
     //     Gui::drawSolidRect(1, 2, 104, 17, COLOR_DARKBLUE);
-    //     Gui::text(i18n::localize("LANGUAGE"), 53, 2, FONT_SIZE_11, FONT_SIZE_11, COLOR_BLACK, TextPosX::CENTER, TextPosY::TOP);
+    //     Gui::text(i18n::localize(StringId::LANGUAGE), 53, 2, FONT_SIZE_11, FONT_SIZE_11, COLOR_BLACK, TextPosX::CENTER, TextPosY::TOP);
     // }
     // if (currentTab != 1)
     // {
     //     Gui::drawSolidRect(108, 2, 104, 17, COLOR_DARKBLUE);
-    //     Gui::text(i18n::localize("DEFAULTS"), 160, 2, FONT_SIZE_11, FONT_SIZE_11, COLOR_BLACK, TextPosX::CENTER, TextPosY::TOP);
+    //     Gui::text(i18n::localize(StringId::DEFAULTS), 160, 2, FONT_SIZE_11, FONT_SIZE_11, COLOR_BLACK, TextPosX::CENTER, TextPosY::TOP);
     // }
     // if (currentTab != 2)
     // {
     //     Gui::drawSolidRect(215, 2, 104, 17, COLOR_DARKBLUE);
-    //     Gui::text(i18n::localize("MISC"), 267, 2, FONT_SIZE_11, FONT_SIZE_11, COLOR_BLACK, TextPosX::CENTER, TextPosY::TOP);
+    //     Gui::text(i18n::localize(StringId::MISC), 267, 2, FONT_SIZE_11, FONT_SIZE_11, COLOR_BLACK, TextPosX::CENTER, TextPosY::TOP);
     // }
 
     if (currentTab == 0)
     {
-        // Gui::text(i18n::localize("LANGUAGE"), 53, 2, FONT_SIZE_11, FONT_SIZE_11, COLOR_WHITE, TextPosX::CENTER, TextPosY::TOP);
+        // Gui::text(i18n::localize(StringId::LANGUAGE), 53, 2, FONT_SIZE_11, FONT_SIZE_11, COLOR_WHITE, TextPosX::CENTER, TextPosY::TOP);
 
         Gui::text("日本語", 59, 47, FONT_SIZE_14, FONT_SIZE_14, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
         Gui::text("English", 59, 69, FONT_SIZE_14, FONT_SIZE_14, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
@@ -486,17 +486,17 @@ void ConfigScreen::drawBottom() const
     }
     else if (currentTab == 1)
     {
-        // Gui::text(i18n::localize("DEFAULTS"), 160, 2, FONT_SIZE_11, FONT_SIZE_11, COLOR_WHITE, TextPosX::CENTER, TextPosY::TOP);
-
-        Gui::text(i18n::localize("TID"), 19, 36, FONT_SIZE_12, FONT_SIZE_12, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
-        Gui::text(i18n::localize("SID"), 19, 57, FONT_SIZE_12, FONT_SIZE_12, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
-        Gui::text(i18n::localize("OT"), 19, 78, FONT_SIZE_12, FONT_SIZE_12, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
-        Gui::text(i18n::localize("3DS_REGION"), 19, 99, FONT_SIZE_12, FONT_SIZE_12, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
-        Gui::text(i18n::localize("COUNTRY"), 19, 120, FONT_SIZE_12, FONT_SIZE_12, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
-        Gui::text(i18n::localize("SUBREGION"), 19, 141, FONT_SIZE_12, FONT_SIZE_12, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
-        Gui::text(i18n::localize("DAY"), 19, 162, FONT_SIZE_12, FONT_SIZE_12, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
-        Gui::text(i18n::localize("MONTH"), 19, 183, FONT_SIZE_12, FONT_SIZE_12, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
-        Gui::text(i18n::localize("YEAR"), 19, 204, FONT_SIZE_12, FONT_SIZE_12, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
+        // Gui::text(i18n::localize(StringId::DEFAULTS), 160, 2, FONT_SIZE_11, FONT_SIZE_11, COLOR_WHITE, TextPosX::CENTER, TextPosY::TOP);
+
+        Gui::text(i18n::localize(StringId::TID), 19, 36, FONT_SIZE_12, FONT_SIZE_12, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
+        Gui::text(i18n::localize(StringId::SID), 19, 57, FONT_SIZE_12, FONT_SIZE_12, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
+        Gui::text(i18n::localize(StringId::OT), 19, 78, FONT_SIZE_12, FONT_SIZE_12, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
+        Gui::text(i18n::localize(StringId::_3DS_REGION), 19, 99, FONT_SIZE_12, FONT_SIZE_12, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
+        Gui::text(i18n::localize(StringId::COUNTRY), 19, 120, FONT_SIZE_12, FONT_SIZE_12, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
+        Gui::text(i18n::localize(StringId::SUBREGION), 19, 141, FONT_SIZE_12, FONT_SIZE_12, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
+        Gui::text(i18n::localize(StringId::DAY), 19, 162, FONT_SIZE_12, FONT_SIZE_12, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
+        Gui::text(i18n::localize(StringId::MONTH), 19, 183, FONT_SIZE_12, FONT_SIZE_12, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
+        Gui::text(i18n::localize(StringId::YEAR), 19, 204, FONT_SIZE_12, FONT_SIZE_12, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
 
         Gui::text(std::to_string(Configuration::getInstance().defaultTID()), 150, 36, FONT_SIZE_12, FONT_SIZE_12, COLOR_WHITE, TextPosX::LEFT,
             TextPosY::TOP);
@@ -551,54 +551,54 @@ void ConfigScreen::drawBottom() const
     }
     else if (currentTab == 2)
     {
-        // Gui::text(i18n::localize("MISC"), 215 + 104 / 2, 2, FONT_SIZE_11, FONT_SIZE_11, COLOR_WHITE, TextPosX::CENTER, TextPosY::TOP);
-
-        Gui::text(i18n::localize("CONFIG_BACKUP_SAVE"), 19, 36, FONT_SIZE_12, FONT_SIZE_12, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
-        Gui::text(i18n::localize("CONFIG_EDIT_TRANSFERS"), 19, 57, FONT_SIZE_12, FONT_SIZE_12, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
-        Gui::text(i18n::localize("CONFIG_BACKUP_INJECTION"), 19, 78, FONT_SIZE_12, FONT_SIZE_12, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
-        Gui::text(i18n::localize("CONFIG_SAVE_INFO"), 19, 99, FONT_SIZE_12, FONT_SIZE_12, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
-        Gui::text(i18n::localize("CONFIG_USE_EXTDATA"), 19, 120, FONT_SIZE_12, FONT_SIZE_12, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
-        Gui::text(i18n::localize("CONFIG_RANDOM_MUSIC"), 19, 141, FONT_SIZE_12, FONT_SIZE_12, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
-        Gui::text(i18n::localize("CONFIG_SHOW_BACKUPS"), 19, 162, FONT_SIZE_12, FONT_SIZE_12, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
-        Gui::text(i18n::localize("CONFIG_AUTO_UPDATE"), 19, 183, FONT_SIZE_12, FONT_SIZE_12, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
-        Gui::text(i18n::localize("EXTRA_SAVES"), 19, 204, FONT_SIZE_12, FONT_SIZE_12, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
+        // Gui::text(i18n::localize(StringId::MISC), 215 + 104 / 2, 2, FONT_SIZE_11, FONT_SIZE_11, COLOR_WHITE, TextPosX::CENTER, TextPosY::TOP);
+
+        Gui::text(i18n::localize(StringId::CONFIG_BACKUP_SAVE), 19, 36, FONT_SIZE_12, FONT_SIZE_12, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
+        Gui::text(i18n::localize(StringId::CONFIG_EDIT_TRANSFERS), 19, 57, FONT_SIZE_12, FONT_SIZE_12, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
+        Gui::text(i18n::localize(StringId::CONFIG_BACKUP_INJECTION), 19, 78, FONT_SIZE_12, FONT_SIZE_12, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
+        Gui::text(i18n::localize(StringId::CONFIG_SAVE_INFO), 19, 99, FONT_SIZE_12, FONT_SIZE_12, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
+        Gui::text(i18n::localize(StringId::CONFIG_USE_EXTDATA), 19, 120, FONT_SIZE_12, FONT_SIZE_12, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
+        Gui::text(i18n::localize(StringId::CONFIG_RANDOM_MUSIC), 19, 141, FONT_SIZE_12, FONT_SIZE_12, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
+        Gui::text(i18n::localize(StringId::CONFIG_SHOW_BACKUPS), 19, 162, FONT_SIZE_12, FONT_SIZE_12, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
+        Gui::text(i18n::localize(StringId::CONFIG_AUTO_UPDATE), 19, 183, FONT_SIZE_12, FONT_SIZE_12, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
+        Gui::text(i18n::localize(StringId::EXTRA_SAVES), 19, 204, FONT_SIZE_12, FONT_SIZE_12, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
 
         for (auto& button : tabButtons[currentTab])
         {
             button->draw();
         }
 
-        Gui::text(Configuration::getInstance().autoBackup() ? i18n::localize("YES") : i18n::localize("NO"), 270, 36, FONT_SIZE_12, FONT_SIZE_12,
-            COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
-        Gui::text(Configuration::getInstance().transferEdit() ? i18n::localize("YES") : i18n::localize("NO"), 270, 57, FONT_SIZE_12, FONT_SIZE_12,
-            COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
-        Gui::text(Configuration::getInstance().writeFileSave() ? i18n::localize("YES") : i18n::localize("NO"), 270, 78, FONT_SIZE_12, FONT_SIZE_12,
-            COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
-        Gui::text(Configuration::getInstance().useSaveInfo() ? i18n::localize("YES") : i18n::localize("NO"), 270, 99, FONT_SIZE_12, FONT_SIZE_12,
-            COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
-        Gui::text(Configuration::getInstance().useExtData() ? i18n::localize("YES") : i18n::localize("NO"), 270, 120, FONT_SIZE_12, FONT_SIZE_12,
-            COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
-        Gui::text(Configuration::getInstance().randomMusic() ? i18n::localize("YES") : i18n::localize("NO"), 270, 141, FONT_SIZE_12, FONT_SIZE_12,
-            COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
-        Gui::text(Configuration::getInstance().showBackups() ? i18n::localize("YES") : i18n::localize("NO"), 270, 162, FONT_SIZE_12, FONT_SIZE_12,
-            COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
-        Gui::text(Configuration::getInstance().autoUpdate() ? i18n::localize("YES") : i18n::localize("NO"), 270, 183, FONT_SIZE_12, FONT_SIZE_12,
-            COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
+        Gui::text(Configuration::getInstance().autoBackup() ? i18n::localize(StringId::YES) : i18n::localize(StringId::NO), 270, 36, FONT_SIZE_12,
+            FONT_SIZE_12, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
+        Gui::text(Configuration::getInstance().transferEdit() ? i18n::localize(StringId::YES) : i18n::localize(StringId::NO), 270, 57, FONT_SIZE_12,
+            FONT_SIZE_12, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
+        Gui::text(Configuration::getInstance().writeFileSave() ? i18n::localize(StringId::YES) : i18n::localize(StringId::NO), 270, 78, FONT_SIZE_12,
+            FONT_SIZE_12, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
+        Gui::text(Configuration::getInstance().useSaveInfo() ? i18n::localize(StringId::YES) : i18n::localize(StringId::NO), 270, 99, FONT_SIZE_12,
+            FONT_SIZE_12, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
+        Gui::text(Configuration::getInstance().useExtData() ? i18n::localize(StringId::YES) : i18n::localize(StringId::NO), 270, 120, FONT_SIZE_12,
+            FONT_SIZE_12, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
+        Gui::text(Configuration::getInstance().randomMusic() ? i18n::localize(StringId::YES) : i18n::localize(StringId::NO), 270, 141, FONT_SIZE_12,
+            FONT_SIZE_12, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
+        Gui::text(Configuration::getInstance().showBackups() ? i18n::localize(StringId::YES) : i18n::localize(StringId::NO), 270, 162, FONT_SIZE_12,
+            FONT_SIZE_12, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
+        Gui::text(Configuration::getInstance().autoUpdate() ? i18n::localize(StringId::YES) : i18n::localize(StringId::NO), 270, 183, FONT_SIZE_12,
+            FONT_SIZE_12, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
     }
     else if (currentTab == 3)
     {
         Gui::text("Patrons", 160, 24, FONT_SIZE_14, FONT_SIZE_14, COLOR_WHITE, TextPosX::CENTER, TextPosY::TOP);
 
-        Gui::text(i18n::localize("PATRON_CODE"), 19, 84, FONT_SIZE_14, FONT_SIZE_14, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
-        Gui::text(i18n::localize("ALPHA_UPDATES"), 19, 108, FONT_SIZE_14, FONT_SIZE_14, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
+        Gui::text(i18n::localize(StringId::PATRON_CODE), 19, 84, FONT_SIZE_14, FONT_SIZE_14, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
+        Gui::text(i18n::localize(StringId::ALPHA_UPDATES), 19, 108, FONT_SIZE_14, FONT_SIZE_14, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
 
         for (auto& button : tabButtons[currentTab])
         {
             button->draw();
         }
 
-        Gui::text(Configuration::getInstance().alphaChannel() ? i18n::localize("YES") : i18n::localize("NO"), 270, 108, FONT_SIZE_14, FONT_SIZE_14,
-            COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
+        Gui::text(Configuration::getInstance().alphaChannel() ? i18n::localize(StringId::YES) : i18n::localize(StringId::NO), 270, 108, FONT_SIZE_14,
+            FONT_SIZE_14, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
     }
 }
 
@@ -684,6 +684,10 @@ void ConfigScreen::update(touchPosition* touch)
 void ConfigScreen::back()
 {
     Configuration::getInstance().save();
+    // Drops the old UI language if it was changed
+    u8 saveLanguage = TitleLoader::save ? TitleLoader::save->language() : (u8)Language::UNUSED;
+    i18n::trim(saveLanguage);
+    i18n::load(saveLanguage);
     if (useExtDataChanged)
     {
         Banks::swapSD(!Configuration::getInstance().useExtData());
@@ -49,7 +49,7 @@ void EditSelectorScreen::changeBoxName()
                 swkbdInit(&state, SWKBD_TYPE_NORMAL, 2, 8);
                 first = false;
             }
-            swkbdSetHintText(&state, i18n::localize("BOX_NAME").c_str());
+            swkbdSetHintText(&state, i18n::localize(StringId::BOX_NAME).c_str());
             swkbdSetValidation(&state, SWKBD_NOTBLANK_NOTEMPTY, 0, 0);
             char input[18]  = {0};
             SwkbdButton ret = swkbdInputText(&state, input, sizeof(input));
@@ -71,7 +71,7 @@ void EditSelectorScreen::changeBoxName()
                 swkbdInit(&state, SWKBD_TYPE_NORMAL, 2, 16);
                 first = false;
             }
-            swkbdSetHintText(&state, i18n::localize("BOX_NAME").c_str());
+            swkbdSetHintText(&state, i18n::localize(StringId::BOX_NAME).c_str());
             swkbdSetValidation(&state, SWKBD_NOTBLANK_NOTEMPTY, 0, 0);
             char input[34]  = {0};
             SwkbdButton ret = swkbdInputText(&state, input, sizeof(input));
@@ -143,12 +143,13 @@ bool EditSelectorScreen::doQR()
     return true;
 }
 
-EditSelectorScreen::EditSelectorScreen() : Screen(i18n::localize("A_SELECT") + '\n' + i18n::localize("X_CLONE") + '\n' + i18n::localize("B_BACK"))
+EditSelectorScreen::EditSelectorScreen()
+    : Screen(i18n::localize(StringId::A_SELECT) + '\n' + i18n::localize(StringId::X_CLONE) + '\n' + i18n::localize(StringId::B_BACK))
 {
     addOverlay<ViewOverlay>(infoMon, false);
 
     buttons.push_back(std::make_unique<ClickButton>(283, 211, 34, 28, [this]() { return goBack(); }, ui_sheet_button_back_idx, "", 0.0f, 0));
-    instructions.addBox(false, 25, 15, 164, 24, COLOR_GREY, i18n::localize("A_BOX_NAME"), COLOR_WHITE);
+    instructions.addBox(false, 25, 15, 164, 24, COLOR_GREY, i18n::localize(StringId::A_BOX_NAME), COLOR_WHITE);
     buttons.push_back(std::make_unique<ClickButton>(25, 15, 164, 24, [this]() { return this->clickIndex(0); }, ui_sheet_res_null_idx, "", 0.0f, 0));
     buttons.push_back(std::make_unique<AccelButton>(8, 15, 17, 24, [this]() { return this->prevBox(); }, ui_sheet_res_null_idx, "", 0.0f, 0, 10, 5));
     buttons.push_back(
@@ -157,7 +158,8 @@ EditSelectorScreen::EditSelectorScreen() : Screen(i18n::localize("A_SELECT") + '
     instructions.addCircle(false, 310 - cameraButtonText->maxWidth(FONT_SIZE_14) / 2, 24, 8, COLOR_GREY);
     instructions.addLine(
         false, 310 - cameraButtonText->maxWidth(FONT_SIZE_14) / 2, 24, 310 - cameraButtonText->maxWidth(FONT_SIZE_14) / 2, 44, 4, COLOR_GREY);
-    instructions.addBox(false, 222 - cameraButtonText->maxWidth(FONT_SIZE_14) / 2, 44, 90, 16, COLOR_GREY, i18n::localize("QR_SCANNER"), COLOR_WHITE);
+    instructions.addBox(false, 222 - cameraButtonText->maxWidth(FONT_SIZE_14) / 2, 44, 90, 16, COLOR_GREY, i18n::localize(StringId::QR_SCANNER),
+        COLOR_WHITE);
     buttons.push_back(std::make_unique<ClickButton>(310 - cameraButtonText->maxWidth(FONT_SIZE_14), 16, cameraButtonText->maxWidth(FONT_SIZE_14) + 2,
         16, [this]() { return this->doQR(); }, ui_sheet_res_null_idx, "\uE004+\uE005 \uE01E", FONT_SIZE_14, COLOR_BLACK));
 
@@ -183,19 +185,19 @@ EditSelectorScreen::EditSelectorScreen() : Screen(i18n::localize("A_SELECT") + '
     }
 
     viewerButtons.push_back(std::make_unique<ClickButton>(212, 47, 108, 28, [this]() { return this->editPokemon(); }, ui_sheet_button_editor_idx,
-        "\uE000: " + i18n::localize("EDIT"), FONT_SIZE_12, COLOR_BLACK));
+        "\uE000: " + i18n::localize(StringId::EDIT), FONT_SIZE_12, COLOR_BLACK));
     viewerButtons.push_back(std::make_unique<ClickButton>(212, 78, 108, 28,
         [this]() {
             menu = false;
             return this->releasePokemon();
         },
-        ui_sheet_button_editor_idx, "\uE003: " + i18n::localize("RELEASE"), FONT_SIZE_12, COLOR_BLACK));
+        ui_sheet_button_editor_idx, "\uE003: " + i18n::localize(StringId::RELEASE), FONT_SIZE_12, COLOR_BLACK));
     viewerButtons.push_back(std::make_unique<ClickButton>(212, 109, 108, 28,
         [this]() {
             menu = false;
             return this->clonePkm();
         },
-        ui_sheet_button_editor_idx, "\uE002: " + i18n::localize("CLONE"), FONT_SIZE_12, COLOR_BLACK));
+        ui_sheet_button_editor_idx, "\uE002: " + i18n::localize(StringId::CLONE), FONT_SIZE_12, COLOR_BLACK));
     TitleLoader::save->cryptBoxData(true);
     box = TitleLoader::save->currentBox() % TitleLoader::save->maxBoxes();
 }
@@ -337,7 +339,7 @@ void EditSelectorScreen::drawBottom() const
 
     if (infoMon)
     {
-        Gui::text(StringUtils::format(i18n::localize("EDITOR_IDS"), infoMon->formatTID(), infoMon->formatSID(), infoMon->TSV()), 160, 224,
+        Gui::text(StringUtils::format(i18n::localize(StringId::EDITOR_IDS), infoMon->formatTID(), infoMon->formatSID(), infoMon->TSV()), 160, 224,
             FONT_SIZE_9, FONT_SIZE_9, COLOR_BLACK, TextPosX::CENTER, TextPosY::TOP);
     }
 
@@ -954,7 +956,7 @@ bool EditSelectorScreen::goBack()
 
 bool EditSelectorScreen::releasePokemon()
 {
-    if (cursorPos != 0 && Gui::showChoiceMessage(i18n::localize("BANK_CONFIRM_RELEASE")))
+    if (cursorPos != 0 && Gui::showChoiceMessage(i18n::localize(StringId::BANK_CONFIRM_RELEASE)))
     {
         if (cursorPos < 31 && box * 30 + cursorPos - 1 < TitleLoader::save->maxSlot())
         {
@@ -981,7 +983,7 @@ bool EditSelectorScreen::releasePokemon()
             }
             else
             {
-                Gui::warn(i18n::localize("NO_PARTY_EMPTY"));
+                Gui::warn(i18n::localize(StringId::NO_PARTY_EMPTY));
             }
         }
     }
@@ -197,7 +197,7 @@ EditorScreen::EditorScreen(std::shared_ptr<PKX> pokemon, int box, int index, boo
             case Generation::LGPE:
                 break; // Always a party Pokemon
             default:
-                Gui::warn(i18n::localize("THE_FUCK"));
+                Gui::warn(i18n::localize(StringId::THE_FUCK));
         }
 
         for (int i = 0; i < 6; i++)
@@ -215,13 +215,13 @@ EditorScreen::EditorScreen(std::shared_ptr<PKX> pokemon, int box, int index, boo
     buttons.push_back(NO_TEXT_CLICK(9, 211, 34, 28, [this]() { return this->goBack(); }, ui_sheet_button_back_idx));
     instructions.addCircle(false, 12, 11, 4, COLOR_GREY);
     instructions.addLine(false, 12, 11, 12, 43, 4, COLOR_GREY);
-    instructions.addBox(false, 10, 43, 50, 16, COLOR_GREY, i18n::localize("BALL"), COLOR_WHITE);
+    instructions.addBox(false, 10, 43, 50, 16, COLOR_GREY, i18n::localize(StringId::BALL), COLOR_WHITE);
     buttons.push_back(NO_TEXT_BUTTON(4, 3, 20, 19, [this]() { return this->selectBall(); }, ui_sheet_res_null_idx));
-    instructions.addBox(false, 224, 33, 60, 68, COLOR_GREY, i18n::localize("CHANGE_FORM"), COLOR_WHITE);
+    instructions.addBox(false, 224, 33, 60, 68, COLOR_GREY, i18n::localize(StringId::CHANGE_FORM), COLOR_WHITE);
     buttons.push_back(NO_TEXT_BUTTON(224, 33, 60, 68, [this]() { return this->selectForm(); }, ui_sheet_res_null_idx));
     instructions.addCircle(false, 305, 14, 11, COLOR_GREY);
     instructions.addLine(false, 305, 14, 305, 106, 4, COLOR_GREY);
-    instructions.addBox(false, 207, 106, 100, 16, COLOR_GREY, i18n::localize("HEX_EDIT"), COLOR_WHITE);
+    instructions.addBox(false, 207, 106, 100, 16, COLOR_GREY, i18n::localize(StringId::HEX_EDIT), COLOR_WHITE);
     buttons.push_back(NO_TEXT_BUTTON(291, 2, 27, 23, [this]() { return this->hexEdit(); }, ui_sheet_icon_hex_idx));
     buttons.push_back(NO_TEXT_ACCEL(94, 34, 13, 13, [this]() { return this->changeLevel(false); }, ui_sheet_button_minus_small_idx));
     buttons.push_back(NO_TEXT_BUTTON(109, 34, 31, 13,
@@ -267,38 +267,38 @@ EditorScreen::EditorScreen(std::shared_ptr<PKX> pokemon, int box, int index, boo
             justSwitched = true;
             return true;
         },
-        ui_sheet_button_editor_idx, i18n::localize("EDITOR_STATS"), FONT_SIZE_12, COLOR_BLACK));
+        ui_sheet_button_editor_idx, i18n::localize(StringId::EDITOR_STATS), FONT_SIZE_12, COLOR_BLACK));
     buttons.push_back(std::make_unique<Button>(204, 140, 108, 30,
         [this]() {
             Gui::setScreen(std::make_unique<MoveEditScreen>(pkm));
             justSwitched = true;
             return true;
         },
-        ui_sheet_button_editor_idx, i18n::localize("EDITOR_MOVES"), FONT_SIZE_12, COLOR_BLACK));
+        ui_sheet_button_editor_idx, i18n::localize(StringId::EDITOR_MOVES), FONT_SIZE_12, COLOR_BLACK));
     buttons.push_back(std::make_unique<Button>(204, 171, 108, 30,
         [this]() {
             Gui::setScreen(std::make_unique<MiscEditScreen>(pkm));
             justSwitched = true;
             return true;
         },
-        ui_sheet_button_editor_idx, i18n::localize("EDITOR_MISC"), FONT_SIZE_12, COLOR_BLACK));
+        ui_sheet_button_editor_idx, i18n::localize(StringId::EDITOR_MISC), FONT_SIZE_12, COLOR_BLACK));
     buttons.push_back(std::make_unique<ClickButton>(204, 202, 108, 30,
         [this]() {
             this->save();
             this->goBack();
             return true;
         },
-        ui_sheet_button_editor_idx, i18n::localize("EDITOR_SAVE"), FONT_SIZE_12, COLOR_BLACK));
-    instructions.addBox(false, 25, 5, 120, 15, COLOR_GREY, i18n::localize("CHANGE_SPECIES"), COLOR_WHITE);
+        ui_sheet_button_editor_idx, i18n::localize(StringId::EDITOR_SAVE), FONT_SIZE_12, COLOR_BLACK));
+    instructions.addBox(false, 25, 5, 120, 15, COLOR_GREY, i18n::localize(StringId::CHANGE_SPECIES), COLOR_WHITE);
     buttons.push_back(NO_TEXT_BUTTON(25, 5, 120, 13, [this]() { return this->selectSpecies(); }, ui_sheet_res_null_idx));
     instructions.addCircle(false, 192, 13, 6, COLOR_GREY);
     instructions.addLine(false, 192, 13, 192, 45, 4, COLOR_GREY);
-    instructions.addBox(false, 124, 43, 70, 16, COLOR_GREY, i18n::localize("GENDER"), COLOR_WHITE);
+    instructions.addBox(false, 124, 43, 70, 16, COLOR_GREY, i18n::localize(StringId::GENDER), COLOR_WHITE);
     buttons.push_back(NO_TEXT_CLICK(186, 7, 12, 12, [this]() { return this->genderSwitch(); }, ui_sheet_res_null_idx));
     instructions.addCircle(false, 260, 14, 11, COLOR_GREY);
     instructions.addLine(false, 214, 14, 260, 14, 4, COLOR_GREY);
     instructions.addLine(false, 216, 16, 216, 64, 4, COLOR_GREY);
-    instructions.addBox(false, 98, 64, 120, 16, COLOR_GREY, i18n::localize("SET_SAVE_INFO"), COLOR_WHITE);
+    instructions.addBox(false, 98, 64, 120, 16, COLOR_GREY, i18n::localize(StringId::SET_SAVE_INFO), COLOR_WHITE);
     buttons.push_back(NO_TEXT_CLICK(239, 3, 43, 22, [this]() { return this->setSaveInfo(); }, ui_sheet_button_trainer_info_idx));
 
     sha256(origHash.data(), pkm->rawData(), pkm->getLength());
@@ -324,15 +324,15 @@ void EditorScreen::drawBottom() const
         button->draw();
     }
 
-    Gui::text(i18n::localize("LEVEL"), 5, 32, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
-    Gui::text(i18n::localize("NATURE"), 5, 52, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
-    Gui::text(i18n::localize("ABILITY"), 5, 72, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
-    Gui::text(i18n::localize("ITEM"), 5, 92, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
-    Gui::text(i18n::localize("SHINY"), 5, 112, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
-    Gui::text(i18n::localize("POKERUS"), 5, 132, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
-    Gui::text(i18n::localize("OT"), 5, 152, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
-    Gui::text(i18n::localize("NICKNAME"), 5, 172, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
-    Gui::text(i18n::localize("FRIENDSHIP"), 5, 192, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
+    Gui::text(i18n::localize(StringId::LEVEL), 5, 32, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
+    Gui::text(i18n::localize(StringId::NATURE), 5, 52, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
+    Gui::text(i18n::localize(StringId::ABILITY), 5, 72, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
+    Gui::text(i18n::localize(StringId::ITEM), 5, 92, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
+    Gui::text(i18n::localize(StringId::SHINY), 5, 112, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
+    Gui::text(i18n::localize(StringId::POKERUS), 5, 132, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
+    Gui::text(i18n::localize(StringId::OT), 5, 152, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
+    Gui::text(i18n::localize(StringId::NICKNAME), 5, 172, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
+    Gui::text(i18n::localize(StringId::FRIENDSHIP), 5, 192, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
 
     Gui::ball(pkm->ball(), 4, 3);
     Gui::text(i18n::species(lang, pkm->species()), 25, 5, FONT_SIZE_12, FONT_SIZE_12, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
@@ -353,10 +353,10 @@ void EditorScreen::drawBottom() const
     Gui::text(i18n::nature(lang, pkm->nature()), 95, 52, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
     Gui::text(i18n::ability(lang, pkm->ability()), 95, 72, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
     Gui::text(i18n::item(lang, pkm->heldItem()), 95, 92, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
-    Gui::text(
-        pkm->shiny() ? i18n::localize("YES") : i18n::localize("NO"), 95, 112, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
-    Gui::text(pkm->pkrsDays() > 0 ? i18n::localize("YES") : i18n::localize("NO"), 95, 132, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK, TextPosX::LEFT,
-        TextPosY::TOP);
+    Gui::text(pkm->shiny() ? i18n::localize(StringId::YES) : i18n::localize(StringId::NO), 95, 112, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK,
+        TextPosX::LEFT, TextPosY::TOP);
+    Gui::text(pkm->pkrsDays() > 0 ? i18n::localize(StringId::YES) : i18n::localize(StringId::NO), 95, 132, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK,
+        TextPosX::LEFT, TextPosY::TOP);
     Gui::text(pkm->otName(), 95, 152, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
     Gui::text(pkm->nickname(), 95, 172, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
     Gui::text(
@@ -428,7 +428,7 @@ void EditorScreen::update(touchPosition* touch)
 
 bool EditorScreen::goBack()
 {
-    if (saved() || Gui::showChoiceMessage(i18n::localize("EDITOR_CHECK_EXIT")))
+    if (saved() || Gui::showChoiceMessage(i18n::localize(StringId::EDITOR_CHECK_EXIT)))
     {
         Gui::screenBack();
         TitleLoader::save->fixParty();
@@ -439,7 +439,7 @@ bool EditorScreen::goBack()
 
 bool EditorScreen::advanceMon(bool forward)
 {
-    if (saved() || Gui::showChoiceMessage(i18n::localize("EDITOR_CHECK_EXIT")))
+    if (saved() || Gui::showChoiceMessage(i18n::localize(StringId::EDITOR_CHECK_EXIT)))
     {
         TitleLoader::save->fixParty();
         do
@@ -565,7 +565,7 @@ void EditorScreen::setOT()
 {
     SwkbdState state;
     swkbdInit(&state, SWKBD_TYPE_NORMAL, 2, pkm->generation() == Generation::SIX || pkm->generation() == Generation::SEVEN ? 12 : (8 - 1));
-    swkbdSetHintText(&state, i18n::localize("OT_NAME").c_str());
+    swkbdSetHintText(&state, i18n::localize(StringId::OT_NAME).c_str());
     swkbdSetValidation(&state, SWKBD_NOTBLANK_NOTEMPTY, SWKBD_FILTER_PROFANITY, 0);
     char input[25]  = {0};
     SwkbdButton ret = swkbdInputText(&state, input, sizeof(input));
@@ -580,7 +580,7 @@ void EditorScreen::setNick()
 {
     SwkbdState state;
     swkbdInit(&state, SWKBD_TYPE_NORMAL, 2, pkm->generation() == Generation::SIX || pkm->generation() == Generation::SEVEN ? 12 : (11 - 1));
-    swkbdSetHintText(&state, i18n::localize("NICKNAME").c_str());
+    swkbdSetHintText(&state, i18n::localize(StringId::NICKNAME).c_str());
     swkbdSetValidation(&state, SWKBD_NOTBLANK_NOTEMPTY, SWKBD_FILTER_PROFANITY, 0);
     char input[25]  = {0};
     SwkbdButton ret = swkbdInputText(&state, input, sizeof(input));
@@ -29,7 +29,7 @@
 #include "gui.hpp"
 #include "loader.hpp"
 
-ExtraSavesScreen::ExtraSavesScreen() : Screen(i18n::localize("A_CHOOSE_GROUP") + '\n' + i18n::localize("B_BACK")) {}
+ExtraSavesScreen::ExtraSavesScreen() : Screen(i18n::localize(StringId::A_CHOOSE_GROUP) + '\n' + i18n::localize(StringId::B_BACK)) {}
 
 ExtraSavesScreen::~ExtraSavesScreen()
 {
@@ -112,7 +112,7 @@ void ExtraSavesScreen::drawTop() const
         Gui::drawSelector(149 + (saveGroup - 4) * 60, 127);
     }
 
-    Gui::text(i18n::localize("GROUP_CHOICE_INSTR"), 200, 8, FONT_SIZE_11, FONT_SIZE_11, COLOR_WHITE, TextPosX::CENTER, TextPosY::TOP);
+    Gui::text(i18n::localize(StringId::GROUP_CHOICE_INSTR), 200, 8, FONT_SIZE_11, FONT_SIZE_11, COLOR_WHITE, TextPosX::CENTER, TextPosY::TOP);
 }
 
 void ExtraSavesScreen::update(touchPosition* touch)
@@ -202,7 +202,8 @@ static constexpr int groupToGameId2(ExtraSavesSubScreen::Group g)
 }
 
 ExtraSavesSubScreen::ExtraSavesSubScreen(Group g)
-    : Screen(i18n::localize("A_ADD_SAVE") + '\n' + i18n::localize("X_DELETE_SAVE") + '\n' + i18n::localize("B_BACK")), group(g)
+    : Screen(i18n::localize(StringId::A_ADD_SAVE) + '\n' + i18n::localize(StringId::X_DELETE_SAVE) + '\n' + i18n::localize(StringId::B_BACK)),
+      group(g)
 {
     updateSaves();
 }
@@ -334,7 +335,7 @@ void ExtraSavesSubScreen::drawTop() const
         drawIcon(label, 176, 96);
         Gui::drawSelector(x - 1, 95);
     }
-    Gui::text(i18n::localize("EXTRA_SAVES"), 200, 12, FONT_SIZE_12, FONT_SIZE_12, COLOR_WHITE, TextPosX::CENTER, TextPosY::CENTER);
+    Gui::text(i18n::localize(StringId::EXTRA_SAVES), 200, 12, FONT_SIZE_12, FONT_SIZE_12, COLOR_WHITE, TextPosX::CENTER, TextPosY::CENTER);
 }
 
 void ExtraSavesSubScreen::update(touchPosition* touch)
@@ -463,7 +464,7 @@ void ExtraSavesSubScreen::update(touchPosition* touch)
         {
             entry = &currentSaves[selectedSave + firstSave];
         }
-        if (Gui::showChoiceMessage(i18n::localize("DELETE_EXTRASAVE_ENTRY"), "\'" + *entry + "\'"))
+        if (Gui::showChoiceMessage(i18n::localize(StringId::DELETE_EXTRASAVE_ENTRY), "\'" + *entry + "\'"))
         {
             if (group == ExtraSavesSubScreen::Group::Pt || group == ExtraSavesSubScreen::Group::DP || group == ExtraSavesSubScreen::Group::HGSS ||
                 group == ExtraSavesSubScreen::Group::BW || group == ExtraSavesSubScreen::Group::B2W2)
@@ -569,11 +570,12 @@ void ExtraSavesSubScreen::drawBottom() const
         Gui::drawSolidTriangle(189, 191, 197, 191, 193, 196, C2D_Color32(0x0f, 0x16, 0x59, 255));
     }
 
-    Gui::text(i18n::localize("A_ADD_SAVE"), 248, 113, FONT_SIZE_14, FONT_SIZE_14, COLOR_WHITE, TextPosX::CENTER, TextPosY::TOP);
-    Gui::text(i18n::localize("X_DELETE_SAVE"), 248, 172, FONT_SIZE_14, FONT_SIZE_14, COLOR_WHITE, TextPosX::CENTER, TextPosY::CENTER, 94);
+    Gui::text(i18n::localize(StringId::A_ADD_SAVE), 248, 113, FONT_SIZE_14, FONT_SIZE_14, COLOR_WHITE, TextPosX::CENTER, TextPosY::TOP);
+    Gui::text(i18n::localize(StringId::X_DELETE_SAVE), 248, 172, FONT_SIZE_14, FONT_SIZE_14, COLOR_WHITE, TextPosX::CENTER, TextPosY::CENTER, 94);
 
     Gui::text(
-        i18n::localize("EXTRASAVES_CONFIGURE_INSTRUCTIONS"), 160, 223, FONT_SIZE_11, FONT_SIZE_11, COLOR_WHITE, TextPosX::CENTER, TextPosY::TOP);
+        i18n::localize(StringId::EXTRASAVES_CONFIGURE_INSTRUCTIONS), 160, 223, FONT_SIZE_11, FONT_SIZE_11, COLOR_WHITE, TextPosX::CENTER,
+        TextPosY::TOP);
 
     Gui::drawSolidRect(245, 23, 48, 48, COLOR_BLACK);
     Gui::drawSolidRect(243, 21, 52, 52, C2D_Color32(15, 22, 89, 255));
@@ -34,7 +34,8 @@ static constexpr std::string_view langs[] = {"JPN", "ENG", "FRE", "ITA", "GER",
 
 InjectSelectorScreen::InjectSelectorScreen()
     : Screen(
-          i18n::localize("A_SELECT") + '\n' + i18n::localize("L_PAGE_PREV") + '\n' + i18n::localize("R_PAGE_NEXT") + '\n' + i18n::localize("B_BACK")),
+          i18n::localize(StringId::A_SELECT) + '\n' + i18n::localize(StringId::L_PAGE_PREV) + '\n' + i18n::localize(StringId::R_PAGE_NEXT) + '\n' +
+          i18n::localize(StringId::Y_SEARCH) + '\n' + i18n::localize(StringId::B_BACK)),
       hid(10, 2),
       dumpHid(40, 8)
 {
@@ -58,7 +59,7 @@ InjectSelectorScreen::InjectSelectorScreen()
     // QR
     instructions.addCircle(false, 160, 195, 11, COLOR_GREY);
     instructions.addLine(false, 160, 177, 160, 206, 4, COLOR_GREY);
-    instructions.addBox(false, 160 - 100 / 2, 177 - 23, 100, 23, COLOR_GREY, i18n::localize("QR_SCANNER"));
+    instructions.addBox(false, 160 - 100 / 2, 177 - 23, 100, 23, COLOR_GREY, i18n::localize(StringId::QR_SCANNER));
     buttons.push_back(std::make_unique<Button>(
         160 - 70 / 2, 207 - 23, 70, 23, [this]() { return this->doQR(); }, ui_sheet_emulated_button_qr_idx, "", FONT_SIZE_14, COLOR_WHITE));
     // Filter
@@ -77,7 +78,6 @@ InjectSelectorScreen::InjectSelectorScreen()
 
 InjectSelectorScreen::~InjectSelectorScreen()
 {
-    MysteryGift::exit();
     if (TitleLoader::save->generation() == Generation::FIVE)
     {
         if (TitleLoader::save->version() == 22 || TitleLoader::save->version() == 23)
@@ -112,17 +112,22 @@ void InjectSelectorScreen::update(touchPosition* touch)
             doQR();
             return;
         }
-        if (downKeys & KEY_A)
+        if (downKeys & KEY_A && hid.fullIndex() < wondercards.size())
         {
             Gui::setScreen(std::make_unique<InjectorScreen>(wondercards[hid.fullIndex()]));
             updateGifts = true;
             return;
         }
+        if (downKeys & KEY_Y)
+        {
+            searchBar();
+            return;
+        }
         if (downKeys & KEY_X)
         {
             if (TitleLoader::save->generation() == Generation::LGPE)
             {
-                Gui::warn(i18n::localize("WC_LGPE"), i18n::localize("NOT_A_BUG"));
+                Gui::warn(i18n::localize(StringId::WC_LGPE), i18n::localize(StringId::NOT_A_BUG));
             }
             else
             {
@@ -173,7 +178,8 @@ void InjectSelectorScreen::update(touchPosition* touch)
 void InjectSelectorScreen::drawBottom() const
 {
     Gui::backgroundBottom(true);
-    Gui::text(i18n::localize("WC_INST1"), 160, 222, FONT_SIZE_11, FONT_SIZE_11, C2D_Color32(197, 202, 233, 255), TextPosX::CENTER, TextPosY::TOP);
+    Gui::text(i18n::localize(StringId::WC_INST1), 160, 222, FONT_SIZE_11, FONT_SIZE_11, C2D_Color32(197, 202, 233, 255), TextPosX::CENTER,
+        TextPosY::TOP);
 
     Gui::sprite(ui_sheet_eventmenu_page_indicator_idx, 65, 13);
 
@@ -202,7 +208,7 @@ void InjectSelectorScreen::drawBottom() const
     if (dump)
     {
         Gui::drawSolidRect(0, 0, 320, 240, COLOR_MASKBLACK);
-        Gui::text(i18n::localize("WC_DUMP1"), 160, 107, FONT_SIZE_18, FONT_SIZE_18, COLOR_WHITE, TextPosX::CENTER, TextPosY::TOP);
+        Gui::text(i18n::localize(StringId::WC_DUMP1), 160, 107, FONT_SIZE_18, FONT_SIZE_18, COLOR_WHITE, TextPosX::CENTER, TextPosY::TOP);
     }
 }
 
@@ -213,7 +219,8 @@ void InjectSelectorScreen::drawTop() const
         Gui::backgroundTop(true);
 
         Gui::text(
-            i18n::localize("EVENT_DATABASE"), 200, 4, FONT_SIZE_14, FONT_SIZE_14, C2D_Color32(140, 158, 255, 255), TextPosX::CENTER, TextPosY::TOP);
+            i18n::localize(StringId::EVENT_DATABASE), 200, 4, FONT_SIZE_14, FONT_SIZE_14, C2D_Color32(140, 158, 255, 255), TextPosX::CENTER,
+            TextPosY::TOP);
 
         for (size_t i = 0; i < 10; i++)
         {
@@ -268,14 +275,14 @@ void InjectSelectorScreen::drawTop() const
             else
             {
                 MysteryGift::giftData data;
-                const std::string& lang = i18n::langString(Configuration::getInstance().language());
-                if (wondercards[i].find(lang) != wondercards[i].end())
+                Language lang = Configuration::getInstance().language();
+                if (wondercards[i].contains(lang))
                 {
-                    data = MysteryGift::wondercardInfo(wondercards[i][lang]);
+                    data = MysteryGift::wondercardInfo(wondercards[i].index(lang));
                 }
                 else
                 {
-                    data = MysteryGift::wondercardInfo(*wondercards[i].begin());
+                    data = MysteryGift::wondercardInfo(wondercards[i].index(wondercards[i].language()));
                 }
                 int x = i % 2 == 0 ? 21 : 201;
                 int y = 43 + ((i % 10) / 2) * 37;
@@ -435,7 +442,7 @@ void InjectSelectorScreen::dumpCard(void) const
             path += ".wb7";
             break;
         case Generation::UNUSED:
-            Gui::warn(i18n::localize("THE_FUCK"), i18n::localize("REPORT_THIS"));
+            Gui::warn(i18n::localize(StringId::THE_FUCK), i18n::localize(StringId::REPORT_THIS));
             return;
     }
     FSStream out(Archive::sd(), StringUtils::UTF8toUTF16(path), FS_OPEN_CREATE | FS_OPEN_WRITE, wc->size());
@@ -445,31 +452,51 @@ void InjectSelectorScreen::dumpCard(void) const
     }
     else
     {
-        Gui::error(i18n::localize("FAILED_OPEN_DUMP"), out.result());
+        Gui::error(i18n::localize(StringId::FAILED_OPEN_DUMP), out.result());
     }
     out.close();
 }
 
 bool InjectSelectorScreen::toggleFilter(const std::string& lang)
 {
-    if (langFilter != lang)
+    langFilter = langFilter != lang ? lang : "";
+    applyFilters();
+    return false;
+}
+
+void InjectSelectorScreen::searchBar()
+{
+    SwkbdState state;
+    swkbdInit(&state, SWKBD_TYPE_NORMAL, 2, 40);
+    swkbdSetHintText(&state, i18n::localize(StringId::SEARCH).c_str());
+    swkbdSetValidation(&state, SWKBD_ANYTHING, 0, 0);
+    swkbdSetInitialText(&state, searchString.c_str());
+    char input[81]  = {0};
+    SwkbdButton ret = swkbdInputText(&state, input, sizeof(input));
+    input[80]       = '\0';
+    if (ret == SWKBD_BUTTON_CONFIRM)
     {
-        wondercards = MysteryGift::wondercards();
-        for (size_t i = wondercards.size(); i > 0; i--)
-        {
-            if (!wondercards[i - 1].contains(lang))
-            {
-                wondercards.erase(wondercards.begin() + i - 1);
-            }
-        }
-        langFilter = lang;
+        searchString = input;
+        hid.select(0);
+        applyFilters();
     }
-    else
+}
+
+void InjectSelectorScreen::applyFilters()
+{
+    MysteryGift::giftQuery query;
+    query.text = searchString;
+    if (!langFilter.empty())
     {
-        wondercards = MysteryGift::wondercards();
-        langFilter  = "";
+        query.language = i18n::langFromString(langFilter);
+    }
+
+    const std::vector<MysteryGift::giftMatch>& all = MysteryGift::wondercards();
+    wondercards.clear();
+    for (size_t index : MysteryGift::search(query))
+    {
+        wondercards.push_back(all[index]);
     }
-    return false;
 }
 
 bool InjectSelectorScreen::toggleFilter(u8 type)
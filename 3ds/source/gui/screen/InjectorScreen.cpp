@@ -35,29 +35,26 @@ bool InjectorScreen::setLanguage(Language language)
     if (isLangAvailable(language))
     {
         lang       = language;
-        wondercard = MysteryGift::wondercard(ids[i18n::langString(lang)]);
+        wondercard = MysteryGift::wondercard(ids.index(lang));
 
         changeDate();
     }
     return false;
 }
 
-InjectorScreen::InjectorScreen(nlohmann::json ids)
+InjectorScreen::InjectorScreen(const MysteryGift::giftMatch& ids)
     : hid(40, 8), ids(ids), emptySlot(TitleLoader::save->emptyGiftLocation()), gifts(TitleLoader::save->currentGifts())
 {
-    const std::string& langString = i18n::langString(Configuration::getInstance().language());
-    if (ids.find(langString) != ids.end())
+    if (ids.contains(Configuration::getInstance().language()))
     {
-        wondercard = MysteryGift::wondercard(ids[langString]);
-        game       = MysteryGift::wondercardInfo(ids[langString]).game;
-        lang       = Configuration::getInstance().language();
+        lang = Configuration::getInstance().language();
     }
     else
     {
-        wondercard = MysteryGift::wondercard(*ids.begin());
-        game       = MysteryGift::wondercardInfo(*ids.begin()).game;
-        lang       = i18n::langFromString(ids.begin().key());
+        lang = ids.language();
     }
+    wondercard = MysteryGift::wondercard(ids.index(lang));
+    game       = MysteryGift::wondercardInfo(ids.index(lang)).game;
 
     slot          = emptySlot + 1;
     int langIndex = 1;
@@ -115,8 +112,9 @@ InjectorScreen::InjectorScreen(nlohmann::json ids)
 }
 
 InjectorScreen::InjectorScreen(std::unique_ptr<WCX> wcx)
-    : wondercard(std::move(wcx)), hid(40, 8), ids({}), emptySlot(TitleLoader::save->emptyGiftLocation()), gifts(TitleLoader::save->currentGifts())
+    : wondercard(std::move(wcx)), hid(40, 8), ids(), emptySlot(TitleLoader::save->emptyGiftLocation()), gifts(TitleLoader::save->currentGifts())
 {
+    ids.indices.fill(MysteryGift::giftMatch::NO_CARD);
     lang = Language::UNUSED;
 
     slot          = emptySlot + 1;
@@ -161,7 +159,7 @@ InjectorScreen::InjectorScreen(std::unique_ptr<WCX> wcx)
         [this]() {
             if (TitleLoader::save->generation() == Generation::LGPE)
             {
-                Gui::warn(i18n::localize("WC_LGPE"), i18n::localize("NOT_A_BUG"));
+                Gui::warn(i18n::localize(StringId::WC_LGPE), i18n::localize(StringId::NOT_A_BUG));
                 return false;
             }
             else
@@ -188,16 +186,16 @@ void InjectorScreen::drawBottom() const
     Gui::sprite(ui_sheet_bg_style_bottom_idx, 0, 0);
     Gui::sprite(ui_sheet_bar_bottom_red_idx, -3, 213);
     Gui::sprite(ui_sheet_stripe_wondercard_info_idx, 0, 14);
-    Gui::text(i18n::localize("WC_SWITCH"), 9, 15, FONT_SIZE_14, FONT_SIZE_14, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
+    Gui::text(i18n::localize(StringId::WC_SWITCH), 9, 15, FONT_SIZE_14, FONT_SIZE_14, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
 
     Gui::sprite(ui_sheet_point_big_idx, 15, 54);
-    Gui::text(i18n::localize("LANGUAGES"), 26, 49, FONT_SIZE_14, FONT_SIZE_14, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
+    Gui::text(i18n::localize(StringId::LANGUAGES), 26, 49, FONT_SIZE_14, FONT_SIZE_14, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
     Gui::sprite(ui_sheet_point_big_idx, 15, 110);
-    Gui::text(i18n::localize("OVERWRITE_WC"), 26, 105, FONT_SIZE_14, FONT_SIZE_14, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
+    Gui::text(i18n::localize(StringId::OVERWRITE_WC), 26, 105, FONT_SIZE_14, FONT_SIZE_14, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
     Gui::sprite(ui_sheet_point_big_idx, 15, 143);
-    Gui::text(i18n::localize("ADAPT_LANGUAGE"), 26, 138, FONT_SIZE_14, FONT_SIZE_14, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
+    Gui::text(i18n::localize(StringId::ADAPT_LANGUAGE), 26, 138, FONT_SIZE_14, FONT_SIZE_14, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
     Gui::sprite(ui_sheet_point_big_idx, 15, 176);
-    Gui::text(i18n::localize("INJECT_TO_SLOT"), 26, 171, FONT_SIZE_14, FONT_SIZE_14, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
+    Gui::text(i18n::localize(StringId::INJECT_TO_SLOT), 26, 171, FONT_SIZE_14, FONT_SIZE_14, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
 
     int langIndex = 1;
     for (int y = 46; y < 70; y += 23)
@@ -242,7 +240,7 @@ void InjectorScreen::drawBottom() const
         bool first = true;
         for (int x = 235; x < 274; x += 38)
         {
-            const std::string& word = first ? i18n::localize("YES") : i18n::localize("NO");
+            const std::string& word = first ? i18n::localize(StringId::YES) : i18n::localize(StringId::NO);
             if (overwriteCard)
             {
                 Gui::sprite(ui_sheet_emulated_button_selected_red_idx, x, y);
@@ -259,42 +257,42 @@ void InjectorScreen::drawBottom() const
     if (overwriteCard)
     {
         Gui::sprite(ui_sheet_emulated_button_selected_red_idx, 235, 103);
-        Gui::text(i18n::localize("YES"), 235 + 38 / 2, 106, FONT_SIZE_14, FONT_SIZE_14, COLOR_WHITE, TextPosX::CENTER, TextPosY::TOP);
+        Gui::text(i18n::localize(StringId::YES), 235 + 38 / 2, 106, FONT_SIZE_14, FONT_SIZE_14, COLOR_WHITE, TextPosX::CENTER, TextPosY::TOP);
         Gui::sprite(ui_sheet_emulated_button_unselected_red_idx, 273, 103);
-        Gui::text(i18n::localize("NO"), 273 + 38 / 2, 106, FONT_SIZE_14, FONT_SIZE_14, COLOR_BLACK, TextPosX::CENTER, TextPosY::TOP);
+        Gui::text(i18n::localize(StringId::NO), 273 + 38 / 2, 106, FONT_SIZE_14, FONT_SIZE_14, COLOR_BLACK, TextPosX::CENTER, TextPosY::TOP);
     }
     else
     {
         Gui::sprite(ui_sheet_emulated_button_unselected_red_idx, 235, 103);
-        Gui::text(i18n::localize("YES"), 235 + 38 / 2, 106, FONT_SIZE_14, FONT_SIZE_14, COLOR_BLACK, TextPosX::CENTER, TextPosY::TOP);
+        Gui::text(i18n::localize(StringId::YES), 235 + 38 / 2, 106, FONT_SIZE_14, FONT_SIZE_14, COLOR_BLACK, TextPosX::CENTER, TextPosY::TOP);
         Gui::sprite(ui_sheet_emulated_button_selected_red_idx, 273, 103);
-        Gui::text(i18n::localize("NO"), 273 + 38 / 2, 106, FONT_SIZE_14, FONT_SIZE_14, COLOR_WHITE, TextPosX::CENTER, TextPosY::TOP);
+        Gui::text(i18n::localize(StringId::NO), 273 + 38 / 2, 106, FONT_SIZE_14, FONT_SIZE_14, COLOR_WHITE, TextPosX::CENTER, TextPosY::TOP);
     }
 
     if (adaptLanguage)
     {
         Gui::sprite(ui_sheet_emulated_button_selected_red_idx, 235, 136);
-        Gui::text(i18n::localize("YES"), 235 + 38 / 2, 139, FONT_SIZE_14, FONT_SIZE_14, COLOR_WHITE, TextPosX::CENTER, TextPosY::TOP);
+        Gui::text(i18n::localize(StringId::YES), 235 + 38 / 2, 139, FONT_SIZE_14, FONT_SIZE_14, COLOR_WHITE, TextPosX::CENTER, TextPosY::TOP);
         Gui::sprite(ui_sheet_emulated_button_unselected_red_idx, 273, 136);
-        Gui::text(i18n::localize("NO"), 273 + 38 / 2, 139, FONT_SIZE_14, FONT_SIZE_14, COLOR_BLACK, TextPosX::CENTER, TextPosY::TOP);
+        Gui::text(i18n::localize(StringId::NO), 273 + 38 / 2, 139, FONT_SIZE_14, FONT_SIZE_14, COLOR_BLACK, TextPosX::CENTER, TextPosY::TOP);
     }
     else
     {
         Gui::sprite(ui_sheet_emulated_button_unselected_red_idx, 235, 136);
-        Gui::text(i18n::localize("YES"), 235 + 38 / 2, 139, FONT_SIZE_14, FONT_SIZE_14, COLOR_BLACK, TextPosX::CENTER, TextPosY::TOP);
+        Gui::text(i18n::localize(StringId::YES), 235 + 38 / 2, 139, FONT_SIZE_14, FONT_SIZE_14, COLOR_BLACK, TextPosX::CENTER, TextPosY::TOP);
         Gui::sprite(ui_sheet_emulated_button_selected_red_idx, 273, 136);
-        Gui::text(i18n::localize("NO"), 273 + 38 / 2, 139, FONT_SIZE_14, FONT_SIZE_14, COLOR_WHITE, TextPosX::CENTER, TextPosY::TOP);
+        Gui::text(i18n::localize(StringId::NO), 273 + 38 / 2, 139, FONT_SIZE_14, FONT_SIZE_14, COLOR_WHITE, TextPosX::CENTER, TextPosY::TOP);
     }
 
     Gui::text(std::to_string(slot), 255 + 38 / 2, 170, FONT_SIZE_14, FONT_SIZE_14, COLOR_BLACK, TextPosX::CENTER, TextPosY::TOP);
 
-    Gui::text(i18n::localize("START_TO_INJECT"), 160, 221, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK, TextPosX::CENTER, TextPosY::TOP);
+    Gui::text(i18n::localize(StringId::START_TO_INJECT), 160, 221, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK, TextPosX::CENTER, TextPosY::TOP);
 
     if (choosingSlot)
     {
         Gui::drawSolidRect(0, 0, 320, 240, COLOR_MASKBLACK);
-        Gui::text(i18n::localize("WC_CHANGE_SLOT"), 160, 100, FONT_SIZE_18, FONT_SIZE_18, COLOR_WHITE, TextPosX::CENTER, TextPosY::TOP);
-        Gui::text(i18n::localize("WC_DUMP2"), 160, 128, FONT_SIZE_18, FONT_SIZE_18, COLOR_WHITE, TextPosX::CENTER, TextPosY::TOP);
+        Gui::text(i18n::localize(StringId::WC_CHANGE_SLOT), 160, 100, FONT_SIZE_18, FONT_SIZE_18, COLOR_WHITE, TextPosX::CENTER, TextPosY::TOP);
+        Gui::text(i18n::localize(StringId::WC_DUMP2), 160, 128, FONT_SIZE_18, FONT_SIZE_18, COLOR_WHITE, TextPosX::CENTER, TextPosY::TOP);
     }
 }
 
@@ -338,13 +336,13 @@ void InjectorScreen::drawTop() const
         {
             Gui::sprite(ui_sheet_point_big_idx, 1, 40 + 20 * i);
         }
-        Gui::text(i18n::localize("SPECIES"), 9, 35, FONT_SIZE_14, FONT_SIZE_14, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
-        Gui::text(i18n::localize("LEVEL"), 9, 55, FONT_SIZE_14, FONT_SIZE_14, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
-        Gui::text(i18n::localize("HELD_ITEM"), 9, 75, FONT_SIZE_14, FONT_SIZE_14, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
-        Gui::text(i18n::localize("OT"), 9, 95, FONT_SIZE_14, FONT_SIZE_14, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
-        Gui::text(i18n::localize("TID_SID"), 9, 115, FONT_SIZE_14, FONT_SIZE_14, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
-        Gui::text(i18n::localize("GAME"), 9, 135, FONT_SIZE_14, FONT_SIZE_14, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
-        Gui::text(i18n::localize("DATE"), 9, 155, FONT_SIZE_14, FONT_SIZE_14, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
+        Gui::text(i18n::localize(StringId::SPECIES), 9, 35, FONT_SIZE_14, FONT_SIZE_14, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
+        Gui::text(i18n::localize(StringId::LEVEL), 9, 55, FONT_SIZE_14, FONT_SIZE_14, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
+        Gui::text(i18n::localize(StringId::HELD_ITEM), 9, 75, FONT_SIZE_14, FONT_SIZE_14, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
+        Gui::text(i18n::localize(StringId::OT), 9, 95, FONT_SIZE_14, FONT_SIZE_14, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
+        Gui::text(i18n::localize(StringId::TID_SID), 9, 115, FONT_SIZE_14, FONT_SIZE_14, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
+        Gui::text(i18n::localize(StringId::GAME), 9, 135, FONT_SIZE_14, FONT_SIZE_14, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
+        Gui::text(i18n::localize(StringId::DATE), 9, 155, FONT_SIZE_14, FONT_SIZE_14, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
         if (wondercard->pokemon())
         {
             Gui::text(i18n::species(Configuration::getInstance().language(), wondercard->species()), 87, 35, FONT_SIZE_14, FONT_SIZE_14, COLOR_BLACK,
@@ -354,7 +352,7 @@ void InjectorScreen::drawTop() const
                 TextPosX::LEFT, TextPosY::TOP);
             std::string text = wondercard->otName();
             u16 tid = wondercard->TID(), sid = wondercard->SID();
-            if (text == i18n::localize("YOUR_OT_NAME") || text == "")
+            if (text == i18n::localize(StringId::YOUR_OT_NAME) || text == "")
             {
                 text = TitleLoader::save->otName();
                 tid  = TitleLoader::save->TID();
@@ -368,7 +366,7 @@ void InjectorScreen::drawTop() const
             if (wondercard->generation() == Generation::SEVEN)
             {
                 Gui::sprite(ui_sheet_point_big_idx, 1, 180);
-                Gui::text(i18n::localize("ITEM"), 9, 175, FONT_SIZE_14, FONT_SIZE_14, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
+                Gui::text(i18n::localize(StringId::ITEM), 9, 175, FONT_SIZE_14, FONT_SIZE_14, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
                 u16 additionalItem = ((WC7*)wondercard.get())->additionalItem();
                 Gui::text(i18n::item(Configuration::getInstance().language(), additionalItem), 87, 175, FONT_SIZE_14, FONT_SIZE_14, COLOR_BLACK,
                     TextPosX::LEFT, TextPosY::TOP);
@@ -376,8 +374,8 @@ void InjectorScreen::drawTop() const
         }
         else if (wondercard->item())
         {
-            Gui::text(i18n::localize("NA"), 87, 35, FONT_SIZE_14, FONT_SIZE_14, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
-            Gui::text(i18n::localize("NA"), 87, 55, FONT_SIZE_14, FONT_SIZE_14, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
+            Gui::text(i18n::localize(StringId::NA), 87, 35, FONT_SIZE_14, FONT_SIZE_14, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
+            Gui::text(i18n::localize(StringId::NA), 87, 55, FONT_SIZE_14, FONT_SIZE_14, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
             const std::string* itemString = &i18n::item(Configuration::getInstance().language(), wondercard->object());
             std::string numString         = "";
             if (wondercard->generation() == Generation::SIX)
@@ -391,20 +389,20 @@ void InjectorScreen::drawTop() const
             }
             Gui::text(numString.empty() ? *itemString : *itemString + numString, 87, 75, FONT_SIZE_14, FONT_SIZE_14, COLOR_BLACK, TextPosX::LEFT,
                 TextPosY::TOP);
-            Gui::text(i18n::localize("NA"), 87, 95, FONT_SIZE_14, FONT_SIZE_14, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
-            Gui::text(i18n::localize("NA"), 87, 115, FONT_SIZE_14, FONT_SIZE_14, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
+            Gui::text(i18n::localize(StringId::NA), 87, 95, FONT_SIZE_14, FONT_SIZE_14, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
+            Gui::text(i18n::localize(StringId::NA), 87, 115, FONT_SIZE_14, FONT_SIZE_14, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
             Gui::text(game, 87, 135, FONT_SIZE_14, FONT_SIZE_14, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
-            Gui::text(i18n::localize("NA"), 87, 155, FONT_SIZE_14, FONT_SIZE_14, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
+            Gui::text(i18n::localize(StringId::NA), 87, 155, FONT_SIZE_14, FONT_SIZE_14, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
         }
         else if (wondercard->BP())
         {
-            Gui::text(i18n::localize("NA"), 87, 35, FONT_SIZE_14, FONT_SIZE_14, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
-            Gui::text(i18n::localize("NA"), 87, 55, FONT_SIZE_14, FONT_SIZE_14, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
-            Gui::text(i18n::localize("BP"), 87, 75, FONT_SIZE_14, FONT_SIZE_14, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
-            Gui::text(i18n::localize("NA"), 87, 95, FONT_SIZE_14, FONT_SIZE_14, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
-            Gui::text(i18n::localize("NA"), 87, 115, FONT_SIZE_14, FONT_SIZE_14, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
+            Gui::text(i18n::localize(StringId::NA), 87, 35, FONT_SIZE_14, FONT_SIZE_14, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
+            Gui::text(i18n::localize(StringId::NA), 87, 55, FONT_SIZE_14, FONT_SIZE_14, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
+            Gui::text(i18n::localize(StringId::BP), 87, 75, FONT_SIZE_14, FONT_SIZE_14, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
+            Gui::text(i18n::localize(StringId::NA), 87, 95, FONT_SIZE_14, FONT_SIZE_14, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
+            Gui::text(i18n::localize(StringId::NA), 87, 115, FONT_SIZE_14, FONT_SIZE_14, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
             Gui::text(game, 87, 135, FONT_SIZE_14, FONT_SIZE_14, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
-            Gui::text(i18n::localize("NA"), 87, 155, FONT_SIZE_14, FONT_SIZE_14, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
+            Gui::text(i18n::localize(StringId::NA), 87, 155, FONT_SIZE_14, FONT_SIZE_14, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
         }
         for (int i = 0; i < 3; i++)
         {
@@ -415,7 +413,7 @@ void InjectorScreen::drawTop() const
         {
             Gui::sprite(ui_sheet_point_small_idx, 238, 161 + 20 * i);
         }
-        Gui::text(i18n::localize("MOVES"), 251, 136, FONT_SIZE_14, FONT_SIZE_14, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
+        Gui::text(i18n::localize(StringId::MOVES), 251, 136, FONT_SIZE_14, FONT_SIZE_14, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
         for (int i = 0; i < 4; i++)
         {
             Gui::text(i18n::move(Configuration::getInstance().language(), wondercard->move(i)), 251, 156 + 20 * i, FONT_SIZE_14, FONT_SIZE_14,
@@ -539,7 +537,7 @@ void InjectorScreen::update(touchPosition* touch)
 
 bool InjectorScreen::isLangAvailable(Language l) const
 {
-    return ids.find(i18n::langString(l)) != ids.end();
+    return ids.contains(l);
 }
 
 void InjectorScreen::changeDate()
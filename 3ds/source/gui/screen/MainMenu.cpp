@@ -41,12 +41,12 @@ static bool goToScreen(int buttonNum)
         case 0:
             if (TitleLoader::save->generation() == Generation::LGPE)
             {
-                Gui::warn(i18n::localize("STORAGE_IMPLEMENTATION"), i18n::localize("STORAGE_CHECKBACK"));
+                Gui::warn(i18n::localize(StringId::STORAGE_IMPLEMENTATION), i18n::localize(StringId::STORAGE_CHECKBACK));
                 return false;
             }
             if (TitleLoader::save->partyCount() < 1)
             {
-                Gui::warn(i18n::localize("NEED_ONE_POKEMON"), i18n::localize("GET_STARTER"));
+                Gui::warn(i18n::localize(StringId::NEED_ONE_POKEMON), i18n::localize("GET_STARTER"));
                 return false;
             }
             Gui::setScreen(std::make_unique<StorageScreen>());
@@ -54,7 +54,7 @@ static bool goToScreen(int buttonNum)
         case 1:
             if (TitleLoader::save->partyCount() < 1)
             {
-                Gui::warn(i18n::localize("NEED_ONE_POKEMON"), i18n::localize("GET_STARTER"));
+                Gui::warn(i18n::localize(StringId::NEED_ONE_POKEMON), i18n::localize("GET_STARTER"));
                 return false;
             }
             Gui::setScreen(std::make_unique<EditSelectorScreen>());
@@ -62,7 +62,7 @@ static bool goToScreen(int buttonNum)
         case 2:
             if (TitleLoader::save->generation() == Generation::LGPE)
             {
-                Gui::warn(i18n::localize("NO_WONDERCARDS"));
+                Gui::warn(i18n::localize(StringId::NO_WONDERCARDS));
                 return false;
             }
             Gui::setScreen(std::make_unique<InjectSelectorScreen>());
@@ -100,7 +100,7 @@ MainMenu::~MainMenu()
 {
     if (isLoadedSaveFromBridge())
     {
-        if (Gui::showChoiceMessage(i18n::localize("BRIDGE_SHOULD_SEND_1"), i18n::localize("BRIDGE_SHOULD_SEND_2")))
+        if (Gui::showChoiceMessage(i18n::localize(StringId::BRIDGE_SHOULD_SEND_1), i18n::localize(StringId::BRIDGE_SHOULD_SEND_2)))
         {
             bool sent = sendSaveToBridge();
             if (!sent)
@@ -140,35 +140,35 @@ void MainMenu::drawTop() const
         switch (i)
         {
             case 0:
-                Gui::text(StringUtils::format(i18n::localize("GENERATION"), genToCstring(TitleLoader::save->generation())), 10, y, FONT_SIZE_12,
-                    FONT_SIZE_12, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
+                Gui::text(StringUtils::format(i18n::localize(StringId::GENERATION), genToCstring(TitleLoader::save->generation())), 10, y,
+                    FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
                 break;
             case 1:
-                Gui::text(StringUtils::format(i18n::localize("TRAINER_NAME"), TitleLoader::save->otName().c_str()), 10, y, FONT_SIZE_12, FONT_SIZE_12,
-                    COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
+                Gui::text(StringUtils::format(i18n::localize(StringId::TRAINER_NAME), TitleLoader::save->otName().c_str()), 10, y, FONT_SIZE_12,
+                    FONT_SIZE_12, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
                 break;
             case 2:
-                Gui::text(i18n::localize("TID_SID") + ": " + std::to_string(TitleLoader::save->displayTID()) + "/" +
+                Gui::text(i18n::localize(StringId::TID_SID) + ": " + std::to_string(TitleLoader::save->displayTID()) + "/" +
                               std::to_string(TitleLoader::save->displaySID()),
                     10, y, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
                 break;
             case 3:
-                Gui::text(
-                    StringUtils::format(TitleLoader::save->generation() == Generation::SEVEN ? i18n::localize("STAMPS") : i18n::localize("BADGES"),
-                        TitleLoader::save->badges()),
+                Gui::text(StringUtils::format(TitleLoader::save->generation() == Generation::SEVEN ? i18n::localize(StringId::STAMPS)
+                                                                                                    : i18n::localize(StringId::BADGES),
+                              TitleLoader::save->badges()),
                     10, y, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
                 break;
             case 4:
-                Gui::text(StringUtils::format(i18n::localize("WC_NUM"), TitleLoader::save->currentGifts().size()), 10, y, FONT_SIZE_12, FONT_SIZE_12,
-                    COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
+                Gui::text(StringUtils::format(i18n::localize(StringId::WC_NUM), TitleLoader::save->currentGifts().size()), 10, y, FONT_SIZE_12,
+                    FONT_SIZE_12, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
                 break;
             case 5:
-                Gui::text(StringUtils::format(i18n::localize("DEX_SEEN"), TitleLoader::save->dexSeen()), 10, y, FONT_SIZE_12, FONT_SIZE_12,
+                Gui::text(StringUtils::format(i18n::localize(StringId::DEX_SEEN), TitleLoader::save->dexSeen()), 10, y, FONT_SIZE_12, FONT_SIZE_12,
                     COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
                 break;
             case 6:
-                Gui::text(StringUtils::format(i18n::localize("DEX_CAUGHT"), TitleLoader::save->dexCaught()), 10, y, FONT_SIZE_12, FONT_SIZE_12,
-                    COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
+                Gui::text(StringUtils::format(i18n::localize(StringId::DEX_CAUGHT), TitleLoader::save->dexCaught()), 10, y, FONT_SIZE_12,
+                    FONT_SIZE_12, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
                 break;
             default:
                 break;
@@ -212,7 +212,8 @@ void MainMenu::update(touchPosition* touch)
     }
     if (keysDown() & KEY_B)
     {
-        if (Gui::showChoiceMessage(i18n::localize("SAVE_CHANGES_1"), i18n::localize("SAVE_CHANGES_2"), doTimer ? 250000000 : 0)) // Half second
+        if (Gui::showChoiceMessage(i18n::localize(StringId::SAVE_CHANGES_1), i18n::localize(StringId::SAVE_CHANGES_2),
+            doTimer ? 250000000 : 0)) // Half second
         {
             TitleLoader::saveChanges();
         }
@@ -53,7 +53,7 @@ MiscEditScreen::MiscEditScreen(std::shared_ptr<PKX> pkm) : pkm(pkm)
 
     instructions.addCircle(false, 22, 225, 8, COLOR_GREY);
     instructions.addLine(false, 22, 175, 22, 225, 4, COLOR_GREY);
-    instructions.addBox(false, 20, 175, 140, 18, COLOR_GREY, i18n::localize("Y_LEGALIZE"), COLOR_WHITE);
+    instructions.addBox(false, 20, 175, 140, 18, COLOR_GREY, i18n::localize(StringId::Y_LEGALIZE), COLOR_WHITE);
     buttons.push_back(std::make_unique<ClickButton>(3, 211, 34, 28,
         [this]() {
             validate();
@@ -162,20 +162,25 @@ void MiscEditScreen::drawBottom() const
         button->draw();
     }
 
-    Gui::text(i18n::localize(otAndMet ? "HT_EGG" : "OT_MET"), 254, 186, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK, TextPosX::CENTER, TextPosY::CENTER);
-    Gui::text(i18n::localize("MET_LEVEL"), 5, 32, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
-    Gui::text(i18n::localize(otAndMet ? "MET_DAY" : "EGG_DAY"), 5, 52, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
-    Gui::text(i18n::localize(otAndMet ? "MET_MONTH" : "EGG_MONTH"), 5, 72, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
-    Gui::text(i18n::localize(otAndMet ? "MET_YEAR" : "EGG_YEAR"), 5, 92, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
+    Gui::text(i18n::localize(otAndMet ? StringId::HT_EGG : StringId::OT_MET), 254, 186, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK, TextPosX::CENTER,
+        TextPosY::CENTER);
+    Gui::text(i18n::localize(StringId::MET_LEVEL), 5, 32, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
+    Gui::text(i18n::localize(otAndMet ? StringId::MET_DAY : StringId::EGG_DAY), 5, 52, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK, TextPosX::LEFT,
+        TextPosY::TOP);
+    Gui::text(i18n::localize(otAndMet ? StringId::MET_MONTH : StringId::EGG_MONTH), 5, 72, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK, TextPosX::LEFT,
+        TextPosY::TOP);
+    Gui::text(i18n::localize(otAndMet ? StringId::MET_YEAR : StringId::EGG_YEAR), 5, 92, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK, TextPosX::LEFT,
+        TextPosY::TOP);
     Gui::text(
-        i18n::localize(otAndMet ? "MET_LOCATION" : "EGG_LOCATION"), 5, 112, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
-    Gui::text(i18n::localize("ORIGIN_GAME"), 5, 132, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
+        i18n::localize(otAndMet ? StringId::MET_LOCATION : StringId::EGG_LOCATION), 5, 112, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK, TextPosX::LEFT,
+        TextPosY::TOP);
+    Gui::text(i18n::localize(StringId::ORIGIN_GAME), 5, 132, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
     if (pkm->generation() > Generation::FIVE)
     {
-        Gui::text(i18n::localize("ENJOYMENT"), 5, 152, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
-        Gui::text(i18n::localize("FULLNESS"), 5, 172, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
-        Gui::text(i18n::localize(otAndMet ? "OT_AFFECTION" : "HT_AFFECTION"), 5, 192, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK, TextPosX::LEFT,
-            TextPosY::TOP);
+        Gui::text(i18n::localize(StringId::ENJOYMENT), 5, 152, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
+        Gui::text(i18n::localize(StringId::FULLNESS), 5, 172, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
+        Gui::text(i18n::localize(otAndMet ? StringId::OT_AFFECTION : StringId::HT_AFFECTION), 5, 192, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK,
+            TextPosX::LEFT, TextPosY::TOP);
     }
 
     Gui::text(std::to_string((int)pkm->metLevel()), 107 + 35 / 2, 32, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK, TextPosX::CENTER, TextPosY::TOP);
@@ -686,7 +691,7 @@ void MiscEditScreen::validate()
         CURLcode res = fetch->perform();
         if (res != CURLE_OK)
         {
-            Gui::error(i18n::localize("CURL_ERROR"), abs(res));
+            Gui::error(i18n::localize(StringId::CURL_ERROR), abs(res));
         }
         else
         {
@@ -702,13 +707,13 @@ void MiscEditScreen::validate()
                     }
                     break;
                 case 400:
-                    Gui::error(i18n::localize("AUTO_LEGALIZE_ERROR"), abs(0x1337));
+                    Gui::error(i18n::localize(StringId::AUTO_LEGALIZE_ERROR), abs(0x1337));
                     break;
                 case 502:
-                    Gui::error(i18n::localize("HTTP_OFFLINE"), status_code);
+                    Gui::error(i18n::localize(StringId::HTTP_OFFLINE), status_code);
                     break;
                 default:
-                    Gui::error(i18n::localize("HTTP_UNKNOWN_ERROR"), status_code);
+                    Gui::error(i18n::localize(StringId::HTTP_UNKNOWN_ERROR), status_code);
                     break;
             }
         }
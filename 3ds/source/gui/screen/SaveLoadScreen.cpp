@@ -51,7 +51,8 @@ static constexpr std::string_view dsNames[] = {"Pt", "DP", "HGSS", "BW", "B2W2"}
 
 SaveLoadScreen::SaveLoadScreen()
     : Screen(
-          i18n::localize("A_SELECT") + '\n' + i18n::localize("X_SETTINGS") + '\n' + i18n::localize("Y_PRESENT") + '\n' + i18n::localize("START_EXIT"))
+          i18n::localize(StringId::A_SELECT) + '\n' + i18n::localize(StringId::X_SETTINGS) + '\n' + i18n::localize(StringId::Y_PRESENT) + '\n' +
+          i18n::localize(StringId::START_EXIT))
 {
     buttons.push_back(
         std::make_unique<AccelButton>(24, 96, 175, 16, [this]() { return this->setSelectedSave(0); }, ui_sheet_res_null_idx, "", 0.0f, 0, 10, 10));
@@ -267,7 +268,8 @@ void SaveLoadScreen::drawTop(void) const
         Gui::drawSelector(149 + (saveGroup - 4) * 60, 127);
     }
 
-    Gui::text(i18n::localize("LOADER_INSTRUCTIONS_TOP_PRESENT"), 200, 8, FONT_SIZE_11, FONT_SIZE_11, COLOR_WHITE, TextPosX::CENTER, TextPosY::TOP);
+    Gui::text(i18n::localize(StringId::LOADER_INSTRUCTIONS_TOP_PRESENT), 200, 8, FONT_SIZE_11, FONT_SIZE_11, COLOR_WHITE, TextPosX::CENTER,
+        TextPosY::TOP);
 }
 
 void SaveLoadScreen::drawBottom() const
@@ -311,10 +313,11 @@ void SaveLoadScreen::drawBottom() const
         Gui::drawSolidTriangle(189, 191, 197, 191, 193, 196, C2D_Color32(0x0f, 0x16, 0x59, 255));
     }
 
-    Gui::text(i18n::localize("LOADER_LOAD"), 248, 113, FONT_SIZE_14, FONT_SIZE_14, COLOR_WHITE, TextPosX::CENTER, TextPosY::TOP);
-    Gui::text(i18n::localize("LOADER_WIRELESS"), 248, 163, FONT_SIZE_14, FONT_SIZE_14, COLOR_WHITE, TextPosX::CENTER, TextPosY::TOP);
+    Gui::text(i18n::localize(StringId::LOADER_LOAD), 248, 113, FONT_SIZE_14, FONT_SIZE_14, COLOR_WHITE, TextPosX::CENTER, TextPosY::TOP);
+    Gui::text(i18n::localize(StringId::LOADER_WIRELESS), 248, 163, FONT_SIZE_14, FONT_SIZE_14, COLOR_WHITE, TextPosX::CENTER, TextPosY::TOP);
 
-    Gui::text(i18n::localize("LOADER_INSTRUCTIONS_BOTTOM"), 160, 223, FONT_SIZE_11, FONT_SIZE_11, COLOR_WHITE, TextPosX::CENTER, TextPosY::TOP);
+    Gui::text(i18n::localize(StringId::LOADER_INSTRUCTIONS_BOTTOM), 160, 223, FONT_SIZE_11, FONT_SIZE_11, COLOR_WHITE, TextPosX::CENTER,
+        TextPosY::TOP);
 
     Gui::drawSolidRect(245, 23, 48, 48, COLOR_BLACK);
     Gui::drawSolidRect(243, 21, 52, 52, C2D_Color32(15, 22, 89, 255));
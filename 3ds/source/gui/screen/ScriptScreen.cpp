@@ -115,7 +115,7 @@ void ScriptScreen::drawTop() const
 
     // Leaving space for the icon
     Gui::text(currDirString, 15, 2, FONT_SIZE_11, FONT_SIZE_11, COLOR_YELLOW, TextPosX::LEFT, TextPosY::TOP);
-    Gui::text(i18n::localize("SCRIPTS_INST1"), 200, 224, FONT_SIZE_9, FONT_SIZE_9, COLOR_WHITE, TextPosX::CENTER, TextPosY::TOP);
+    Gui::text(i18n::localize(StringId::SCRIPTS_INST1), 200, 224, FONT_SIZE_9, FONT_SIZE_9, COLOR_WHITE, TextPosX::CENTER, TextPosY::TOP);
 
     Gui::drawSolidRect(0, 20 + hid.index() * 25, 400, 25, C2D_Color32(128, 128, 128, 255));
     Gui::drawSolidRect(1, 21 + hid.index() * 25, 398, 23, COLOR_MASKBLACK);
@@ -140,7 +140,7 @@ void ScriptScreen::drawBottom() const
     Gui::backgroundBottom(true);
     Gui::drawSolidRect(20, 40, 280, 60, C2D_Color32(128, 128, 128, 255));
     Gui::drawSolidRect(21, 41, 278, 58, COLOR_MASKBLACK);
-    Gui::text(i18n::localize("SCRIPTS_INST2"), 160, 224, FONT_SIZE_9, FONT_SIZE_9, COLOR_WHITE, TextPosX::CENTER, TextPosY::TOP);
+    Gui::text(i18n::localize(StringId::SCRIPTS_INST2), 160, 224, FONT_SIZE_9, FONT_SIZE_9, COLOR_WHITE, TextPosX::CENTER, TextPosY::TOP);
 
     Gui::text(currFiles[hid.fullIndex()].first, 30, 44, FONT_SIZE_11, FONT_SIZE_11, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP, 260.0f);
 }
@@ -176,7 +176,7 @@ void ScriptScreen::update(touchPosition* touch)
             }
             else
             {
-                if (Gui::showChoiceMessage(i18n::localize("SCRIPTS_CONFIRM_USE"), '\'' + currFiles[hid.fullIndex()].first + '\''))
+                if (Gui::showChoiceMessage(i18n::localize(StringId::SCRIPTS_CONFIRM_USE), '\'' + currFiles[hid.fullIndex()].first + '\''))
                 {
                     applyScript();
                 }
@@ -197,7 +197,7 @@ void ScriptScreen::update(touchPosition* touch)
         }
         else
         {
-            Gui::warn("\"" + dirString + "\"", i18n::localize("SCRIPTS_NOT_FOUND"));
+            Gui::warn("\"" + dirString + "\"", i18n::localize(StringId::SCRIPTS_NOT_FOUND));
         }
     }
     else if (down & KEY_Y)
@@ -214,7 +214,7 @@ void ScriptScreen::update(touchPosition* touch)
         }
         else
         {
-            Gui::warn("\"" + dirString + "\"", i18n::localize("SCRIPTS_NOT_FOUND"));
+            Gui::warn("\"" + dirString + "\"", i18n::localize(StringId::SCRIPTS_NOT_FOUND));
         }
     }
 }
@@ -225,12 +225,12 @@ void ScriptScreen::updateEntries()
     currFiles.clear();
     if (!currDir.good())
     {
-        currFiles.push_back({i18n::localize("FOLDER_DOESNT_EXIST"), false});
+        currFiles.push_back({i18n::localize(StringId::FOLDER_DOESNT_EXIST), false});
         return;
     }
     if (currDir.count() == 0)
     {
-        currFiles.push_back({i18n::localize("EMPTY"), false});
+        currFiles.push_back({i18n::localize(StringId::EMPTY), false});
         return;
     }
     for (size_t i = 0; i < currDir.count(); i++)
@@ -272,7 +272,7 @@ static std::vector<u8> scriptRead(const std::string& path)
     }
     else
     {
-        Gui::error(i18n::localize("SCRIPTS_FAILED_OPEN"), errno);
+        Gui::error(i18n::localize(StringId::SCRIPTS_FAILED_OPEN), errno);
     }
     fclose(in);
 
@@ -298,7 +298,7 @@ void ScriptScreen::applyScript()
     {
         if (scriptData[i] != MAGIC[i])
         {
-            Gui::warn(i18n::localize("SCRIPTS_INVALID"));
+            Gui::warn(i18n::localize(StringId::SCRIPTS_INVALID));
             return;
         }
     }
@@ -348,6 +348,7 @@ void ScriptScreen::applyScript()
 
         index += 12 + length;
     }
+    TitleLoader::save->invalidateCache();
 }
 
 void ScriptScreen::parsePicoCScript(std::string& file)
@@ -375,6 +376,8 @@ void ScriptScreen::parsePicoCScript(std::string& file)
         args[2]            = &version;
         PicocCallMain(picoc, 3, args);
     }
+    // Scripts get the raw save buffer, so nothing cached can be trusted anymore
+    TitleLoader::save->invalidateCache();
 
     // Restore stdout state
     dup2(stdout_save, STDOUT_FILENO);
@@ -384,7 +387,7 @@ void ScriptScreen::parsePicoCScript(std::string& file)
         std::string show = error;
         if (!show.empty())
         {
-            Gui::warn(i18n::localize("SCRIPTS_EXECUTION_ERROR"), file);
+            Gui::warn(i18n::localize(StringId::SCRIPTS_EXECUTION_ERROR), file);
             show += "\nExit code: " + std::to_string(picoc->PicocExitValue);
             Gui::setScreen(std::make_unique<ScrollingTextScreen>(error, nullptr));
         }
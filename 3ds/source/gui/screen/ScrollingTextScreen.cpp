@@ -29,7 +29,7 @@
 #include "gui.hpp"
 
 ScrollingTextScreen::ScrollingTextScreen(const std::string& text, std::shared_ptr<PKX> pk)
-    : Screen(i18n::localize("UP_SCROLL_UP") + '\n' + i18n::localize("DOWN_SCROLL_DOWN") + '\n' + i18n::localize("B_BACK")),
+    : Screen(i18n::localize(StringId::UP_SCROLL_UP) + '\n' + i18n::localize(StringId::DOWN_SCROLL_DOWN) + '\n' + i18n::localize(StringId::B_BACK)),
       text(Gui::parseText(text, FONT_SIZE_12, 300.0f)),
       pkm(pk)
 {
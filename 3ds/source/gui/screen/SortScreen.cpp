@@ -48,7 +48,7 @@ SortScreen::SortScreen(bool storage) : storage(storage)
             Gui::screenBack();
             return true;
         },
-        ui_sheet_button_editor_idx, i18n::localize("SORT"), FONT_SIZE_12, COLOR_BLACK));
+        ui_sheet_button_editor_idx, i18n::localize(StringId::SORT), FONT_SIZE_12, COLOR_BLACK));
     buttons.push_back(std::make_unique<ClickButton>(1, 211, 34, 28,
         []() {
             Gui::screenBack();
@@ -142,6 +142,12 @@ void SortScreen::sort()
         {
             for (int i = 0; i < Banks::bank->boxes() * 30; i++)
             {
+                // Sorted Pokemon can end up in any box, and one that couldn't be read would drop them
+                if (i % 30 == 0 && !Banks::bank->boxReadable(i / 30))
+                {
+                    Gui::warn(i18n::localize(StringId::BANK_CORRUPT));
+                    return;
+                }
                 std::shared_ptr<PKX> pkm = Banks::bank->pkm(i / 30, i % 30);
                 if (pkm->species() != 0)
                 {
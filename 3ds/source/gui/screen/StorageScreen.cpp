@@ -62,7 +62,7 @@ void StorageScreen::setBoxName(bool storage)
             swkbdInit(&state, SWKBD_TYPE_NORMAL, 2, 20);
             first = false;
         }
-        swkbdSetHintText(&state, i18n::localize("BANK_BOX_NAME").c_str());
+        swkbdSetHintText(&state, i18n::localize(StringId::BANK_BOX_NAME).c_str());
         swkbdSetValidation(&state, SWKBD_NOTBLANK_NOTEMPTY, 0, 0);
         char input[41]  = {0};
         SwkbdButton ret = swkbdInputText(&state, input, sizeof(input));
@@ -86,7 +86,7 @@ void StorageScreen::setBoxName(bool storage)
                     swkbdInit(&state, SWKBD_TYPE_NORMAL, 2, 8);
                     first = false;
                 }
-                swkbdSetHintText(&state, i18n::localize("BOX_NAME").c_str());
+                swkbdSetHintText(&state, i18n::localize(StringId::BOX_NAME).c_str());
                 swkbdSetValidation(&state, SWKBD_NOTBLANK_NOTEMPTY, 0, 0);
                 char input[18]  = {0};
                 SwkbdButton ret = swkbdInputText(&state, input, sizeof(input));
@@ -108,7 +108,7 @@ void StorageScreen::setBoxName(bool storage)
                     swkbdInit(&state, SWKBD_TYPE_NORMAL, 2, 16);
                     first = false;
                 }
-                swkbdSetHintText(&state, i18n::localize("BOX_NAME").c_str());
+                swkbdSetHintText(&state, i18n::localize(StringId::BOX_NAME).c_str());
                 swkbdSetValidation(&state, SWKBD_NOTBLANK_NOTEMPTY, 0, 0);
                 char input[34]  = {0};
                 SwkbdButton ret = swkbdInputText(&state, input, sizeof(input));
@@ -129,26 +129,31 @@ void StorageScreen::setBoxName(bool storage)
 }
 
 StorageScreen::StorageScreen()
-    : Screen(i18n::localize("A_PICKUP") + '\n' + i18n::localize("X_CLONE") + '\n' + i18n::localize("Y_CURSOR_MODE") + '\n' +
-             i18n::localize("L_BOX_PREV") + '\n' + i18n::localize("R_BOX_NEXT") + '\n' + i18n::localize("START_EXTRA_FUNC") + '\n' +
-             i18n::localize("B_BACK"))
+    : Screen(i18n::localize(StringId::A_PICKUP) + '\n' + i18n::localize(StringId::X_CLONE) + '\n' + i18n::localize(StringId::Y_CURSOR_MODE) + '\n' +
+             i18n::localize(StringId::L_BOX_PREV) + '\n' + i18n::localize(StringId::R_BOX_NEXT) + '\n' + i18n::localize(StringId::START_EXTRA_FUNC) +
+             '\n' + i18n::localize(StringId::B_BACK))
 {
-    instructions.addBox(true, 69, 21, 156, 24, COLOR_GREY, i18n::localize("A_BOX_NAME"), COLOR_WHITE);
+    instructions.addBox(true, 69, 21, 156, 24, COLOR_GREY, i18n::localize(StringId::A_BOX_NAME), COLOR_WHITE);
     instructions.addCircle(false, 266, 23, 11, COLOR_GREY);
     instructions.addLine(false, 266, 23, 266, 73, 4, COLOR_GREY);
-    instructions.addBox(false, 148, 57, 120, 16, COLOR_GREY, i18n::localize("BOX_SWAP"), COLOR_WHITE);
+    instructions.addBox(false, 148, 57, 120, 16, COLOR_GREY, i18n::localize(StringId::BOX_SWAP), COLOR_WHITE);
     mainButtons[0] =
         std::make_unique<ClickButton>(242, 12, 47, 22, [this]() { return this->swapBoxWithStorage(); }, ui_sheet_button_swap_boxes_idx, "", 0.0f, 0);
     mainButtons[1] = std::make_unique<Button>(
-        212, 47, 108, 28, [this]() { return this->showViewer(); }, ui_sheet_button_editor_idx, i18n::localize("VIEW"), FONT_SIZE_12, COLOR_BLACK);
+        212, 47, 108, 28, [this]() { return this->showViewer(); }, ui_sheet_button_editor_idx, i18n::localize(StringId::VIEW), FONT_SIZE_12,
+        COLOR_BLACK);
     mainButtons[2] = std::make_unique<Button>(
-        212, 78, 108, 28, [this]() { return this->clearBox(); }, ui_sheet_button_editor_idx, i18n::localize("CLEAR"), FONT_SIZE_12, COLOR_BLACK);
+        212, 78, 108, 28, [this]() { return this->clearBox(); }, ui_sheet_button_editor_idx, i18n::localize(StringId::CLEAR), FONT_SIZE_12,
+        COLOR_BLACK);
     mainButtons[3] = std::make_unique<Button>(
-        212, 109, 108, 28, [this]() { return this->releasePkm(); }, ui_sheet_button_editor_idx, i18n::localize("RELEASE"), FONT_SIZE_12, COLOR_BLACK);
+        212, 109, 108, 28, [this]() { return this->releasePkm(); }, ui_sheet_button_editor_idx, i18n::localize(StringId::RELEASE), FONT_SIZE_12,
+        COLOR_BLACK);
     mainButtons[4] = std::make_unique<Button>(
-        212, 140, 108, 28, [this]() { return this->dumpPkm(); }, ui_sheet_button_editor_idx, i18n::localize("DUMP"), FONT_SIZE_12, COLOR_BLACK);
+        212, 140, 108, 28, [this]() { return this->dumpPkm(); }, ui_sheet_button_editor_idx, i18n::localize(StringId::DUMP), FONT_SIZE_12,
+        COLOR_BLACK);
     mainButtons[5] = std::make_unique<Button>(
-        212, 171, 108, 28, [this]() { return this->duplicate(); }, ui_sheet_button_editor_idx, i18n::localize("CLONE"), FONT_SIZE_12, COLOR_BLACK);
+        212, 171, 108, 28, [this]() { return this->duplicate(); }, ui_sheet_button_editor_idx, i18n::localize(StringId::CLONE), FONT_SIZE_12,
+        COLOR_BLACK);
     mainButtons[6] = std::make_unique<Button>(283, 211, 34, 28, [this]() { return this->backButton(); }, ui_sheet_button_back_idx, "", 0.0f, 0);
     mainButtons[7] =
         std::make_unique<AccelButton>(8, 15, 17, 24, [this]() { return this->prevBox(true); }, ui_sheet_res_null_idx, "", 0.0f, 0, 10, 5);
@@ -157,7 +162,7 @@ StorageScreen::StorageScreen()
 
     instructions.addCircle(false, 17, 225, 8, COLOR_GREY);
     instructions.addLine(false, 17, 175, 17, 225, 4, COLOR_GREY);
-    instructions.addBox(false, 15, 175, 120, 18, COLOR_GREY, i18n::localize("GPSS_BROWSE"), COLOR_WHITE);
+    instructions.addBox(false, 15, 175, 120, 18, COLOR_GREY, i18n::localize(StringId::GPSS_BROWSE), COLOR_WHITE);
     mainButtons[9] = std::make_unique<ClickButton>(3, 211, 28, 28,
         [this]() {
             Gui::setScreen(std::make_unique<CloudScreen>(storageBox, filter));
@@ -179,7 +184,7 @@ StorageScreen::StorageScreen()
         }
         y += 30;
     }
-    instructions.addBox(false, 25, 15, 164, 24, COLOR_GREY, i18n::localize("A_BOX_NAME"), COLOR_WHITE);
+    instructions.addBox(false, 25, 15, 164, 24, COLOR_GREY, i18n::localize(StringId::A_BOX_NAME), COLOR_WHITE);
     clickButtons[30] =
         std::make_unique<ClickButton>(25, 15, 164, 24, [this]() { return this->clickBottomIndex(0); }, ui_sheet_res_null_idx, "", 0.0f, 0);
     TitleLoader::save->cryptBoxData(true);
@@ -254,7 +259,7 @@ void StorageScreen::drawBottom() const
             }
             else
             {
-                std::shared_ptr<PKX> pokemon = TitleLoader::save->pkm(boxBox, row * 6 + column);
+                std::shared_ptr<const PKX> pokemon = TitleLoader::save->cachedPkm(boxBox, row * 6 + column);
                 if (pokemon->species() > 0)
                 {
                     float blend = *pokemon == *filter ? 0.0f : 0.5f;
@@ -379,7 +384,7 @@ void StorageScreen::drawTop() const
             {
                 Gui::drawSolidRect(x, y, 34, 30, C2D_Color32(0x50, 0xC0, 0x40, 0xC0));
             }
-            auto pkm = Banks::bank->pkm(storageBox, row * 6 + column);
+            auto pkm = Banks::bank->cachedPkm(storageBox, row * 6 + column);
             if (pkm->species() > 0)
             {
                 float blend = *pkm == *filter ? 0.0f : 0.5f;
@@ -472,7 +477,7 @@ void StorageScreen::drawTop() const
         Gui::text(infoMon->nickname(), 276, 61, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
         std::string info = "#" + std::to_string(infoMon->species());
         Gui::text(info, 273, 77, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
-        info      = i18n::localize("LV") + std::to_string(infoMon->level());
+        info      = i18n::localize(StringId::LV) + std::to_string(infoMon->level());
         auto text = Gui::parseText(info, FONT_SIZE_12, 0.0f);
         int width = text->maxWidth(FONT_SIZE_12);
         Gui::text(text, 375 - width, 77, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
@@ -514,12 +519,12 @@ void StorageScreen::drawTop() const
             Gui::type(Configuration::getInstance().language(), firstType, 300, 115);
         }
 
-        info = infoMon->otName() + '\n' + i18n::localize("LOADER_ID") + std::to_string(infoMon->versionTID());
+        info = infoMon->otName() + '\n' + i18n::localize(StringId::LOADER_ID) + std::to_string(infoMon->versionTID());
         Gui::text(info, 276, 141, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
 
         Gui::text(i18n::nature(Configuration::getInstance().language(), infoMon->nature()), 276, 181, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK,
             TextPosX::LEFT, TextPosY::TOP);
-        info  = i18n::localize("IV") + ": ";
+        info  = i18n::localize(StringId::IV) + ": ";
         text  = Gui::parseText(info, FONT_SIZE_12, 0.0f);
         width = text->maxWidth(FONT_SIZE_12);
         Gui::text(text, 276, 197, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
@@ -826,14 +831,14 @@ bool StorageScreen::backButton()
         }
         else if (!moveMon.empty())
         {
-            Gui::warn(i18n::localize("BANK_FAILED_EXIT"));
+            Gui::warn(i18n::localize(StringId::BANK_FAILED_EXIT));
         }
         else
         {
             bool timer = false;
             if (Banks::bank->hasChanged())
             {
-                if (Gui::showChoiceMessage(i18n::localize("BANK_SAVE_CHANGES")))
+                if (Gui::showChoiceMessage(i18n::localize(StringId::BANK_SAVE_CHANGES)))
                 {
                     Banks::bank->save();
                     timer = true;
@@ -869,7 +874,7 @@ bool StorageScreen::showViewer()
 bool StorageScreen::clearBox()
 {
     backHeld = true;
-    if (Gui::showChoiceMessage(i18n::localize("BANK_CONFIRM_CLEAR")))
+    if (Gui::showChoiceMessage(i18n::localize(StringId::BANK_CONFIRM_CLEAR)))
     {
         for (int i = 0; i < 30; i++)
         {
@@ -889,7 +894,7 @@ bool StorageScreen::clearBox()
 bool StorageScreen::releasePkm()
 {
     backHeld = true;
-    if (cursorIndex != 0 && Gui::showChoiceMessage(i18n::localize("BANK_CONFIRM_RELEASE")))
+    if (cursorIndex != 0 && Gui::showChoiceMessage(i18n::localize(StringId::BANK_CONFIRM_RELEASE)))
     {
         if (storageChosen)
         {
@@ -938,38 +943,38 @@ bool StorageScreen::isValidTransfer(std::shared_ptr<PKX> moveMon, bool bulkTrans
     if (moveBad)
     {
         if (!bulkTransfer)
-            Gui::warn(i18n::localize("STORAGE_BAD_TRANFER"), i18n::localize("STORAGE_BAD_MOVE"));
+            Gui::warn(i18n::localize(StringId::STORAGE_BAD_TRANFER), i18n::localize(StringId::STORAGE_BAD_MOVE));
         return false;
     }
     else if (moveMon->species() > TitleLoader::save->maxSpecies())
     {
         if (!bulkTransfer)
-            Gui::warn(i18n::localize("STORAGE_BAD_TRANFER"), i18n::localize("STORAGE_BAD_SPECIES"));
+            Gui::warn(i18n::localize(StringId::STORAGE_BAD_TRANFER), i18n::localize(StringId::STORAGE_BAD_SPECIES));
         return false;
     }
     else if (moveMon->alternativeForm() > TitleLoader::save->formCount(moveMon->species()) &&
              !((moveMon->species() == 664 || moveMon->species() == 665) && moveMon->alternativeForm() <= TitleLoader::save->formCount(666)))
     {
         if (!bulkTransfer)
-            Gui::warn(i18n::localize("STORAGE_BAD_TRANFER"), i18n::localize("STORAGE_BAD_FORM"));
+            Gui::warn(i18n::localize(StringId::STORAGE_BAD_TRANFER), i18n::localize(StringId::STORAGE_BAD_FORM));
         return false;
     }
     else if (moveMon->ability() > TitleLoader::save->maxAbility())
     {
         if (!bulkTransfer)
-            Gui::warn(i18n::localize("STORAGE_BAD_TRANFER"), i18n::localize("STORAGE_BAD_ABILITY"));
+            Gui::warn(i18n::localize(StringId::STORAGE_BAD_TRANFER), i18n::localize(StringId::STORAGE_BAD_ABILITY));
         return false;
     }
     else if (moveMon->heldItem() > TitleLoader::save->maxItem())
     {
         if (!bulkTransfer)
-            Gui::warn(i18n::localize("STORAGE_BAD_TRANFER"), i18n::localize("STORAGE_BAD_ITEM"));
+            Gui::warn(i18n::localize(StringId::STORAGE_BAD_TRANFER), i18n::localize(StringId::STORAGE_BAD_ITEM));
         return false;
     }
     else if (moveMon->ball() > TitleLoader::save->maxBall())
     {
         if (!bulkTransfer)
-            Gui::warn(i18n::localize("STORAGE_BAD_TRANFER"), i18n::localize("STORAGE_BAD_BALL"));
+            Gui::warn(i18n::localize(StringId::STORAGE_BAD_TRANFER), i18n::localize(StringId::STORAGE_BAD_BALL));
         return false;
     }
     return true;
@@ -979,6 +984,12 @@ void StorageScreen::pickup()
 {
     bool acceptGenChange = Configuration::getInstance().transferEdit();
     bool checkedWithUser = Configuration::getInstance().transferEdit();
+    // Whatever is put into a box that couldn't be read would be dropped
+    if (storageChosen && !Banks::bank->boxReadable(storageBox))
+    {
+        Gui::warn(i18n::localize(StringId::BANK_CORRUPT));
+        return;
+    }
     if (moveMon.empty())
     {
         if (pickupMode == MULTI)
@@ -1095,7 +1106,7 @@ void StorageScreen::pickup()
                     if (!checkedWithUser && moveMon[index]->generation() != TitleLoader::save->generation())
                     {
                         checkedWithUser = true;
-                        acceptGenChange = Gui::showChoiceMessage(i18n::localize("GEN_CHANGE_1"), i18n::localize("GEN_CHANGE_2"));
+                        acceptGenChange = Gui::showChoiceMessage(i18n::localize(StringId::GEN_CHANGE_1), i18n::localize(StringId::GEN_CHANGE_2));
                     }
                     std::shared_ptr<PKX> temPkm = TitleLoader::save->pkm(boxBox, cursorIndex - 1 + x + y * 6);
                     if (moveMon[index]->generation() == TitleLoader::save->generation() || acceptGenChange)
@@ -1161,7 +1172,7 @@ void StorageScreen::pickup()
                     return;
                 }
                 if ((Configuration::getInstance().transferEdit() || bankMon->generation() == TitleLoader::save->generation()) ||
-                    Gui::showChoiceMessage(i18n::localize("GEN_CHANGE_1"), i18n::localize("GEN_CHANGE_2")))
+                    Gui::showChoiceMessage(i18n::localize(StringId::GEN_CHANGE_1), i18n::localize(StringId::GEN_CHANGE_2)))
                 {
                     if (storageChosen)
                     {
@@ -1207,7 +1218,7 @@ void StorageScreen::pickup()
 
 bool StorageScreen::dumpPkm()
 {
-    if (cursorIndex != 0 && Gui::showChoiceMessage(i18n::localize("BANK_CONFIRM_DUMP")))
+    if (cursorIndex != 0 && Gui::showChoiceMessage(i18n::localize(StringId::BANK_CONFIRM_DUMP)))
     {
         char stringDate[12]   = {0};
         char stringTime[11]   = {0};
@@ -1241,7 +1252,7 @@ bool StorageScreen::dumpPkm()
                 }
                 else
                 {
-                    Gui::error(i18n::localize("FAILED_OPEN_DUMP"), out.result());
+                    Gui::error(i18n::localize(StringId::FAILED_OPEN_DUMP), out.result());
                 }
                 out.close();
             }
@@ -1264,7 +1275,7 @@ bool StorageScreen::dumpPkm()
                 }
                 else
                 {
-                    Gui::error(i18n::localize("FAILED_OPEN_DUMP"), out.result());
+                    Gui::error(i18n::localize(StringId::FAILED_OPEN_DUMP), out.result());
                 }
                 out.close();
             }
@@ -1305,6 +1316,11 @@ bool StorageScreen::duplicate()
 
 bool StorageScreen::swapBoxWithStorage()
 {
+    if (!Banks::bank->boxReadable(storageBox))
+    {
+        Gui::warn(i18n::localize(StringId::BANK_CORRUPT));
+        return false;
+    }
     std::vector<int> notGenMatch;
     bool acceptGenChange = Configuration::getInstance().transferEdit();
     bool checkedWithUser = Configuration::getInstance().transferEdit();
@@ -1322,7 +1338,7 @@ bool StorageScreen::swapBoxWithStorage()
         if (!checkedWithUser && temPkm->generation() != TitleLoader::save->generation())
         {
             checkedWithUser = true;
-            acceptGenChange = Gui::showChoiceMessage(i18n::localize("GEN_CHANGE_1"), i18n::localize("GEN_CHANGE_2"));
+            acceptGenChange = Gui::showChoiceMessage(i18n::localize(StringId::GEN_CHANGE_1), i18n::localize(StringId::GEN_CHANGE_2));
         }
         if (acceptGenChange || temPkm->generation() == TitleLoader::save->generation())
         {
@@ -1348,7 +1364,7 @@ bool StorageScreen::swapBoxWithStorage()
             unswapped += std::to_string(i) + ",";
         }
         unswapped.pop_back();
-        Gui::warn(i18n::localize("NO_SWAP_BULK"), unswapped);
+        Gui::warn(i18n::localize(StringId::NO_SWAP_BULK), unswapped);
     }
     return false;
 }
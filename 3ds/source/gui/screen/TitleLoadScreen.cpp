@@ -47,7 +47,8 @@ bool TitleLoadScreen::loadSave() const
 
 TitleLoadScreen::TitleLoadScreen()
     : Screen(
-          i18n::localize("A_SELECT") + '\n' + i18n::localize("X_SETTINGS") + '\n' + i18n::localize("Y_ABSENT") + '\n' + i18n::localize("START_EXIT"))
+          i18n::localize(StringId::A_SELECT) + '\n' + i18n::localize(StringId::X_SETTINGS) + '\n' + i18n::localize(StringId::Y_ABSENT) + '\n' +
+          i18n::localize(StringId::START_EXIT))
 {
     buttons.push_back(
         std::make_unique<AccelButton>(24, 96, 175, 16, [this]() { return this->setSelectedSave(0); }, ui_sheet_res_null_idx, "", 0.0f, 0, 10, 10));
@@ -95,10 +96,11 @@ void TitleLoadScreen::drawTop() const
         }
     }
 
-    Gui::text(i18n::localize("LOADER_INSTRUCTIONS_TOP_ABSENT"), 200, 8, FONT_SIZE_11, FONT_SIZE_11, COLOR_WHITE, TextPosX::CENTER, TextPosY::TOP);
-    Gui::text(i18n::localize("LOADER_GAME_CARD"), 4 + 120 / 2, 197, FONT_SIZE_14, FONT_SIZE_14, C2D_Color32(15, 22, 89, 255), TextPosX::CENTER,
+    Gui::text(i18n::localize(StringId::LOADER_INSTRUCTIONS_TOP_ABSENT), 200, 8, FONT_SIZE_11, FONT_SIZE_11, COLOR_WHITE, TextPosX::CENTER,
         TextPosY::TOP);
-    Gui::text(i18n::localize("LOADER_INSTALLED_GAMES"), 128 + 268 / 2, 197, FONT_SIZE_14, FONT_SIZE_14, C2D_Color32(15, 22, 89, 255),
+    Gui::text(i18n::localize(StringId::LOADER_GAME_CARD), 4 + 120 / 2, 197, FONT_SIZE_14, FONT_SIZE_14, C2D_Color32(15, 22, 89, 255),
+        TextPosX::CENTER, TextPosY::TOP);
+    Gui::text(i18n::localize(StringId::LOADER_INSTALLED_GAMES), 128 + 268 / 2, 197, FONT_SIZE_14, FONT_SIZE_14, C2D_Color32(15, 22, 89, 255),
         TextPosX::CENTER, TextPosY::TOP);
 }
 
@@ -107,11 +109,11 @@ void TitleLoadScreen::drawBottom() const
     Gui::backgroundBottom(true);
     Gui::sprite(ui_sheet_gameselector_savebox_idx, 22, 94);
 
-    auto text      = Gui::parseText(i18n::localize("LOADER_ID"), FONT_SIZE_11, 0.0f);
+    auto text      = Gui::parseText(i18n::localize(StringId::LOADER_ID), FONT_SIZE_11, 0.0f);
     int nextIdPart = 27 + text->maxWidth(FONT_SIZE_11);
     Gui::text(text, 27, 46, FONT_SIZE_11, FONT_SIZE_11, COLOR_LIGHTBLUE, TextPosX::LEFT, TextPosY::TOP);
 
-    text              = Gui::parseText(i18n::localize("LOADER_MEDIA_TYPE"), FONT_SIZE_11, 0.0f);
+    text              = Gui::parseText(i18n::localize(StringId::LOADER_MEDIA_TYPE), FONT_SIZE_11, 0.0f);
     int nextMediaPart = 27 + text->maxWidth(FONT_SIZE_11);
     Gui::text(text, 27, 58, FONT_SIZE_11, FONT_SIZE_11, COLOR_LIGHTBLUE, TextPosX::LEFT, TextPosY::TOP);
 
@@ -123,12 +125,12 @@ void TitleLoadScreen::drawBottom() const
         Gui::text(StringUtils::format("%08X", titleFromIndex(selectedTitle)->lowId()), nextIdPart, 46, FONT_SIZE_11, FONT_SIZE_11, COLOR_WHITE,
             TextPosX::LEFT, TextPosY::TOP);
 
-        Gui::text(selectedTitle == -1 ? i18n::localize("LOADER_CARTRIDGE") : i18n::localize("LOADER_SD"), nextMediaPart, 58, FONT_SIZE_11,
-            FONT_SIZE_11, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
+        Gui::text(selectedTitle == -1 ? i18n::localize(StringId::LOADER_CARTRIDGE) : i18n::localize(StringId::LOADER_SD), nextMediaPart, 58,
+            FONT_SIZE_11, FONT_SIZE_11, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
     }
     else
     {
-        Gui::text(i18n::localize("NONE"), 27, 26, FONT_SIZE_14, FONT_SIZE_14, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
+        Gui::text(i18n::localize(StringId::NONE), 27, 26, FONT_SIZE_14, FONT_SIZE_14, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
     }
 
     if (selectedSave > -1)
@@ -141,7 +143,7 @@ void TitleLoadScreen::drawBottom() const
     {
         if (i == -1)
         {
-            Gui::text(i18n::localize("LOADER_GAME_SAVE"), 29, y, FONT_SIZE_11, FONT_SIZE_11, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
+            Gui::text(i18n::localize(StringId::LOADER_GAME_SAVE), 29, y, FONT_SIZE_11, FONT_SIZE_11, COLOR_WHITE, TextPosX::LEFT, TextPosY::TOP);
         }
         else if (i < (int)availableCheckpointSaves.size())
         {
@@ -168,10 +170,11 @@ void TitleLoadScreen::drawBottom() const
         Gui::drawSolidTriangle(189, 191, 197, 191, 193, 196, C2D_Color32(0x0f, 0x16, 0x59, 255));
     }
 
-    Gui::text(i18n::localize("LOADER_LOAD"), 200 + 96 / 2, 113, FONT_SIZE_14, FONT_SIZE_14, COLOR_WHITE, TextPosX::CENTER, TextPosY::TOP);
-    Gui::text(i18n::localize("LOADER_WIRELESS"), 200 + 96 / 2, 163, FONT_SIZE_14, FONT_SIZE_14, COLOR_WHITE, TextPosX::CENTER, TextPosY::TOP);
+    Gui::text(i18n::localize(StringId::LOADER_LOAD), 200 + 96 / 2, 113, FONT_SIZE_14, FONT_SIZE_14, COLOR_WHITE, TextPosX::CENTER, TextPosY::TOP);
+    Gui::text(i18n::localize(StringId::LOADER_WIRELESS), 200 + 96 / 2, 163, FONT_SIZE_14, FONT_SIZE_14, COLOR_WHITE, TextPosX::CENTER, TextPosY::TOP);
 
-    Gui::text(i18n::localize("LOADER_INSTRUCTIONS_BOTTOM"), 160, 223, FONT_SIZE_11, FONT_SIZE_11, COLOR_WHITE, TextPosX::CENTER, TextPosY::TOP);
+    Gui::text(i18n::localize(StringId::LOADER_INSTRUCTIONS_BOTTOM), 160, 223, FONT_SIZE_11, FONT_SIZE_11, COLOR_WHITE, TextPosX::CENTER,
+        TextPosY::TOP);
 }
 
 void TitleLoadScreen::update(touchPosition* touch)
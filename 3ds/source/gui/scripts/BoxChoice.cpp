@@ -41,7 +41,8 @@ static bool backHeld = false;
 BoxChoice::BoxChoice(bool doCrypt) : doCrypt(doCrypt)
 {
     mainButtons[0] = std::make_unique<Button>(
-        212, 47, 108, 28, [this]() { return this->showViewer(); }, ui_sheet_button_editor_idx, i18n::localize("VIEW"), FONT_SIZE_12, COLOR_BLACK);
+        212, 47, 108, 28, [this]() { return this->showViewer(); }, ui_sheet_button_editor_idx, i18n::localize(StringId::VIEW), FONT_SIZE_12,
+        COLOR_BLACK);
     mainButtons[1] = std::make_unique<Button>(4, 212, 33, 28, [this]() { return false; }, ui_sheet_res_null_idx, "", 0.0f, 0);
     mainButtons[2] = std::make_unique<Button>(283, 211, 34, 28, [this]() { return this->backButton(); }, ui_sheet_button_back_idx, "", 0.0f, 0);
     mainButtons[3] =
@@ -205,7 +206,7 @@ void BoxChoice::drawTop() const
             Gui::text(infoMon->nickname(), 276, 61, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
             std::string info = "#" + std::to_string(infoMon->species());
             Gui::text(info, 273, 77, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
-            info      = i18n::localize("LV") + std::to_string(infoMon->level());
+            info      = i18n::localize(StringId::LV) + std::to_string(infoMon->level());
             auto text = Gui::parseText(info, FONT_SIZE_12, 0.0f);
             int width = text->maxWidth(FONT_SIZE_12);
             Gui::text(text, 375 - width, 77, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
@@ -247,12 +248,12 @@ void BoxChoice::drawTop() const
                 Gui::type(Configuration::getInstance().language(), firstType, 300, 115);
             }
 
-            info = infoMon->otName() + '\n' + i18n::localize("LOADER_ID") + std::to_string(infoMon->TID());
+            info = infoMon->otName() + '\n' + i18n::localize(StringId::LOADER_ID) + std::to_string(infoMon->TID());
             Gui::text(info, 276, 141, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
 
             Gui::text(i18n::nature(Configuration::getInstance().language(), infoMon->nature()), 276, 181, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK,
                 TextPosX::LEFT, TextPosY::TOP);
-            info  = i18n::localize("IV") + ": ";
+            info  = i18n::localize(StringId::IV) + ": ";
             text  = Gui::parseText(info, FONT_SIZE_12, 0.0f);
             width = text->maxWidth(FONT_SIZE_12);
             Gui::text(text, 276, 197, FONT_SIZE_12, FONT_SIZE_12, COLOR_BLACK, TextPosX::LEFT, TextPosY::TOP);
@@ -317,32 +317,32 @@ void sav_inject_pkx(struct ParseState* Parser, struct Value* ReturnValue, struct
             }
             if (pkm->species() > TitleLoader::save->maxSpecies())
             {
-                Gui::warn(i18n::localize("STORAGE_BAD_TRANFER"), i18n::localize("STORAGE_BAD_SPECIES"));
+                Gui::warn(i18n::localize(StringId::STORAGE_BAD_TRANFER), i18n::localize(StringId::STORAGE_BAD_SPECIES));
                 return;
             }
             else if (pkm->alternativeForm() > TitleLoader::save->formCount(pkm->species()))
             {
-                Gui::warn(i18n::localize("STORAGE_BAD_TRANFER"), i18n::localize("STORAGE_BAD_FORM"));
+                Gui::warn(i18n::localize(StringId::STORAGE_BAD_TRANFER), i18n::localize(StringId::STORAGE_BAD_FORM));
                 return;
             }
             else if (pkm->ability() > TitleLoader::save->maxAbility())
             {
-                Gui::warn(i18n::localize("STORAGE_BAD_TRANFER"), i18n::localize("STORAGE_BAD_ABILITY"));
+                Gui::warn(i18n::localize(StringId::STORAGE_BAD_TRANFER), i18n::localize(StringId::STORAGE_BAD_ABILITY));
                 return;
             }
             else if (pkm->heldItem() > TitleLoader::save->maxItem())
             {
-                Gui::warn(i18n::localize("STORAGE_BAD_TRANFER"), i18n::localize("STORAGE_BAD_ITEM"));
+                Gui::warn(i18n::localize(StringId::STORAGE_BAD_TRANFER), i18n::localize(StringId::STORAGE_BAD_ITEM));
                 return;
             }
             else if (pkm->ball() > TitleLoader::save->maxBall())
             {
-                Gui::warn(i18n::localize("STORAGE_BAD_TRANFER"), i18n::localize("STORAGE_BAD_BALL"));
+                Gui::warn(i18n::localize(StringId::STORAGE_BAD_TRANFER), i18n::localize(StringId::STORAGE_BAD_BALL));
                 return;
             }
             else if (moveBad)
             {
-                Gui::warn(i18n::localize("STORAGE_BAD_TRANFER"), i18n::localize("STORAGE_BAD_MOVE"));
+                Gui::warn(i18n::localize(StringId::STORAGE_BAD_TRANFER), i18n::localize(StringId::STORAGE_BAD_MOVE));
                 return;
             }
             TitleLoader::save->pkm(pkm, box, slot, doTradeEdits);
@@ -606,6 +606,46 @@ void i18n_species(struct ParseState* Parser, struct Value* ReturnValue, struct V
     ReturnValue->Val->Pointer = (void*)i18n::species(Configuration::getInstance().language(), Param[0]->Val->Integer).c_str();
 }
 
+void i18n_search(struct ParseState* Parser, struct Value* ReturnValue, struct Value** Param, int NumArgs)
+{
+    SEARCH_CATEGORY category = (SEARCH_CATEGORY)Param[0]->Val->Integer;
+    Generation gen           = Generation(Param[1]->Val->Integer);
+    std::string query        = (char*)Param[2]->Val->Pointer;
+    bool substring           = Param[3]->Val->Integer;
+    int* out                 = (int*)Param[4]->Val->Pointer;
+    int max                  = Param[5]->Val->Integer;
+    u8 lang                  = Configuration::getInstance().language();
+
+    const SearchIndex* index;
+    switch (category)
+    {
+        case SEARCH_SPECIES:
+            index = &i18n::searchIndex(lang, SearchCategory::SPECIES);
+            break;
+        case SEARCH_MOVES:
+            index = &i18n::searchIndex(lang, SearchCategory::MOVES);
+            break;
+        case SEARCH_ITEMS:
+            index = &i18n::searchIndex(lang, SearchCategory::ITEMS);
+            break;
+        case SEARCH_LOCATIONS:
+            checkGen(Parser, gen);
+            index = &i18n::locationIndex(lang, gen);
+            break;
+        default:
+            ProgramFail(Parser, "Search category is not possible!");
+            return;
+    }
+
+    // Returns how many matched, which may be more than fit in out
+    std::vector<u16> matches = substring ? index->substring(query) : index->prefix(query);
+    for (int i = 0; i < std::min(max, (int)matches.size()); i++)
+    {
+        out[i] = matches[i];
+    }
+    ReturnValue->Val->Integer = matches.size();
+}
+
 void pkx_decrypt(struct ParseState* Parser, struct Value* ReturnValue, struct Value** Param, int NumArgs)
 {
     u8* data       = (u8*)Param[0]->Val->Pointer;
@@ -751,32 +791,32 @@ void party_inject_pkx(struct ParseState* Parser, struct Value* ReturnValue, stru
             }
             if (pkm->species() > TitleLoader::save->maxSpecies())
             {
-                Gui::warn(i18n::localize("STORAGE_BAD_TRANFER"), i18n::localize("STORAGE_BAD_SPECIES"));
+                Gui::warn(i18n::localize(StringId::STORAGE_BAD_TRANFER), i18n::localize(StringId::STORAGE_BAD_SPECIES));
                 return;
             }
             else if (pkm->alternativeForm() > TitleLoader::save->formCount(pkm->species()))
             {
-                Gui::warn(i18n::localize("STORAGE_BAD_TRANFER"), i18n::localize("STORAGE_BAD_FORM"));
+                Gui::warn(i18n::localize(StringId::STORAGE_BAD_TRANFER), i18n::localize(StringId::STORAGE_BAD_FORM));
                 return;
             }
             else if (pkm->ability() > TitleLoader::save->maxAbility())
             {
-                Gui::warn(i18n::localize("STORAGE_BAD_TRANFER"), i18n::localize("STORAGE_BAD_ABILITY"));
+                Gui::warn(i18n::localize(StringId::STORAGE_BAD_TRANFER), i18n::localize(StringId::STORAGE_BAD_ABILITY));
                 return;
             }
             else if (pkm->heldItem() > TitleLoader::save->maxItem())
             {
-                Gui::warn(i18n::localize("STORAGE_BAD_TRANFER"), i18n::localize("STORAGE_BAD_ITEM"));
+                Gui::warn(i18n::localize(StringId::STORAGE_BAD_TRANFER), i18n::localize(StringId::STORAGE_BAD_ITEM));
                 return;
             }
             else if (pkm->ball() > TitleLoader::save->maxBall())
             {
-                Gui::warn(i18n::localize("STORAGE_BAD_TRANFER"), i18n::localize("STORAGE_BAD_BALL"));
+                Gui::warn(i18n::localize(StringId::STORAGE_BAD_TRANFER), i18n::localize(StringId::STORAGE_BAD_BALL));
                 return;
             }
             else if (moveBad)
             {
-                Gui::warn(i18n::localize("STORAGE_BAD_TRANFER"), i18n::localize("STORAGE_BAD_MOVE"));
+                Gui::warn(i18n::localize(StringId::STORAGE_BAD_TRANFER), i18n::localize(StringId::STORAGE_BAD_MOVE));
                 return;
             }
             TitleLoader::save->pkm(pkm, slot);
@@ -160,6 +160,14 @@ static bool saveIsFile;
 static std::string saveFileName;
 static std::shared_ptr<Title> loadedTitle;
 
+// Whatever the previous save needed can go; the new one's language will be wanted as soon as its boxes are shown
+static void loadSaveLanguage(void)
+{
+    u8 saveLanguage = TitleLoader::save ? TitleLoader::save->language() : (u8)Language::UNUSED;
+    i18n::trim(saveLanguage);
+    i18n::load(saveLanguage);
+}
+
 void TitleLoader::scanTitles(void)
 {
     Result res = 0;
@@ -256,7 +264,7 @@ static std::vector<std::string> scanDirectoryFor(const std::u16string& dir, cons
 
 void TitleLoader::scanSaves(void)
 {
-    Gui::waitFrame(i18n::localize("SCAN_SAVES"));
+    Gui::waitFrame(i18n::localize(StringId::SCAN_SAVES));
     static const std::u16string chkpntDir = u"/3ds/Checkpoint/saves";
     for (size_t i = 0; i < ctrTitleIds.size(); i++)
     {
@@ -315,7 +323,7 @@ void TitleLoader::backupSave(const std::string& id)
     {
         return;
     }
-    Gui::waitFrame(i18n::localize("LOADER_BACKING_UP"));
+    Gui::waitFrame(i18n::localize(StringId::LOADER_BACKING_UP));
     char stringTime[15]   = {0};
     time_t unixTime       = time(NULL);
     struct tm* timeStruct = gmtime((const time_t*)&unixTime);
@@ -336,7 +344,7 @@ void TitleLoader::backupSave(const std::string& id)
     }
     else
     {
-        Gui::warn(i18n::localize("BAD_OPEN_BACKUP"));
+        Gui::warn(i18n::localize(StringId::BAD_OPEN_BACKUP));
     }
     out.close();
 }
@@ -344,6 +352,7 @@ void TitleLoader::backupSave(const std::string& id)
 bool TitleLoader::load(u8* data, size_t size)
 {
     save = Sav::getSave(data, size);
+    loadSaveLanguage();
     return save != nullptr;
 }
 
@@ -361,6 +370,7 @@ bool TitleLoader::load(std::shared_ptr<Title> title)
             u8* data = new u8[in.size()];
             in.read(data, in.size());
             save = Sav::getSave(data, in.size());
+            loadSaveLanguage();
             in.close();
             delete[] data;
             FSUSER_CloseArchive(archive);
@@ -372,7 +382,7 @@ bool TitleLoader::load(std::shared_ptr<Title> title)
         }
         else
         {
-            Gui::error(i18n::localize("BAD_OPEN_SAVE"), in.result());
+            Gui::error(i18n::localize(StringId::BAD_OPEN_SAVE), in.result());
             in.close();
             loadedTitle = nullptr;
             FSUSER_CloseArchive(archive);
@@ -384,7 +394,7 @@ bool TitleLoader::load(std::shared_ptr<Title> title)
         u32 cap = SPIGetCapacity(title->SPICardType());
         if (cap != 524288)
         {
-            Gui::warn(i18n::localize("WRONG_SIZE"), i18n::localize("Please report"));
+            Gui::warn(i18n::localize(StringId::WRONG_SIZE), i18n::localize("Please report"));
             return false;
         }
 
@@ -397,6 +407,7 @@ bool TitleLoader::load(std::shared_ptr<Title> title)
         }
 
         save = Sav::getSave(data, cap);
+        loadSaveLanguage();
         delete[] data;
         if (Configuration::getInstance().autoBackup())
         {
@@ -404,7 +415,7 @@ bool TitleLoader::load(std::shared_ptr<Title> title)
         }
         return save != nullptr;
     }
-    Gui::warn(i18n::localize("LOADER_CRITICAL_ERROR"));
+    Gui::warn(i18n::localize(StringId::LOADER_CRITICAL_ERROR));
     return false;
 }
 
@@ -424,7 +435,7 @@ bool TitleLoader::load(std::shared_ptr<Title> title, const std::string& savePath
     }
     else
     {
-        Gui::error(i18n::localize("BAD_OPEN_SAVE"), in.result());
+        Gui::error(i18n::localize(StringId::BAD_OPEN_SAVE), in.result());
         loadedTitle  = nullptr;
         saveFileName = "";
         in.close();
@@ -432,10 +443,11 @@ bool TitleLoader::load(std::shared_ptr<Title> title, const std::string& savePath
     }
     in.close();
     save = Sav::getSave(saveData, size);
+    loadSaveLanguage();
     delete[] saveData;
     if (!save)
     {
-        Gui::warn(saveFileName, i18n::localize("SAVE_INVALID"));
+        Gui::warn(saveFileName, i18n::localize(StringId::SAVE_INVALID));
         saveFileName = "";
         loadedTitle  = nullptr;
         return false;
@@ -472,7 +484,7 @@ void TitleLoader::saveToTitle(bool ask)
     if (loadedTitle)
     {
         if (TitleLoader::cardTitle == loadedTitle &&
-            (!ask || Gui::showChoiceMessage(i18n::localize("SAVE_OVERWRITE_1"), i18n::localize("SAVE_OVERWRITE_CARD"))))
+            (!ask || Gui::showChoiceMessage(i18n::localize(StringId::SAVE_OVERWRITE_1), i18n::localize(StringId::SAVE_OVERWRITE_CARD))))
         {
             auto& title = TitleLoader::cardTitle;
             if (title->cardType() == FS_CardType::CARD_CTR)
@@ -487,13 +499,13 @@ void TitleLoader::saveToTitle(bool ask)
                     {
                         out.close();
                         FSUSER_CloseArchive(archive);
-                        Gui::error(i18n::localize("FAIL_SAVE_COMMIT"), res);
+                        Gui::error(i18n::localize(StringId::FAIL_SAVE_COMMIT), res);
                         return;
                     }
                 }
                 else
                 {
-                    Gui::error(i18n::localize("BAD_OPEN_SAVE"), out.result());
+                    Gui::error(i18n::localize(StringId::BAD_OPEN_SAVE), out.result());
                 }
                 out.close();
                 FSUSER_CloseArchive(archive);
@@ -519,7 +531,7 @@ void TitleLoader::saveToTitle(bool ask)
             for (auto title : TitleLoader::nandTitles)
             {
                 if (title == loadedTitle &&
-                    (!ask || Gui::showChoiceMessage(i18n::localize("SAVE_OVERWRITE_1"), i18n::localize("SAVE_OVERWRITE_INSTALL"))))
+                    (!ask || Gui::showChoiceMessage(i18n::localize(StringId::SAVE_OVERWRITE_1), i18n::localize(StringId::SAVE_OVERWRITE_INSTALL))))
                 {
                     FS_Archive archive;
                     Archive::save(&archive, title->mediaType(), title->lowId(), title->highId());
@@ -531,13 +543,13 @@ void TitleLoader::saveToTitle(bool ask)
                         {
                             out.close();
                             FSUSER_CloseArchive(archive);
-                            Gui::error(i18n::localize("FAIL_SAVE_COMMIT"), res);
+                            Gui::error(i18n::localize(StringId::FAIL_SAVE_COMMIT), res);
                             return;
                         }
                     }
                     else
                     {
-                        Gui::error(i18n::localize("BAD_OPEN_SAVE"), out.result());
+                        Gui::error(i18n::localize(StringId::BAD_OPEN_SAVE), out.result());
                     }
                     out.close();
                     FSUSER_CloseArchive(archive);
@@ -36,6 +36,14 @@ void Threads::create(ThreadFunc entrypoint, void* arg)
     threads.push_back(thread);
 }
 
+Thread Threads::createNetwork(ThreadFunc entrypoint, void* arg)
+{
+    s32 prio = 0;
+    svcGetThreadPriority(&prio, CUR_THREAD_HANDLE);
+    // The TLS handshake needs a lot more stack than the usual 4 KiB helper threads get
+    return threadCreate(entrypoint, arg, 0x10000, prio + 1, -2, false);
+}
+
 void Threads::destroy(void)
 {
     for (u32 i = 0; i < threads.size(); i++)
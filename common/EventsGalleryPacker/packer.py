@@ -1,4 +1,25 @@
 #!/usr/bin/python3
+# Packs the EventsGallery wondercards into one gallery<gen>.bin per generation, which MysteryGift reads
+# record by record instead of inflating and parsing everything up front.
+#
+# Layout (all little endian):
+#   header:  char[4] "PKMG", u32 version, u32 card count, u32 match count, u32 chunk count, u32 name pool size,
+#            u32 token count, u32 species count, u32 game count, u32 posting count, u32 token pool size
+#   cards:   per card u16 id, u8 type, u8 language, s16 species, s8 form, s8 gender, u32 name offset,
+#            u32 game offset, u16 chunk, u16 padding, u32 offset in the chunk, u32 size
+#   matches: per event u16 id, s16 species, s8 form, s8 gender, u16 card index per language (0xFFFF if none),
+#            sorted by id
+#   chunks:  per chunk u32 offset (from the start of the file), u32 compressed size, u32 size
+#   names:   NUL terminated UTF-8 strings, referenced by the name and game offsets
+#   tokens:  per distinct word of the events' names (and their ids) u32 offset and u32 length in the token pool,
+#            u32 first posting and u32 posting count, sorted by text
+#   species: per species u16 species, u16 padding, u32 first posting, u32 posting count, sorted by species
+#   games:   per game u32 name offset
+#   facets:  bitmaps over the events, ceil(match count / 32) u32s each: one per language (matchLangs order),
+#            item gifts, shiny Pokemon, then one per game
+#   postings: u16 event indices, ascending within each list
+#   token pool: the folded (see fold below) token text as UTF-16 code units
+#   data:    the bz2 compressed chunks, each holding whole cards so it can be decompressed on its own
 import git
 import os
 import json
@@ -9,9 +30,21 @@ import gen4string
 validLangs = ["CHS", "CHT", "ENG", "FRE", "GER", "ITA", "JPN", "KOR", "SPA"]
 validTypes = ["wc7", "wc6", "wc7full", "wc6full", "pgf", "wc4", "pgt"]
 
+VERSION = 2
+# Must match MysteryGift::giftType and MysteryGift::giftMatch's language order in common/include/mysterygift.hpp
+typeIds = ["wc4", "pgt", "pgf", "wc6", "wc6full", "wc7", "wc7full", "wb7", "wb7full"]
+matchLangs = ["CHS", "CHT", "ENG", "FRE", "GER", "ITA", "JPN", "KOR", "SPA"]
+# Uncompressed size a chunk is filled up to before starting the next one
+CHUNK_SIZE = 32 * 1024
+
 def getWC4(data):
 	return bytearray(data[0x8:0x8 + 136])
 
+def isShinyPK4(pk4):
+	pid = struct.unpack('<I', pk4[0x0:0x4])[0]
+	tid, sid = struct.unpack('<HH', pk4[0xC:0x10])
+	return (tid ^ sid ^ (pid >> 16) ^ (pid & 0xFFFF)) < 8
+
 def sortById(thing):
 	return thing['id']
 
@@ -43,6 +76,7 @@ def scanDir(root, sheet, origOffset):
 					else:
 						entry['name'] = name.replace("Item ", "").replace(" " + game, "").replace(" (" + lang + ")","")
 				entry['type'] = type
+				entry['lang'] = lang
 				entry['size'] = size
 				entry['game'] = game
 				entry['offset'] = origOffset + len(retdata)
@@ -54,7 +88,9 @@ def scanDir(root, sheet, origOffset):
 						entry['species'] = -1 if tempdata[0x51] != 0 else struct.unpack('<H', tempdata[0x82:0x84])[0]
 						entry['form'] = -1 if tempdata[0x51] != 0 else tempdata[0x84]
 						entry['gender'] = -1 if tempdata[0x51] != 0 else tempdata[0xA1]
+						entry['shiny'] = tempdata[0xA3] == 2
 						cardId = struct.unpack('<H', tempdata[:0x2])[0]
+						entry['id'] = cardId
 						# get event title
 						name = tempdata[0x2:0x4C]
 						for i in range(0, len(name), 2):
@@ -88,7 +124,9 @@ def scanDir(root, sheet, origOffset):
 						entry['species'] = -1 if tempdata[0x51 + 0x208] != 0 else struct.unpack('<H', tempdata[0x28A:0x28C])[0]
 						entry['form'] = -1 if tempdata[0x51 + 0x208] != 0 else tempdata[0x28C]
 						entry['gender'] = -1 if tempdata[0x51 + 0x208] != 0 else tempdata[0x2A9]
+						entry['shiny'] = tempdata[0xA3 + 0x208] == 2
 						cardId = struct.unpack('<H', tempdata[0x208:0x20A])[0]
+						entry['id'] = cardId
 						# get event title
 						name = tempdata[0x20A:0x254]
 						for i in range(0, len(name), 2):
@@ -116,7 +154,9 @@ def scanDir(root, sheet, origOffset):
 						entry['species'] = -1 if tempdata[0xB3] != 1 else struct.unpack('<H', tempdata[0x1A:0x1C])[0]
 						entry['form'] = -1 if tempdata[0xB3] != 1 else tempdata[0x1C]
 						entry['gender'] = -1 if tempdata[0xB3] != 1 else tempdata[0x35]
+						entry['shiny'] = tempdata[0x37] == 2
 						cardId = struct.unpack('<H', tempdata[0xB0:0xB2])[0]
+						entry['id'] = cardId
 						# get event title
 						name = tempdata[0x60:0xAA]
 						for i in range(0, len(name), 2):
@@ -146,15 +186,19 @@ def scanDir(root, sheet, origOffset):
 							entry['species'] = struct.unpack('<H', pk4[0x8:0x0A])[0]
 							entry['form'] = pk4[0x40] >> 3
 							entry['gender'] = pk4[0x40] >> 1 & 0x3
+							entry['shiny'] = isShinyPK4(pk4)
 						elif tempdata[0] == 7:
 							entry['species'] = 470
 							entry['form'] = -1 # special meaning for Manaphy: egg
 							entry['gender'] = 2
+							entry['shiny'] = False
 						else:
 							entry['species'] = -1
 							entry['form'] = -1
 							entry['gender'] = -1
+							entry['shiny'] = False
 						cardId = struct.unpack('<H', tempdata[0x150:0x152])[0]
+						entry['id'] = cardId
 						entry['name'] = "%03i - " % cardId + gen4string.translateG4String(tempdata[0x104:0x104+0x48]).replace("Mystery Gift ","")
 						if entry['name'] == "%03i - " % cardId:
 							entry['name'] = name.replace("Item ", "").replace(" " + game, "").replace(" (" + lang + ")","")
@@ -178,17 +222,22 @@ def scanDir(root, sheet, origOffset):
 							entry['species'] = struct.unpack('<H', pk4[0x8:0x0A])[0]
 							entry['form'] = pk4[0x40] >> 3
 							entry['gender'] = pk4[0x40] >> 1 & 0x3
+							entry['shiny'] = isShinyPK4(pk4)
 						elif tempdata[0] == 7:
 							entry['species'] = 490
 							entry['form'] = -1 # special meaning for Manaphy: egg
 							entry['gender'] = 2
+							entry['shiny'] = False
 						else:
 							entry['species'] = -1
 							entry['form'] = -1
 							entry['gender'] = -1
-						cardId = entry['name'][:3]
-						if not any(elem in "1234567890" for elem in cardId):
+							entry['shiny'] = False
+						try:
+							cardId = int(entry['name'][:3])
+						except ValueError:
 							cardId = 999
+						entry['id'] = cardId
 						inMatches = False
 						for i in range(len(sheet['matches'])):
 							if sheet['matches'][i]['id'] == cardId and sheet['matches'][i]['species'] == entry['species'] and sheet['matches'][i]['form'] == entry['form'] and sheet['matches'][i]['gender'] == entry['gender']:
@@ -208,6 +257,159 @@ def scanDir(root, sheet, origOffset):
 				pass
 	return retdata
 
+# Same as StringUtils::fold, so tokens compare equal to folded queries
+def fold(string):
+	ret = ''
+	for c in map(ord, string):
+		if 0xFF01 <= c <= 0xFF5E:
+			c -= 0xFEE0
+		elif c == 0x3000:
+			c = 0x20
+		if c < 0x80:
+			if ord('A') <= c <= ord('Z'):
+				c += 0x20
+		elif (0xC0 <= c <= 0xDE and c != 0xD7) or (0x391 <= c <= 0x3AB and c != 0x3A2) or 0x410 <= c <= 0x42F:
+			c += 0x20
+		elif 0x400 <= c <= 0x40F:
+			c += 0x50
+		elif 0x100 <= c <= 0x137 or 0x14A <= c <= 0x177:
+			c |= 1
+		elif 0x139 <= c <= 0x148 or 0x179 <= c <= 0x17E:
+			c += c & 1
+		elif c == 0x178:
+			c = 0xFF
+		elif 0x3041 <= c <= 0x3096:
+			c += 0x60
+		ret += chr(c)
+	return ret
+
+# Must match isSeparator in common/source/mysterygift.cpp
+def isSeparator(c):
+	return (ord(c) < 0x80 and not c.isalnum()) or c in '\u2019\u2026\u3001\u3002\u300C\u300D\u30FB'
+
+def tokenize(string):
+	tokens = []
+	current = ''
+	for c in fold(string):
+		if isSeparator(c):
+			if current:
+				tokens.append(current)
+			current = ''
+		else:
+			current += c
+	if current:
+		tokens.append(current)
+	return tokens
+
+def bitmap(matches, predicate):
+	words = [0] * ((len(matches) + 31) // 32)
+	for i, match in enumerate(matches):
+		if predicate(match):
+			words[i // 32] |= 1 << (i % 32)
+	return struct.pack('<{}I'.format(len(words)), *words)
+
+def packIndex(cards, matches, nameOffsets):
+	postings = []
+	def addPostings(lists):
+		table = []
+		for key in sorted(lists):
+			table.append((key, len(postings), len(lists[key])))
+			postings.extend(sorted(lists[key]))
+		return table
+
+	words = {}
+	for i, match in enumerate(matches):
+		for card in match['indices'].values():
+			for token in tokenize(cards[card].get('name', '')):
+				words.setdefault(token, set()).add(i)
+		words.setdefault(str(match['id']), set()).add(i)
+	# Sort by UTF-16 code units, which is the order the lookup compares in
+	tokenTable = b''
+	tokenPool = b''
+	for token, first, count in sorted(addPostings(words), key=lambda entry: entry[0].encode('utf-16-be')):
+		text = token.encode('utf-16-le')
+		tokenTable += struct.pack('<IIII', len(tokenPool) // 2, len(text) // 2, first, count)
+		tokenPool += text
+
+	species = {}
+	for i, match in enumerate(matches):
+		if match['species'] >= 0:
+			species.setdefault(match['species'], set()).add(i)
+	speciesTable = b''
+	for key, first, count in addPostings(species):
+		speciesTable += struct.pack('<HHII', key, 0, first, count)
+
+	gameOf = lambda match: {cards[card]['game'] for card in match['indices'].values()}
+	games = sorted(set().union(*map(gameOf, matches)))
+	gameTable = b''.join(struct.pack('<I', nameOffsets[game]) for game in games)
+
+	facets = b''
+	for lang in matchLangs:
+		facets += bitmap(matches, lambda match: lang in match['indices'])
+	facets += bitmap(matches, lambda match: match['species'] < 0)
+	facets += bitmap(matches, lambda match: any(cards[card].get('shiny', False) for card in match['indices'].values()))
+	for game in games:
+		facets += bitmap(matches, lambda match: game in gameOf(match))
+
+	postingData = struct.pack('<{}H'.format(len(postings)), *postings)
+	postingData += b'\0' * (-len(postingData) % 4)
+	tokenPool += b'\0' * (-len(tokenPool) % 4)
+	counts = struct.pack('<IIIII', len(words), len(species), len(games), len(postings), len(tokenPool) // 2)
+	return counts, tokenTable + speciesTable + gameTable + facets + postingData + tokenPool
+
+def packNames(cards):
+	pool = b''
+	offsets = {}
+	def add(string):
+		nonlocal pool
+		if string not in offsets:
+			offsets[string] = len(pool)
+			pool += string.encode('utf-8') + b'\0'
+		return offsets[string]
+	names = [(add(card.get('name', '')), add(card.get('game', ''))) for card in cards]
+	return names, pool, offsets
+
+def packChunks(cards, data):
+	chunks = []
+	placement = []
+	current = b''
+	for card in cards:
+		if current and len(current) + card['size'] > CHUNK_SIZE:
+			chunks.append(current)
+			current = b''
+		placement.append((len(chunks), len(current)))
+		current += data[card['offset']:card['offset'] + card['size']]
+	if current:
+		chunks.append(current)
+	return placement, chunks
+
+def packGallery(sheet, data):
+	cards = sheet['wondercards']
+	names, pool, nameOffsets = packNames(cards)
+	placement, chunks = packChunks(cards, data)
+	compressed = [bz2.compress(chunk) for chunk in chunks]
+
+	cardTable = b''
+	for card, (name, game), (chunk, offset) in zip(cards, names, placement):
+		cardTable += struct.pack('<HBBhbbIIHHII', card.get('id', 0), typeIds.index(card['type']), matchLangs.index(card['lang']),
+			card.get('species', -1), card.get('form', -1), card.get('gender', -1), name, game, chunk, 0, offset, card['size'])
+
+	matchTable = b''
+	for match in sheet['matches']:
+		indices = [match['indices'].get(lang, 0xFFFF) for lang in matchLangs]
+		matchTable += struct.pack('<Hhbb9H', match['id'], match['species'], match['form'], match['gender'], *indices)
+
+	pool += b'\0' * (-len(pool) % 4)
+	counts, index = packIndex(cards, sheet['matches'], nameOffsets)
+	offset = 44 + len(cardTable) + len(matchTable) + len(chunks) * 12 + len(pool) + len(index)
+	chunkTable = b''
+	for chunk, packed in zip(chunks, compressed):
+		chunkTable += struct.pack('<III', offset, len(packed), len(chunk))
+		offset += len(packed)
+
+	header = b'PKMG' + struct.pack('<IIIII', VERSION, len(cards), len(sheet['matches']), len(chunks), len(pool)) + counts
+	return header + cardTable + matchTable + chunkTable + pool + index + b''.join(compressed)
+
 # create out directory
 try:
     os.stat("./out")
@@ -242,20 +444,10 @@ for gen in range (4, 7+1):
 	data += scanDir(root, sheet, 0)
 	if (gen == 7):
 		data += scanDir("./EventsGallery/Unreleased/Gen 7/Movie 21", sheet, len(data))
-	
-	# sort, then get rid of data not needed in final product
+
+	# sort matches by card id
 	sheet['matches'] = sorted(sheet['matches'], key=sortById)
-	for i in range(len(sheet['matches'])):
-		temp = sheet['matches'][i]['indices']
-		sheet['matches'][i] = temp
-		sheet['matches'][i]
-		
-	# export sheet
-	compressed = bz2.compress(str.encode(json.dumps(sheet)))
-	with open("./out/sheet{}.json.bz2".format(gen), 'wb') as f:
-		f.write(compressed)
-
-	# export data
-	compressed = bz2.compress(data)
-	with open("./out/data{}.bin.bz2".format(gen), 'wb') as f:
-		f.write(compressed)
+
+	# export gallery
+	with open("./out/gallery{}.bin".format(gen), 'wb') as f:
+		f.write(packGallery(sheet, data))
@@ -0,0 +1,72 @@
+#!/usr/bin/python3
+# Generates the StringId enum used by i18n::localize from the keys of the English gui.json. Run it after adding or
+# removing GUI strings (after fix_missing_strings.py, if that's being used too).
+import json
+import re
+
+LICENSE = '''/*
+ *   This file is part of PKSM
+ *   Copyright (C) 2016-2019 Bernardo Giordano, Admiral Fish, piepie62
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+ *       * Requiring preservation of specified reasonable legal notices or
+ *         author attributions in that material or in the Appropriate Legal
+ *         Notices displayed by works containing it.
+ *       * Prohibiting misrepresentation of the origin of that material,
+ *         or requiring that modified versions of such material be marked in
+ *         reasonable ways as different from the original version.
+ */
+'''
+
+def identifier(key):
+	name = key
+	if name.endswith('.'):
+		name = name[:-1] + '_SHORT'
+	name = re.sub(r'[^A-Za-z0-9]+', '_', name).strip('_')
+	if name[0].isdigit():
+		name = '_' + name
+	return name
+
+with open('../assets/romfs/i18n/en/gui.json', 'r') as f:
+	keys = sorted(json.load(f).keys())
+
+names = {}
+for key in keys:
+	name = identifier(key)
+	if name in names:
+		raise SystemExit('"{}" and "{}" both map to {}'.format(names[name], key, name))
+	names[name] = key
+
+with open('../core/include/i18n/StringId.hpp', 'w') as f:
+	f.write(LICENSE)
+	f.write('\n// Generated by common/gen_string_ids.py from assets/romfs/i18n/en/gui.json. Do not edit by hand\n\n')
+	f.write('#ifndef STRINGID_HPP\n#define STRINGID_HPP\n\n#include "types.h"\n#include <stddef.h>\n\n')
+	f.write('enum class StringId : u16\n{\n')
+	for key in keys:
+		f.write('    {},\n'.format(identifier(key)))
+	f.write('};\n\n')
+	f.write('constexpr size_t STRING_ID_COUNT = {};\n\n'.format(len(keys)))
+	f.write('// gui.json key of every StringId, in the same (strcmp) order\nextern const char* const stringIdKeys[STRING_ID_COUNT];\n\n')
+	f.write('#endif\n')
+
+with open('../core/source/i18n/StringId.cpp', 'w') as f:
+	f.write(LICENSE)
+	f.write('\n// Generated by common/gen_string_ids.py from assets/romfs/i18n/en/gui.json. Do not edit by hand\n\n')
+	f.write('#include "StringId.hpp"\n\n')
+	f.write('const char* const stringIdKeys[STRING_ID_COUNT] = {\n')
+	for key in keys:
+		f.write('    {},\n'.format(json.dumps(key)))
+	f.write('};\n')
@@ -27,38 +27,70 @@
 #ifndef BANK_HPP
 #define BANK_HPP
 
+#include "BankIndex.hpp"
 #include "Sav.hpp"
 #include "sha256.h"
+#include <ctime>
+#include <functional>
 
 class Bank
 {
 public:
     Bank(const std::string& name, int maxBoxes);
-    ~Bank() { delete[] data; }
     std::shared_ptr<PKX> pkm(int box, int slot) const;
     void pkm(std::shared_ptr<PKX> pkm, int box, int slot);
+    // Decoded once and shared until the slot is written. Use pkm() to get a copy that can be modified
+    std::shared_ptr<const PKX> cachedPkm(int box, int slot) const;
+    const PKXCache& cache() const { return pkmCache; }
+    // One result per bank slot, in box-major order
+    std::vector<bool> filterBoxes(const PKFilter& filter) const;
     void resize(size_t boxes);
     void load(int maxBoxes);
     bool save() const;
     bool saveWithoutBackup() const;
-    bool backup() const;
+    struct BackupPoint
+    {
+        // 0 is the full copy that the later points are applied to; its time isn't known
+        u32 index;
+        time_t time;
+        int boxes;
+        u32 changedBoxes;
+    };
+    // Points that can be restored from the current backup, oldest first
+    std::vector<BackupPoint> backups() const;
+    // Brings the bank back to how it was after the save that made the point, and saves it
+    bool restore(u32 point);
     std::string boxName(int box) const;
     std::pair<std::string, std::string> paths() const;
+    static std::pair<std::string, std::string> paths(const std::string& name);
     void boxName(std::string name, int box);
     bool hasChanged() const;
+    // False if the box is in the bank file but couldn't be read. It shows as empty and ignores writes, so that saving
+    // never replaces what is on disk
+    bool boxReadable(int box) const;
     int boxes() const;
     const std::string& name() const;
     bool setName(const std::string& name);
+    // Boxes are read from the bank file on first access; at most this many bytes of them are kept resident
+    void memoryBudget(size_t bytes);
+    int residentBoxes() const { return resident; }
+    // Builds a PKX from a stored entry; Generation::UNUSED gives an empty PK7
+    static std::shared_ptr<PKX> entryPkm(Generation gen, const u8* data);
+    // Reads a bank's file a box at a time without loading the bank, reflecting it as it was last saved.
+    // Only touches the file system, so it can be used from any thread
+    static bool forEachEntry(const std::string& name, const std::function<void(int box, int slot, Generation gen, const u8* data)>& callback);
+    // Writes a bank's search index from its file as it was last saved, without loading (or converting) the bank
+    static bool buildIndex(const std::string& name);
 
 private:
-    static constexpr int BANK_VERSION            = 2;
+    static constexpr int BANK_VERSION            = 3;
     static constexpr std::string_view BANK_MAGIC = "PKSMBANK";
     void createJSON();
     void createBank(int maxBoxes);
     void convertFromBankBin();
     struct BankHeader
     {
-        const char MAGIC[8];
+        char MAGIC[8];
         int version;
         int boxes;
     };
@@ -67,11 +99,122 @@ private:
         Generation gen;
         u8 data[260];
     };
-    u8* data = nullptr;
+    // Size of a decoded box, and of a box on disk in versions 1 and 2
+    static constexpr size_t BOX_SIZE = sizeof(BankEntry) * 30;
+    // Version 3 stores each box as a block: runs of empty slots are a single EMPTY_RUN tag and a count, and every other
+    // slot is its generation, a u16 length and its data with the trailing 0xFF padding dropped. The header is followed by
+    // a directory of boxes + 1 blocks, the last of which is the box name table (u16 length and UTF-8 name per box).
+    // Blocks are allocated with some slack so that most saves can rewrite them in place. Blocks that outgrow their space
+    // and boxes added by a resize are placed at the end of the file, and the directory has room reserved in front of the
+    // first block so that resizing doesn't have to move anything
+    struct BlockInfo
+    {
+        u32 offset;
+        u32 size;
+        u32 capacity;
+    };
+    static constexpr u8 EMPTY_RUN    = 0xFF;
+    static constexpr u32 BLOCK_ALIGN = 0x200;
+    static u32 blockCapacity(u32 size) { return (size + sizeof(BankEntry) + BLOCK_ALIGN - 1) / BLOCK_ALIGN * BLOCK_ALIGN; }
+    static void encodeBox(const BankEntry* entries, std::vector<u8>& out);
+    static bool decodeBox(const u8* data, size_t size, BankEntry* out);
+    void encodeNames(std::vector<u8>& out) const;
+    static bool decodeNames(const u8* data, size_t size, nlohmann::json& out);
+    // Reads any version of bank file a box at a time. Without a callback only the box count and names are read.
+    // names is left empty for files from before version 3
+    static bool readFile(bool sd, const std::string& path, const std::function<void(int box, int slot, Generation gen, const u8* data)>& callback,
+        int* boxes = nullptr, nlohmann::json* names = nullptr);
+    // Faults the box in if needed and marks it as most recently used
+    BankEntry* page(int box) const;
+    // Reads a box straight from the bank file without making it resident. Fails if the box is in the file but couldn't be
+    // read or decoded, in which case out is left empty
+    bool readBox(int box, BankEntry* out) const;
+    bool evict() const;
+    // Calls visit for every box in order, with what should be written for it
+    typedef std::function<void(const std::function<void(int box, const BankEntry* entries)>& visit)> BoxSource;
+    // Writes the whole bank to a file next to the real one, for saves that change the layout. Boxes come from source if
+    // one is given, and from the bank otherwise
+    bool writeTemp(std::vector<BlockInfo>& newBlocks, const BoxSource& source = nullptr) const;
+    // Saves go through a write-ahead journal: the journal is written and checked first, then applied, then deleted.
+    // A journal left behind by an interrupted save is replayed on the next load
+    struct JournalHeader
+    {
+        char MAGIC[8];
+        u32 flags;
+        u32 length;
+        u8 hash[SHA256_BLOCK_SIZE];
+    };
+    enum JournalFlags : u32
+    {
+        REPLACE_BANK = 1
+    };
+    static constexpr std::string_view JOURNAL_MAGIC = "PKSMJRNL";
+    // Records are a u32 file offset and a u32 length followed by that many bytes
+    static void appendRecord(std::vector<u8>& records, u32 offset, const void* data, u32 length);
+    bool writeJournal(u32 flags, const std::vector<u8>& records) const;
+    // Search index; see BankIndex.hpp. Updated after every save for the boxes that were written
+    bool indexValid() const;
+    void markIndexStale() const;
+    // Falls back to rewriting every box if the index doesn't match the bank
+    void writeIndex(const std::vector<int>& boxes) const;
+    bool applyJournal(u32 flags, const u8* records, size_t length) const;
+    void replayJournal() const;
+    // Writes the changes to the bank file; save() and saveWithoutBackup() differ in what they do with the backup first
+    bool commit() const;
+    // A backup is a copy of the bank file plus a log of the boxes that each later save wrote, kept in the backups folder as
+    // <bank>.bnk.bak and <bank>.bnk.delta. Once the log is bigger than the bank, the next backup starts over from a new
+    // copy, and the previous pair becomes the .old backup
+    struct DeltaHeader
+    {
+        char MAGIC[8];
+        // Bytes following the header: changed box records (u32 box, u32 size, encoded block), then the name table
+        u32 length;
+        // BACKUP_BREAK for a save that was made without a backup, after which the log can't be extended
+        u32 boxes;
+        u32 changed;
+        u32 unused;
+        u64 time;
+        u8 hash[SHA256_BLOCK_SIZE];
+    };
+    static constexpr std::string_view DELTA_MAGIC = "PKSMDLTA";
+    static constexpr u32 BACKUP_BREAK             = 0xFFFFFFFF;
+    std::string backupPath() const { return "/3ds/PKSM/backups/" + bankName + ".bnk"; }
+    // Each header with the offset of its data. Stops at the first record that is damaged
+    std::vector<std::pair<DeltaHeader, u32>> readDeltas() const;
+    bool appendDelta(u32 offset, const DeltaHeader& header, const std::vector<u8>& payload) const;
+    // A log record for the save that is about to be made. It is only appended once that save has reached the bank file
+    struct PendingDelta
+    {
+        u32 offset;
+        DeltaHeader header;
+        std::vector<u8> payload;
+    };
+    // Makes sure there's a base to log against and builds the record for the pending changes
+    bool backup(PendingDelta& delta) const;
+    BankHeader header;
+    mutable std::vector<std::unique_ptr<BankEntry[]>> pages;
+    mutable std::vector<u32> lastUse;
+    mutable u32 useTick  = 0;
+    mutable int resident = 0;
+    int maxResident      = 2;
+    // One bit per slot. Dirty boxes stay resident until they are written back
+    mutable std::vector<u32> dirty;
+    // Boxes with any dirty slot, so that change checks and saves don't have to walk the whole bank
+    mutable std::vector<int> dirtyBoxes;
+    // Hash of each box as it is on disk, taken when the box is faulted in or saved
+    mutable std::vector<u64> savedHash;
+    // Boxes whose last read from the file failed. They are never made dirty, so saves leave them as they are on disk
+    mutable std::vector<bool> unreadable;
+    mutable bool namesDirty = false;
+    // What the file on disk looks like, so that boxes can be faulted in from it
+    mutable int fileVersion    = BANK_VERSION;
+    mutable int fileBoxes      = 0;
+    mutable u32 fileSize       = 0;
+    mutable u32 fileDataOffset = sizeof(BankHeader);
+    mutable std::vector<BlockInfo> blocks;
+    PKXCache pkmCache;
     nlohmann::json boxNames;
-    size_t size;
-    mutable std::array<u8, SHA256_BLOCK_SIZE> prevHash;
-    mutable std::array<u8, SHA256_BLOCK_SIZE> prevNameHash;
+    mutable std::array<u8, SHA256_BLOCK_SIZE> prevNameHash = {};
     mutable bool needsCheck = false;
     std::string bankName;
 };
@@ -0,0 +1,110 @@
+/*
+ *   This file is part of PKSM
+ *   Copyright (C) 2016-2019 Bernardo Giordano, Admiral Fish, piepie62
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+ *       * Requiring preservation of specified reasonable legal notices or
+ *         author attributions in that material or in the Appropriate Legal
+ *         Notices displayed by works containing it.
+ *       * Prohibiting misrepresentation of the origin of that material,
+ *         or requiring that modified versions of such material be marked in
+ *         reasonable ways as different from the original version.
+ */
+
+#ifndef BANKINDEX_HPP
+#define BANKINDEX_HPP
+
+#include "generation.hpp"
+#include "types.h"
+#include <optional>
+#include <string>
+#include <string_view>
+
+class PKX;
+
+// Each bank keeps a summary of every slot in a file next to it (<bank>.bnk.idx), so that banks can be searched without
+// reading their boxes. The file is a Header followed by one Entry per slot, in box-major order
+namespace BankIndex
+{
+    constexpr std::string_view MAGIC = "PKSMBIDX";
+    constexpr u32 VERSION            = 2;
+
+    struct Header
+    {
+        char MAGIC[8];
+        u32 version;
+        u32 boxes;
+        // Set while a save is being applied; an index that is still stale when its bank is loaded gets rebuilt
+        u32 stale;
+    };
+
+    enum EntryFlags : u8
+    {
+        SHINY = 1,
+        EGG   = 2
+    };
+
+    struct Entry
+    {
+        u16 species;
+        u8 form;
+        u8 flags;
+        u16 tid;
+        u16 sid;
+        u32 otHash;
+        // Encryption constant and PID, to find copies of the same Pokémon
+        u32 idHash;
+        u8 level;
+        u8 ball;
+        // Generation::UNUSED for empty slots
+        u8 generation;
+        u8 unused;
+    };
+
+    struct Query
+    {
+        std::optional<u16> species;
+        std::optional<u8> form;
+        std::optional<bool> shiny;
+        // hash() of the OT name, worked out once rather than for every entry
+        std::optional<u32> otHash;
+        std::optional<u16> tid;
+        std::optional<u16> sid;
+        std::optional<u32> idHash;
+        std::optional<u8> minLevel;
+        std::optional<u8> maxLevel;
+        std::optional<u8> ball;
+        std::optional<Generation> generation;
+
+        bool matches(const Entry& entry) const;
+    };
+
+    struct Match
+    {
+        std::string bank;
+        int box;
+        int slot;
+        Entry entry;
+    };
+
+    Entry entry(const PKX& pkm);
+    Entry empty(void);
+    // Matches the otHash of entries made from Pokémon with this OT name
+    u32 hash(const std::string& otName);
+    u32 idHash(u32 encryptionConstant, u32 PID);
+}
+
+#endif
@@ -29,7 +29,15 @@
 
 #include "PKX.hpp"
 #include "json.hpp"
+#include "platform.h"
+#include <list>
 #include <memory>
+#include <vector>
+
+// Base URL of the GPSS server. Build with GPSS_SERVER=http://<host>:<port> to point PKSM at a local stand-in instead
+#ifndef GPSS_SERVER
+#define GPSS_SERVER "https://flagbrew.org"
+#endif
 
 class CloudAccess
 {
@@ -40,6 +48,7 @@ public:
         POPULAR
     };
     CloudAccess();
+    ~CloudAccess();
     std::shared_ptr<PKX> pkm(size_t slot) const;
     bool isLegal(size_t slot) const;
     // Gets the Pokémon and increments the server-side download counter
@@ -81,22 +90,34 @@ public:
     nlohmann::json grabPage(int page);
 
 private:
+    // Decoded pages kept around, so flipping back and forth doesn't go to the server
+    static constexpr size_t MAX_CACHED_PAGES = 8;
     struct Page
     {
+        Page() { LightEvent_Init(&available, RESET_STICKY); }
         nlohmann::json data = {};
-        bool available      = false;
+        // Filled in on first use by pkm
+        mutable std::vector<std::shared_ptr<PKX>> pkms;
+        // Signalled once data is filled in
+        LightEvent available;
     };
-    struct PageDownloadInfo
+    struct PageKey
     {
-        PageDownloadInfo(std::shared_ptr<Page> page, int number, SortType type, bool ascend, bool legal)
-            : page(page), number(number), type(type), ascend(ascend), legal(legal)
-        {
-        }
-        std::shared_ptr<Page> page;
         int number;
         SortType type;
         bool ascend, legal;
+        bool operator==(const PageKey& other) const
+        {
+            return number == other.number && type == other.type && ascend == other.ascend && legal == other.legal;
+        }
     };
+    PageKey key(int number) const { return {number, sort, ascend, legal}; }
+    // Shows the page, from the cache if it's there, then starts fetching the ones around it
+    void showPage(int number);
+    std::shared_ptr<Page> cachedPage(const PageKey& key);
+    void insertPage(const PageKey& key, std::shared_ptr<Page> page);
+    void prefetch(int number);
+    void clearCache();
     void refreshPages();
     bool isGood = false;
     std::shared_ptr<Page> current;
@@ -104,8 +125,17 @@ private:
     SortType sort = LATEST;
     bool ascend   = true;
     bool legal    = false;
+
+    // Most recently used first. Pages that are still being prefetched are in here too, with available not yet signalled
+    std::list<std::pair<PageKey, std::shared_ptr<Page>>> cache;
+    // Prefetches that haven't been started yet, guarded by queueLock
+    std::list<std::pair<PageKey, std::shared_ptr<Page>>> prefetchQueue;
+    LightLock queueLock;
+    LightEvent prefetchEvent;
+    Thread prefetchThread = nullptr;
+    bool exiting          = false;
     friend void incrementPkmDownloadCount(std::string* num);
-    friend void downloadCloudPage(CloudAccess::PageDownloadInfo* di);
+    friend void prefetchWorker(CloudAccess* access);
 };
 
 #endif
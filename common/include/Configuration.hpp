@@ -35,7 +35,7 @@
 class Configuration
 {
 public:
-    static constexpr int CURRENT_VERSION = 8;
+    static constexpr int CURRENT_VERSION = 10;
 
     static Configuration& getInstance(void)
     {
@@ -88,6 +88,12 @@ public:
 
     bool autoUpdate(void) const { return mJson["autoUpdate"]; }
 
+    // In KiB
+    int bankMemory(void) const { return mJson["bankMemory"]; }
+
+    // In KiB
+    int giftMemory(void) const { return mJson["giftMemory"]; }
+
     void language(Language lang) { mJson["language"] = lang; }
 
     void autoBackup(bool backup) { mJson["autoBackup"] = backup; }
@@ -135,6 +141,10 @@ public:
 
     void autoUpdate(bool value) { mJson["autoUpdate"] = value; }
 
+    void bankMemory(int kib) { mJson["bankMemory"] = kib; }
+
+    void giftMemory(int kib) { mJson["giftMemory"] = kib; }
+
     void save(void);
 
 private:
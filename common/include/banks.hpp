@@ -44,6 +44,19 @@ namespace Banks
     void renameBank(const std::string& oldName, const std::string& newName);
     void setBankSize(const std::string& name, int size);
     std::vector<std::pair<std::string, int>> bankNames();
+    // Searches the index of every bank in banks.json. Indexes reflect each bank as it was last saved
+    std::vector<BankIndex::Match> search(const BankIndex::Query& query);
+    struct SlotRef
+    {
+        std::string bank;
+        int box;
+        int slot;
+    };
+    // Runs the filter over every slot of every bank in banks.json, in bank order. Banks are streamed from their files a box
+    // at a time by worker threads, except for the loaded one, whose unsaved changes are included. The executor is called
+    // for every match, one call at a time but from any of the threads
+    std::vector<SlotRef> forEachSlot(const PKFilter& query, const std::function<void(const SlotRef&, std::shared_ptr<PKX>)>& executor = nullptr,
+        int workers = 2);
 }
 
 #endif
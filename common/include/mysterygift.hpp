@@ -27,15 +27,17 @@
 #ifndef MYSTERYGIFT_HPP
 #define MYSTERYGIFT_HPP
 
+#include "LanguageStrings.hpp"
 #include "PGF.hpp"
 #include "PGT.hpp"
 #include "WB7.hpp"
 #include "WC4.hpp"
 #include "WC6.hpp"
 #include "WC7.hpp"
-#include "json.hpp"
 #include "utils.hpp"
+#include <array>
 #include <bzlib.h>
+#include <optional>
 
 namespace MysteryGift
 {
@@ -51,8 +53,57 @@ namespace MysteryGift
         int form;
         int gender;
     };
+    // Matches typeIds in common/EventsGalleryPacker/packer.py
+    enum class giftType : u8
+    {
+        WC4,
+        PGT,
+        PGF,
+        WC6,
+        WC6FULL,
+        WC7,
+        WC7FULL,
+        WB7,
+        WB7FULL
+    };
+    // One event of the gallery, stored exactly as it is in gallery<gen>.bin. indices holds the card of each language it
+    // was distributed in, in the order of matchLangs in packer.py
+    struct giftMatch
+    {
+        static constexpr u16 NO_CARD = 0xFFFF;
+
+        u16 id;
+        s16 species;
+        s8 form;
+        s8 gender;
+        std::array<u16, 9> indices;
+
+        bool contains(Language lang) const;
+        u16 index(Language lang) const;
+        // First language this event has a card for
+        Language language(void) const;
+    };
+    // Facets that aren't set don't narrow anything down. Every word of text has to start a word of one of the event's card
+    // names or its id
+    struct giftQuery
+    {
+        std::string text;
+        std::optional<Language> language;
+        std::optional<u16> species;
+        std::optional<bool> item;
+        std::optional<bool> shiny;
+        // Index into games()
+        int game = -1;
+    };
+    // Loads the gallery index for gen; it's kept until another generation is asked for or exit is called
     void init(Generation gen);
-    std::vector<nlohmann::json> wondercards();
+    // Decompressed cards are kept around up to this many bytes, and handed back under memory pressure
+    void memoryBudget(size_t bytes);
+    const std::vector<giftMatch>& wondercards();
+    // The games the gallery's cards are for
+    const std::vector<std::string>& games();
+    // Indices into wondercards() of the events matching query, in id order. Only looks at the index built by the packer
+    std::vector<size_t> search(const giftQuery& query);
     MysteryGift::giftData wondercardInfo(size_t index);
     std::unique_ptr<WCX> wondercard(size_t index);
     void exit();
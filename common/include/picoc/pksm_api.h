@@ -113,6 +113,14 @@ enum SAV_MAX_FIELD
     MAX_IN_POUCH
 };
 
+enum SEARCH_CATEGORY
+{
+    SEARCH_SPECIES,
+    SEARCH_MOVES,
+    SEARCH_ITEMS,
+    SEARCH_LOCATIONS
+};
+
 void bank_inject_pkx(struct ParseState*, struct Value*, struct Value**, int);
 void cfg_default_ot(struct ParseState*, struct Value*, struct Value**, int);
 void cfg_default_tid(struct ParseState*, struct Value*, struct Value**, int);
@@ -146,6 +154,7 @@ void current_directory(struct ParseState*, struct Value*, struct Value**, int);
 void read_directory(struct ParseState*, struct Value*, struct Value**, int);
 void delete_directory(struct ParseState*, struct Value*, struct Value**, int);
 void i18n_species(struct ParseState*, struct Value*, struct Value**, int);
+void i18n_search(struct ParseState*, struct Value*, struct Value**, int);
 void pkx_decrypt(struct ParseState*, struct Value*, struct Value**, int);
 void pkx_encrypt(struct ParseState*, struct Value*, struct Value**, int);
 void pkx_box_size(struct ParseState*, struct Value*, struct Value**, int);
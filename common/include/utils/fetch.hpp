@@ -24,6 +24,9 @@
  *         reasonable ways as different from the original version.
  */
 
+#ifndef FETCH_HPP
+#define FETCH_HPP
+
 #include "types.h"
 #include <curl/curl.h>
 #include <functional>
@@ -33,10 +36,15 @@
 class Fetch
 {
 public:
+    // Handles come from a pool and go back to it when the Fetch is destroyed, keeping their open connections, so a thread
+    // making one request after another to the same host keeps reusing a kept-alive connection. DNS results and TLS
+    // sessions are shared between all handles. Connections aren't, since libcurl can't share them between threads
     static std::unique_ptr<Fetch> init(
         const std::string& url, bool post, bool ssl, std::string* writeData, struct curl_slist* headers, const std::string& postdata);
     static Result download(const std::string& url, const std::string& path, const std::string& postData = "",
         curl_xferinfo_callback progress = nullptr, void* progressInfo = nullptr);
+    // Frees the pooled handles and the shared caches. Any Fetch still alive afterwards is cleaned up on its own
+    static void exit(void);
 
     CURLcode perform();
     template <typename T>
@@ -54,4 +62,7 @@ public:
 private:
     Fetch() : curl(nullptr, &curl_easy_cleanup) {}
     std::unique_ptr<CURL, decltype(curl_easy_cleanup)*> curl;
+    friend class FetchMulti;
 };
+
+#endif
@@ -0,0 +1,78 @@
+/*
+ *   This file is part of PKSM
+ *   Copyright (C) 2016-2019 Bernardo Giordano, Admiral Fish, piepie62, Allen Lydiard
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+ *       * Requiring preservation of specified reasonable legal notices or
+ *         author attributions in that material or in the Appropriate Legal
+ *         Notices displayed by works containing it.
+ *       * Prohibiting misrepresentation of the origin of that material,
+ *         or requiring that modified versions of such material be marked in
+ *         reasonable ways as different from the original version.
+ */
+
+#ifndef FETCHMULTI_HPP
+#define FETCHMULTI_HPP
+
+#include "fetch.hpp"
+#include "platform.h"
+#include <atomic>
+
+// Runs Fetches in the background on a single curl multi handle, so that several transfers can be in flight at once
+// without blocking the caller
+class FetchMulti
+{
+public:
+    // Runs on the worker thread once the transfer is over
+    typedef std::function<void(CURLcode, Fetch&)> Callback;
+
+    class Request
+    {
+    public:
+        // Blocks until the transfer is over and returns its result
+        CURLcode wait(void);
+        bool done(void) const { return finished; }
+        // Only safe to use once the transfer is over
+        Fetch& fetch(void) { return *handle; }
+
+    private:
+        Request(std::unique_ptr<Fetch> fetch, Callback callback);
+        void finish(CURLcode code);
+
+        std::unique_ptr<Fetch> handle;
+        Callback callback;
+        CURLcode result = CURLE_OK;
+        std::atomic<bool> finished{false};
+        LightEvent event;
+        friend class FetchMulti;
+    };
+
+    // Starts the worker thread. Until it's running (or after exit), add performs transfers right away on the calling thread
+    static Result init(size_t maxTransfers = 4);
+    // Transfers that haven't finished by now are aborted
+    static void exit(void);
+    // Queues a Fetch set up with Fetch::init. Nothing has to keep the returned Request for the transfer to go ahead,
+    // so a request whose result doesn't matter can simply be dropped
+    static std::shared_ptr<Request> add(std::unique_ptr<Fetch> fetch, Callback callback = nullptr);
+    // Fetch::download in the background. The file is closed before the callback runs, and removed if the transfer failed.
+    // Returns nullptr if the file couldn't be created
+    static std::shared_ptr<Request> download(const std::string& url, const std::string& path, Callback callback = nullptr);
+
+private:
+    static void workerMain(void*);
+};
+
+#endif
@@ -42,15 +42,27 @@ namespace StringUtils
     std::string format(std::string fmt_str, ...);
     std::u16string UTF8toUTF16(const std::string& src);
     std::string UTF16toUTF8(const std::u16string& src);
+    /** Transcode into caller-provided buffers without allocating; both return how many code units were written, which is
+     * never more than dstSize. Neither NUL terminates. Invalid input becomes U+FFFD, and a code point that no longer fits
+     * ends the conversion rather than being split. UTF16toUTF8 also stops at NUL or term
+     */
+    size_t UTF8toUTF16(const char* src, size_t srcSize, char16_t* dst, size_t dstSize);
+    size_t UTF16toUTF8(const char16_t* src, size_t srcSize, char* dst, size_t dstSize, char16_t term = 0);
     std::u16string getU16String(const u8* data, int ofs, int len, char16_t term);
     std::string getString(const u8* data, int ofs, int len, char16_t term = 0);
     void setString(u8* data, const std::u16string& v, int ofs, int len, char16_t terminator = 0, char16_t padding = 0);
     void setString(u8* data, const std::string& v, int ofs, int len, char16_t terminator = 0, char16_t padding = 0);
     std::string getString4(const u8* data, int ofs, int len);
+    // Decodes count strings of len characters, stride bytes apart; for example every box name of a Gen 4 save
+    std::vector<std::string> getStrings4(const u8* data, int ofs, int stride, int count, int len);
     void setString4(u8* data, const std::string& v, int ofs, int len);
     std::vector<u16> stringToG4(const std::string& v);
     std::string& toLower(std::string& in);
     std::string& toUpper(std::string& in);
+    /** Case folds for searching: lowercases Latin (including accented letters), Greek and Cyrillic,
+     * turns fullwidth ASCII into ASCII and hiragana into katakana
+     */
+    std::u16string fold(const std::string& in);
     /** Swaps and reswaps Pokemon specific characters, namely:
      * 0x2227, 0x2228, 0x2460, 0x2461, 0x2462,
      * 0x2463, 0x2464, 0x2465, 0x2466, 0x2469,
@@ -68,6 +80,25 @@ namespace StringUtils
      */
     std::string transString67(const std::string& str);
     std::u16string transString67(const std::u16string& str);
+
+    // A name still in its save or Pokemon data, so names can be compared and hashed without decoding them into std::strings
+    struct RawName
+    {
+        enum Encoding : u8
+        {
+            GEN4,  // Gen 4 character values, transString45 characters
+            GEN5,  // UTF-16, transString45 characters
+            GEN67, // UTF-16, transString67 characters
+            UTF16  // Plain UTF-16
+        };
+        const u8* data;
+        int length; // In characters
+        Encoding encoding;
+        char16_t terminator;
+    };
+    // Both look at the names as their std::string getters would return them, so these agree with comparing those
+    bool nameEquals(const RawName& a, const RawName& b);
+    u32 nameHash(const RawName& name);
 }
 
 #endif
@@ -0,0 +1,76 @@
+#!/usr/bin/python3
+# Compiles the text tables in assets/romfs/i18n/<lang> into a single strings.bin per language, which
+# LanguageStrings reads in one go instead of opening and line-parsing every file.
+#
+# Layout (all little endian):
+#   header:    char[4] "I18N", u32 version, u32 table count
+#   directory: per table u32 id, u32 entry count, u32 offset, u32 size (offset from the start of the file)
+#   table:     per entry u32 key, u32 string offset, u32 string length (offset from the start of the table),
+#              followed by the table's strings, each NUL terminated
+import os
+import struct
+
+ROOT = '../assets/romfs/i18n'
+VERSION = 1
+
+# Must match the ids in core/source/i18n/LanguageStrings.cpp
+lists = ['abilities', 'balls', 'forms', 'hp', 'items', 'moves', 'natures', 'species', 'games']
+maps = ['locations4', 'locations5', 'locations6', 'locations7', 'locationsLGPE', 'countries']
+SUBREGIONS = 0x100
+
+def readLines(lang, name):
+	path = os.path.join(ROOT, lang, name)
+	if not os.path.exists(path):
+		path = os.path.join(ROOT, 'en', name)
+	if not os.path.exists(path):
+		return []
+	with open(path, 'rb') as f:
+		lines = f.read().split(b'\n')
+	if lines and lines[-1] == b'':
+		lines.pop()
+	return [line.split(b'\r')[0] for line in lines]
+
+def readList(lang, name):
+	return list(enumerate(readLines(lang, name)))
+
+def readMap(lang, name):
+	values = {}
+	for line in readLines(lang, name):
+		key, _, value = line.partition(b'|')
+		values[int(key, 0)] = value
+	return sorted(values.items())
+
+def packTable(entries):
+	strings = b''
+	header = b''
+	base = len(entries) * 12
+	for key, value in entries:
+		header += struct.pack('<III', key, base + len(strings), len(value))
+		strings += value + b'\0'
+	return header + strings
+
+def packLanguage(lang):
+	tables = []
+	for i, name in enumerate(lists):
+		tables.append((i, readList(lang, name + '.txt')))
+	for i, name in enumerate(maps):
+		tables.append((len(lists) + i, readMap(lang, name + '.txt')))
+	for country, _ in tables[-1][1]:
+		tables.append((SUBREGIONS + country, readMap(lang, 'subregions/{:03d}.txt'.format(country))))
+
+	data = b''
+	directory = b''
+	offset = 12 + len(tables) * 16
+	for id, entries in tables:
+		table = packTable(entries)
+		directory += struct.pack('<IIII', id, len(entries), offset + len(data), len(table))
+		data += table
+		# Keep every table word aligned
+		data += b'\0' * (-len(data) % 4)
+
+	with open(os.path.join(ROOT, lang, 'strings.bin'), 'wb') as f:
+		f.write(b'I18N' + struct.pack('<II', VERSION, len(tables)) + directory + data)
+
+for lang in sorted(os.listdir(ROOT)):
+	if os.path.isdir(os.path.join(ROOT, lang)):
+		packLanguage(lang)
@@ -0,0 +1,122 @@
+/*
+ *   This file is part of PKSM
+ *   Copyright (C) 2016-2019 Bernardo Giordano, Admiral Fish, piepie62
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+ *       * Requiring preservation of specified reasonable legal notices or
+ *         author attributions in that material or in the Appropriate Legal
+ *         Notices displayed by works containing it.
+ *       * Prohibiting misrepresentation of the origin of that material,
+ *         or requiring that modified versions of such material be marked in
+ *         reasonable ways as different from the original version.
+ */
+
+#include "BankIndex.hpp"
+#include "PKX.hpp"
+#include "utils.hpp"
+
+namespace BankIndex
+{
+    bool Query::matches(const Entry& entry) const
+    {
+        if (entry.generation == (u8)Generation::UNUSED)
+        {
+            return false;
+        }
+        if (species && entry.species != *species)
+        {
+            return false;
+        }
+        if (form && entry.form != *form)
+        {
+            return false;
+        }
+        if (shiny && bool(entry.flags & SHINY) != *shiny)
+        {
+            return false;
+        }
+        if (otHash && entry.otHash != *otHash)
+        {
+            return false;
+        }
+        if (tid && entry.tid != *tid)
+        {
+            return false;
+        }
+        if (sid && entry.sid != *sid)
+        {
+            return false;
+        }
+        if (idHash && entry.idHash != *idHash)
+        {
+            return false;
+        }
+        if (minLevel && entry.level < *minLevel)
+        {
+            return false;
+        }
+        if (maxLevel && entry.level > *maxLevel)
+        {
+            return false;
+        }
+        if (ball && entry.ball != *ball)
+        {
+            return false;
+        }
+        if (generation && entry.generation != (u8)*generation)
+        {
+            return false;
+        }
+        return true;
+    }
+
+    Entry entry(const PKX& pkm)
+    {
+        if (pkm.species() == 0)
+        {
+            return empty();
+        }
+        Entry ret;
+        ret.species    = pkm.species();
+        ret.form       = pkm.alternativeForm();
+        ret.flags      = (pkm.shiny() ? SHINY : 0) | (pkm.egg() ? EGG : 0);
+        ret.tid        = pkm.TID();
+        ret.sid        = pkm.SID();
+        ret.otHash     = StringUtils::nameHash(pkm.rawOtName());
+        ret.idHash     = idHash(pkm.encryptionConstant(), pkm.PID());
+        ret.level      = pkm.level();
+        ret.ball       = pkm.ball();
+        ret.generation = (u8)pkm.generation();
+        ret.unused     = 0;
+        return ret;
+    }
+
+    Entry empty(void)
+    {
+        Entry ret;
+        std::fill_n((u8*)&ret, sizeof(Entry), 0);
+        ret.generation = (u8)Generation::UNUSED;
+        return ret;
+    }
+
+    u32 hash(const std::string& otName)
+    {
+        std::u16string name = StringUtils::UTF8toUTF16(otName);
+        return StringUtils::nameHash({(const u8*)name.data(), (int)name.size(), StringUtils::RawName::UTF16, u'\0'});
+    }
+
+    u32 idHash(u32 encryptionConstant, u32 PID) { return encryptionConstant ^ ((PID << 16) | (PID >> 16)); }
+}
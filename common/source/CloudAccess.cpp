@@ -30,7 +30,9 @@
 #include "app.hpp"
 #include "base64.hpp"
 #include "fetch.hpp"
+#include "fetchmulti.hpp"
 #include "thread.hpp"
+#include <algorithm>
 
 static Generation numToGen(int num)
 {
@@ -50,68 +52,178 @@ static Generation numToGen(int num)
     return Generation::UNUSED;
 }
 
-void downloadCloudPage(CloudAccess::PageDownloadInfo* info)
+static nlohmann::json downloadPage(int num, CloudAccess::SortType type, bool ascend, bool legal)
 {
-    if (info)
+    std::string retData;
+    auto fetch = Fetch::init(CloudAccess::makeURL(num, type, ascend, legal), false, true, &retData, nullptr, "");
+    if (fetch && fetch->perform() == CURLE_OK)
     {
-        std::string retData;
-        auto fetch = Fetch::init(CloudAccess::makeURL(info->number, info->type, info->ascend, info->legal), false, true, &retData, nullptr, "");
-        if (fetch && fetch->perform() == CURLE_OK)
+        long status_code;
+        fetch->getinfo(CURLINFO_RESPONSE_CODE, &status_code);
+        switch (status_code)
         {
-            long status_code;
-            fetch->getinfo(CURLINFO_RESPONSE_CODE, &status_code);
-            switch (status_code)
-            {
-                case 200:
-                    break;
-                default:
-                    info->page->data = {};
-            }
-            info->page->data = nlohmann::json::parse(retData, nullptr, false);
+            case 200:
+                break;
+            default:
+                return {};
         }
-        else
+        return nlohmann::json::parse(retData, nullptr, false);
+    }
+    return {};
+}
+
+static bool pageValid(const nlohmann::json& data)
+{
+    return !data.is_discarded() && data.size() > 0;
+}
+
+void prefetchWorker(CloudAccess* access)
+{
+    LightLock_Lock(&access->queueLock);
+    while (!access->exiting)
+    {
+        if (access->prefetchQueue.empty())
         {
-            info->page->data = {};
+            LightLock_Unlock(&access->queueLock);
+            LightEvent_Wait(&access->prefetchEvent);
+            LightLock_Lock(&access->queueLock);
+            continue;
         }
-        info->page->available = true;
-        delete info;
+        auto next = access->prefetchQueue.front();
+        access->prefetchQueue.pop_front();
+        LightLock_Unlock(&access->queueLock);
+
+        next.second->data = downloadPage(next.first.number, next.first.type, next.first.ascend, next.first.legal);
+        LightEvent_Signal(&next.second->available);
+
+        LightLock_Lock(&access->queueLock);
     }
+    LightLock_Unlock(&access->queueLock);
 }
 
 CloudAccess::CloudAccess() : pageNumber(1)
 {
+    LightLock_Init(&queueLock);
+    LightEvent_Init(&prefetchEvent, RESET_ONESHOT);
+    prefetchThread = Threads::createNetwork((ThreadFunc)prefetchWorker, this);
     refreshPages();
 }
 
+CloudAccess::~CloudAccess()
+{
+    if (prefetchThread)
+    {
+        LightLock_Lock(&queueLock);
+        exiting = true;
+        prefetchQueue.clear();
+        LightLock_Unlock(&queueLock);
+        LightEvent_Signal(&prefetchEvent);
+        threadJoin(prefetchThread, U64_MAX);
+        threadFree(prefetchThread);
+    }
+}
+
 void CloudAccess::refreshPages()
 {
-    current = std::make_shared<Page>();
-    if (current)
+    showPage(pageNumber);
+}
+
+std::shared_ptr<CloudAccess::Page> CloudAccess::cachedPage(const PageKey& key)
+{
+    auto found = std::find_if(cache.begin(), cache.end(), [&key](const auto& entry) { return entry.first == key; });
+    if (found == cache.end())
     {
-        current->data      = grabPage(pageNumber);
-        current->available = true;
-        isGood             = !current->data.is_discarded() && current->data.size() > 0;
+        return nullptr;
     }
+    std::shared_ptr<Page> page = found->second;
+    cache.erase(found);
+
+    // Still waiting for the prefetch thread to get to it; it's quicker to just fetch it now
+    LightLock_Lock(&queueLock);
+    auto queued = std::find_if(prefetchQueue.begin(), prefetchQueue.end(), [&key](const auto& entry) { return entry.first == key; });
+    if (queued != prefetchQueue.end())
+    {
+        prefetchQueue.erase(queued);
+        page = nullptr;
+    }
+    LightLock_Unlock(&queueLock);
+
+    if (page)
+    {
+        cache.emplace_front(key, page);
+    }
+    return page;
 }
 
-nlohmann::json CloudAccess::grabPage(int num)
+void CloudAccess::insertPage(const PageKey& key, std::shared_ptr<Page> page)
 {
-    std::string retData;
-    auto fetch = Fetch::init(makeURL(num, sort, ascend, legal), false, true, &retData, nullptr, "");
-    if (fetch && fetch->perform() == CURLE_OK)
+    cache.remove_if([&key](const auto& entry) { return entry.first == key; });
+    cache.emplace_front(key, page);
+    while (cache.size() > MAX_CACHED_PAGES)
     {
-        long status_code;
-        fetch->getinfo(CURLINFO_RESPONSE_CODE, &status_code);
-        switch (status_code)
+        LightLock_Lock(&queueLock);
+        prefetchQueue.remove_if([&](const auto& entry) { return entry.second == cache.back().second; });
+        LightLock_Unlock(&queueLock);
+        cache.pop_back();
+    }
+}
+
+void CloudAccess::prefetch(int number)
+{
+    PageKey pageKey = key(number);
+    if (!prefetchThread || std::any_of(cache.begin(), cache.end(), [&pageKey](const auto& entry) { return entry.first == pageKey; }))
+    {
+        return;
+    }
+    auto page = std::make_shared<Page>();
+    insertPage(pageKey, page);
+    LightLock_Lock(&queueLock);
+    prefetchQueue.emplace_back(pageKey, page);
+    LightLock_Unlock(&queueLock);
+    LightEvent_Signal(&prefetchEvent);
+}
+
+void CloudAccess::clearCache()
+{
+    LightLock_Lock(&queueLock);
+    prefetchQueue.clear();
+    LightLock_Unlock(&queueLock);
+    cache.clear();
+}
+
+void CloudAccess::showPage(int number)
+{
+    PageKey pageKey            = key(number);
+    std::shared_ptr<Page> page = cachedPage(pageKey);
+    if (page)
+    {
+        // Might be being downloaded by the prefetch thread right now
+        LightEvent_Wait(&page->available);
+    }
+    if (!page || !pageValid(page->data))
+    {
+        page       = std::make_shared<Page>();
+        page->data = downloadPage(number, sort, ascend, legal);
+        LightEvent_Signal(&page->available);
+        if (pageValid(page->data))
         {
-            case 200:
-                break;
-            default:
-                return {};
+            insertPage(pageKey, page);
         }
-        return nlohmann::json::parse(retData, nullptr, false);
     }
-    return {};
+
+    current    = page;
+    pageNumber = number;
+    isGood     = pageValid(current->data);
+    if (isGood && pages() > 1)
+    {
+        prefetch(pageNumber % pages() + 1);
+        prefetch(pageNumber == 1 ? pages() : pageNumber - 1);
+    }
+}
+
+nlohmann::json CloudAccess::grabPage(int num)
+{
+    return downloadPage(num, sort, ascend, legal);
 }
 
 static std::string sortTypeToString(CloudAccess::SortType type)
@@ -128,43 +240,55 @@ static std::string sortTypeToString(CloudAccess::SortType type)
 
 std::string CloudAccess::makeURL(int num, SortType type, bool ascend, bool legal)
 {
-    return "https://flagbrew.org/api/v1/gpss/all?pksm=yes&count=30&sort=" + sortTypeToString(type) +
+    return GPSS_SERVER "/api/v1/gpss/all?pksm=yes&count=30&sort=" + sortTypeToString(type) +
            "&dir=" + (ascend ? std::string("ascend") : std::string("descend")) + "&legal_only=" + (legal ? std::string("yes") : std::string("no")) +
            "&page=" + std::to_string(num);
 }
 
-std::shared_ptr<PKX> CloudAccess::pkm(size_t slot) const
+static std::shared_ptr<PKX> decodePkm(const nlohmann::json& result)
 {
-    if (slot < current->data["results"].size())
+    std::string b64Data = result["base_64"].get<std::string>();
+    Generation gen      = numToGen(result["generation"].get<int>());
+    // Legal info: needs thought
+    auto retData = base64_decode(b64Data.data(), b64Data.size());
+
+    size_t targetLength = 0;
+    switch (gen)
     {
-        std::string b64Data = current->data["results"][slot]["base_64"].get<std::string>();
-        Generation gen      = numToGen(current->data["results"][slot]["generation"].get<int>());
-        // Legal info: needs thought
-        auto retData = base64_decode(b64Data.data(), b64Data.size());
+        case Generation::FOUR:
+        case Generation::FIVE:
+            targetLength = 138;
+            break;
+        case Generation::SIX:
+        case Generation::SEVEN:
+            targetLength = 234;
+            break;
+        case Generation::LGPE:
+            targetLength = 261;
+            break;
+        default:
+            break;
+    }
+    if (targetLength != retData.size())
+    {
+        return nullptr;
+    }
 
-        size_t targetLength = 0;
-        switch (gen)
-        {
-            case Generation::FOUR:
-            case Generation::FIVE:
-                targetLength = 138;
-                break;
-            case Generation::SIX:
-            case Generation::SEVEN:
-                targetLength = 234;
-                break;
-            case Generation::LGPE:
-                targetLength = 261;
-                break;
-            default:
-                break;
-        }
-        if (targetLength != retData.size())
+    return PKX::getPKM(gen, retData.data());
+}
+
+std::shared_ptr<PKX> CloudAccess::pkm(size_t slot) const
+{
+    if (current->pkms.empty())
+    {
+        for (auto& result : current->data["results"])
         {
-            return std::make_shared<PK7>();
+            current->pkms.emplace_back(decodePkm(result));
         }
-
-        return PKX::getPKM(gen, retData.data());
+    }
+    if (slot < current->pkms.size() && current->pkms[slot])
+    {
+        return current->pkms[slot]->clone();
     }
     return std::make_shared<PK7>();
 }
@@ -182,80 +306,37 @@ void incrementPkmDownloadCount(std::string* num)
 {
     if (num)
     {
-        if (auto fetch = Fetch::init("https://flagbrew.org/gpss/download/" + *num, false, true, nullptr, nullptr, ""))
-        {
-            fetch->perform();
-        }
+        // Only bumps the counter, so there's no need to wait for it
+        FetchMulti::add(Fetch::init(GPSS_SERVER "/gpss/download/" + *num, false, true, nullptr, nullptr, ""));
         delete num;
     }
 }
 
 std::shared_ptr<PKX> CloudAccess::fetchPkm(size_t slot) const
 {
-    if (slot < current->data["results"].size())
+    std::shared_ptr<PKX> ret = pkm(slot);
+    if (slot < current->pkms.size() && current->pkms[slot])
     {
-        std::string b64Data = current->data["results"][slot]["base_64"].get<std::string>();
-        Generation gen      = numToGen(current->data["results"][slot]["generation"].get<int>());
-        // Legal info: needs thought
-        auto retData = base64_decode(b64Data.data(), b64Data.size());
-
-        size_t targetLength = 0;
-        switch (gen)
-        {
-            case Generation::FOUR:
-            case Generation::FIVE:
-                targetLength = 138;
-                break;
-            case Generation::SIX:
-            case Generation::SEVEN:
-                targetLength = 234;
-                break;
-            case Generation::LGPE:
-                targetLength = 261;
-                break;
-            default:
-                break;
-        }
-        if (targetLength != retData.size())
-        {
-            return std::make_shared<PK7>();
-        }
-
-        if (auto fetch = Fetch::init(
-                "https://flagbrew.org/gpss/download/" + current->data["results"][slot]["code"].get<std::string>(), false, true, nullptr, nullptr, ""))
-        {
-            fetch->perform();
-        }
-
-        return PKX::getPKM(gen, retData.data());
+        FetchMulti::add(Fetch::init(
+            GPSS_SERVER "/gpss/download/" + current->data["results"][slot]["code"].get<std::string>(), false, true, nullptr, nullptr, ""));
     }
-    return std::make_shared<PK7>();
+    return ret;
 }
 
 bool CloudAccess::nextPage()
 {
-    if (current->data["pages"].get<int>() > 1)
+    if (isGood && pages() > 1)
     {
-        pageNumber    = (pageNumber % current->data["pages"].get<int>()) + 1;
-        current->data = grabPage(pageNumber);
-        if (current->data.is_discarded() || current->data.size() == 0)
-        {
-            isGood = false;
-        }
+        showPage(pageNumber % pages() + 1);
     }
     return isGood;
 }
 
 bool CloudAccess::prevPage()
 {
-    if (current->data["pages"].get<int>() > 1)
+    if (isGood && pages() > 1)
     {
-        pageNumber    = pageNumber - 1 == 0 ? current->data["pages"].get<int>() : pageNumber - 1;
-        current->data = grabPage(pageNumber);
-        if (current->data.is_discarded() || current->data.size() == 0)
-        {
-            isGood = false;
-        }
+        showPage(pageNumber == 1 ? pages() : pageNumber - 1);
     }
     return isGood;
 }
@@ -278,7 +359,7 @@ bool CloudAccess::pkm(std::shared_ptr<PKX> mon)
     }
 
     std::string writeData = "";
-    if (auto fetch = Fetch::init("https://flagbrew.org/gpss/share", false, true, &writeData, headers, ""))
+    if (auto fetch = Fetch::init(GPSS_SERVER "/gpss/share", false, true, &writeData, headers, ""))
     {
         auto mimeThing       = fetch->mimeInit();
         curl_mimepart* field = curl_mime_addpart(mimeThing.get());
@@ -295,6 +376,7 @@ bool CloudAccess::pkm(std::shared_ptr<PKX> mon)
             switch (status_code)
             {
                 case 201:
+                    clearCache();
                     refreshPages();
                     // falls through
                 case 200:
@@ -25,124 +25,478 @@
  */
 
 #include "mysterygift.hpp"
+#include "Configuration.hpp"
+#include "mempressure.hpp"
+#include <algorithm>
+#include <iterator>
 
-static nlohmann::json mysteryGiftSheet;
-static u8* mysteryGiftData;
+// See common/EventsGalleryPacker/packer.py for the layout of gallery<gen>.bin
+struct GalleryHeader
+{
+    char magic[4];
+    u32 version;
+    u32 cards;
+    u32 matches;
+    u32 chunks;
+    u32 poolSize;
+    u32 tokens;
+    u32 species;
+    u32 games;
+    u32 postings;
+    u32 tokenPoolSize;
+};
 
-void MysteryGift::init(Generation g)
+struct CardRecord
 {
-    std::string path = StringUtils::format("romfs:/mg/sheet%s.json.bz2", genToCstring(g));
-    FILE* f          = fopen(path.c_str(), "rb");
-    if (f != NULL)
-    {
-        fseek(f, 0, SEEK_END);
-        size_t size          = ftell(f);
-        unsigned int destLen = 700 * 1024; // big enough
-        char* s              = new char[size];
-        char* d              = new char[destLen]();
-        rewind(f);
-        fread(s, 1, size, f);
+    u16 id;
+    u8 type;
+    u8 lang;
+    s16 species;
+    s8 form;
+    s8 gender;
+    u32 name;
+    u32 game;
+    u16 chunk;
+    u16 padding;
+    u32 offset;
+    u32 size;
+};
+
+struct ChunkRecord
+{
+    u32 offset;
+    u32 compressedSize;
+    u32 size;
+};
+
+struct TokenRecord
+{
+    u32 text;
+    u32 length;
+    u32 postings;
+    u32 count;
+};
+
+struct SpeciesRecord
+{
+    u16 species;
+    u16 padding;
+    u32 postings;
+    u32 count;
+};
 
-        int r = BZ2_bzBuffToBuffDecompress(d, &destLen, s, size, 0, 0);
-        if (r == BZ_OK)
+static_assert(sizeof(GalleryHeader) == 44 && sizeof(CardRecord) == 28 && sizeof(ChunkRecord) == 12 && sizeof(MysteryGift::giftMatch) == 24 &&
+                  sizeof(TokenRecord) == 16 && sizeof(SpeciesRecord) == 12,
+    "Gallery records must match the packed layout");
+
+static constexpr u32 GALLERY_VERSION = 2;
+// matchLangs in packer.py
+static constexpr Language matchLangs[] = {Language::ZH, Language::TW, Language::EN, Language::FR, Language::DE, Language::IT, Language::JP,
+    Language::KO, Language::ES};
+// Facet bitmaps after the language ones
+static constexpr size_t FACET_ITEM  = std::size(matchLangs);
+static constexpr size_t FACET_SHINY = FACET_ITEM + 1;
+static constexpr size_t FACET_GAMES = FACET_SHINY + 1;
+
+// The index stays loaded until the generation changes or the app exits, so reopening the gallery costs nothing
+static Generation galleryGen = Generation::UNUSED;
+static FILE* gallery         = nullptr;
+static std::vector<CardRecord> cards;
+static std::vector<MysteryGift::giftMatch> matches;
+static std::vector<ChunkRecord> chunks;
+static std::vector<char> names;
+// Search index built by the packer
+static std::vector<TokenRecord> tokens;
+static std::vector<SpeciesRecord> speciesPostings;
+static std::vector<u32> gameNames;
+static std::vector<std::string> gameList;
+static std::vector<u32> facets;
+static std::vector<u16> postings;
+static std::vector<char16_t> tokenText;
+// Decompressed chunks, dropped least recently used first once they go over the budget
+static std::vector<std::unique_ptr<u8[]>> chunkData;
+static std::vector<u32> chunkUse;
+static u32 useTick          = 0;
+static size_t residentBytes = 0;
+static size_t maxResident   = 0;
+
+template <typename T>
+static bool readTable(std::vector<T>& out, u32 count)
+{
+    out.resize(count);
+    return fread(out.data(), sizeof(T), count, gallery) == count;
+}
+
+static bool evictChunk(void)
+{
+    size_t victim = SIZE_MAX;
+    for (size_t i = 0; i < chunkData.size(); i++)
+    {
+        if (chunkData[i] && (victim == SIZE_MAX || chunkUse[i] < chunkUse[victim]))
         {
-            mysteryGiftSheet = nlohmann::json::parse(d);
+            victim = i;
         }
+    }
+    if (victim == SIZE_MAX)
+    {
+        return false;
+    }
+    chunkData[victim] = nullptr;
+    residentBytes -= chunks[victim].size;
+    return true;
+}
 
-        delete[] s;
-        delete[] d;
+static size_t releaseChunks(size_t bytes)
+{
+    size_t before = residentBytes;
+    while (before - residentBytes < bytes && evictChunk())
+        ;
+    return before - residentBytes;
+}
+
+static u8* loadChunk(u16 index)
+{
+    if (index >= chunks.size())
+    {
+        return nullptr;
     }
+    if (!chunkData[index])
+    {
+        const ChunkRecord& chunk = chunks[index];
+        while (residentBytes + chunk.size > maxResident && evictChunk())
+            ;
+        auto compressed      = std::make_unique<char[]>(chunk.compressedSize);
+        auto data            = std::make_unique<u8[]>(chunk.size);
+        unsigned int destLen = chunk.size;
+        if (fseek(gallery, chunk.offset, SEEK_SET) != 0 || fread(compressed.get(), 1, chunk.compressedSize, gallery) != chunk.compressedSize ||
+            BZ2_bzBuffToBuffDecompress((char*)data.get(), &destLen, compressed.get(), chunk.compressedSize, 0, 0) != BZ_OK ||
+            destLen != chunk.size)
+        {
+            return nullptr;
+        }
+        chunkData[index] = std::move(data);
+        residentBytes += chunk.size;
+    }
+    chunkUse[index] = ++useTick;
+    return chunkData[index].get();
+}
 
-    if (mysteryGiftSheet.is_discarded())
+static const char* poolString(u32 offset)
+{
+    return offset < names.size() ? names.data() + offset : "";
+}
+
+static size_t bitmapWords(void)
+{
+    return (matches.size() + 31) / 32;
+}
+
+static bool indexValid(const GalleryHeader& header)
+{
+    for (auto& token : tokens)
+    {
+        if (token.text + token.length > tokenText.size() || token.postings + token.count > header.postings)
+        {
+            return false;
+        }
+    }
+    for (auto& species : speciesPostings)
+    {
+        if (species.postings + species.count > header.postings)
+        {
+            return false;
+        }
+    }
+    for (size_t i = 0; i < header.postings; i++)
     {
-        mysteryGiftSheet            = nlohmann::json::object();
-        mysteryGiftSheet["gen"]     = "BAD";
-        mysteryGiftSheet["matches"] = nlohmann::json::array();
+        if (postings[i] >= matches.size())
+        {
+            return false;
+        }
     }
+    return true;
+}
 
-    path = StringUtils::format("romfs:/mg/data%s.bin.bz2", genToCstring(g));
-    f    = fopen(path.c_str(), "rb");
-    if (f != NULL)
+// Must match isSeparator in packer.py
+static bool isSeparator(char16_t c)
+{
+    switch (c)
     {
-        fseek(f, 0, SEEK_END);
-        u32 size             = ftell(f);
-        unsigned int destLen = 800 * 1024;
-        char* s              = new char[size];
-        mysteryGiftData      = new u8[destLen]();
-        rewind(f);
-        fread(s, 1, size, f);
+        case u'\u2019':
+        case u'\u2026':
+        case u'\u3001':
+        case u'\u3002':
+        case u'\u300C':
+        case u'\u300D':
+        case u'\u30FB':
+            return true;
+        default:
+            return c < 0x80 && !((c >= u'0' && c <= u'9') || (c >= u'a' && c <= u'z') || (c >= u'A' && c <= u'Z'));
+    }
+}
 
-        int r = BZ2_bzBuffToBuffDecompress((char*)mysteryGiftData, &destLen, s, size, 0, 0);
-        if (r != BZ_OK)
+// Negative, zero or positive as token sorts before, starts with or sorts after prefix
+static int comparePrefix(const TokenRecord& token, const char16_t* prefix, size_t length)
+{
+    const char16_t* text = tokenText.data() + token.text;
+    for (size_t i = 0; i < std::min((size_t)token.length, length); i++)
+    {
+        if (text[i] != prefix[i])
         {
-            // TODO
+            return text[i] < prefix[i] ? -1 : 1;
         }
+    }
+    return token.length < length ? -1 : 0;
+}
+
+static void setPostings(std::vector<u32>& bitmap, u32 first, u32 count)
+{
+    for (u32 i = first; i < first + count; i++)
+    {
+        bitmap[postings[i] / 32] |= 1u << (postings[i] % 32);
+    }
+}
+
+static void intersect(std::vector<u32>& result, const u32* bitmap, bool include)
+{
+    for (size_t i = 0; i < result.size(); i++)
+    {
+        result[i] &= include ? bitmap[i] : ~bitmap[i];
+    }
+}
+
+void MysteryGift::init(Generation g)
+{
+    memoryBudget((size_t)Configuration::getInstance().giftMemory() * 1024);
+    if (gallery != nullptr && galleryGen == g)
+    {
+        return;
+    }
+    exit();
 
-        delete[] s;
+    std::string path = StringUtils::format("romfs:/mg/gallery%s.bin", genToCstring(g));
+    gallery          = fopen(path.c_str(), "rb");
+    if (gallery == NULL)
+    {
+        return;
+    }
+
+    GalleryHeader header;
+    if (fread(&header, sizeof(header), 1, gallery) != 1 || memcmp(header.magic, "PKMG", 4) != 0 || header.version != GALLERY_VERSION ||
+        !readTable(cards, header.cards) || !readTable(matches, header.matches) || !readTable(chunks, header.chunks) ||
+        !readTable(names, header.poolSize) || (!names.empty() && names.back() != '\0') || !readTable(tokens, header.tokens) ||
+        !readTable(speciesPostings, header.species) || !readTable(gameNames, header.games) ||
+        !readTable(facets, (FACET_GAMES + header.games) * bitmapWords()) || !readTable(postings, (header.postings + 1) & ~1) ||
+        !readTable(tokenText, header.tokenPoolSize) || !indexValid(header))
+    {
+        exit();
+        return;
     }
+    for (auto& game : gameNames)
+    {
+        gameList.emplace_back(poolString(game));
+    }
+    chunkData.resize(chunks.size());
+    chunkUse.resize(chunks.size(), 0);
+    galleryGen = g;
+    MemoryPressure::addHandler(releaseChunks);
+}
+
+void MysteryGift::memoryBudget(size_t bytes)
+{
+    maxResident = bytes;
+    while (residentBytes > maxResident && evictChunk())
+        ;
 }
 
 std::unique_ptr<WCX> MysteryGift::wondercard(size_t index)
 {
-    std::string gen = mysteryGiftSheet["gen"];
+    if (index >= cards.size())
+    {
+        return nullptr;
+    }
+
+    const CardRecord& card = cards[index];
+    u8* data               = loadChunk(card.chunk);
+    if (data == nullptr || card.offset + card.size > chunks[card.chunk].size)
+    {
+        return nullptr;
+    }
+    data += card.offset;
+
+    switch ((giftType)card.type)
+    {
+        case giftType::WC4:
+            return std::make_unique<WC4>(data);
+        case giftType::PGT:
+            return std::make_unique<PGT>(data);
+        case giftType::PGF:
+            return std::make_unique<PGF>(data);
+        case giftType::WC6:
+        case giftType::WC6FULL:
+            return std::make_unique<WC6>(data, card.type == (u8)giftType::WC6FULL);
+        case giftType::WC7:
+        case giftType::WC7FULL:
+            return std::make_unique<WC7>(data, card.type == (u8)giftType::WC7FULL);
+        case giftType::WB7:
+        case giftType::WB7FULL:
+            return std::make_unique<WB7>(data, card.type == (u8)giftType::WB7FULL);
+        default:
+            return nullptr;
+    }
+}
+
+void MysteryGift::exit(void)
+{
+    if (gallery)
+    {
+        fclose(gallery);
+        gallery = nullptr;
+    }
+    MemoryPressure::removeHandler(releaseChunks);
+    galleryGen = Generation::UNUSED;
+    cards.clear();
+    matches.clear();
+    chunks.clear();
+    names.clear();
+    tokens.clear();
+    speciesPostings.clear();
+    gameNames.clear();
+    gameList.clear();
+    facets.clear();
+    postings.clear();
+    tokenText.clear();
+    chunkData.clear();
+    chunkUse.clear();
+    residentBytes = 0;
+}
 
-    auto entry = mysteryGiftSheet["wondercards"][index];
+const std::vector<MysteryGift::giftMatch>& MysteryGift::wondercards()
+{
+    return matches;
+}
 
-    u32 offset = entry["offset"];
+const std::vector<std::string>& MysteryGift::games()
+{
+    return gameList;
+}
 
-    if (gen == "4")
+std::vector<size_t> MysteryGift::search(const giftQuery& query)
+{
+    std::vector<u32> result(bitmapWords(), 0xFFFFFFFF);
+    if (matches.size() % 32 != 0)
     {
-        std::unique_ptr<WCX> wc = nullptr;
-        if (entry["type"] == "wc4")
-        {
-            wc = std::make_unique<WC4>(mysteryGiftData + offset);
-        }
-        else
+        result.back() = (1u << (matches.size() % 32)) - 1;
+    }
+
+    if (query.language)
+    {
+        auto lang = std::find(std::begin(matchLangs), std::end(matchLangs), *query.language);
+        if (lang == std::end(matchLangs))
         {
-            wc = std::make_unique<PGT>(mysteryGiftData + offset);
+            return {};
         }
-        return wc;
+        intersect(result, facets.data() + (lang - std::begin(matchLangs)) * result.size(), true);
     }
-    else if (gen == "5")
+    if (query.item)
     {
-        PGF* pgf = new PGF(mysteryGiftData + offset);
-        return std::unique_ptr<WCX>(pgf);
+        intersect(result, facets.data() + FACET_ITEM * result.size(), *query.item);
     }
-    else if (gen == "6")
+    if (query.shiny)
     {
-        WC6* wc6 = new WC6(mysteryGiftData + offset, entry["type"].get<std::string>().find("full") != std::string::npos);
-        return std::unique_ptr<WCX>(wc6);
+        intersect(result, facets.data() + FACET_SHINY * result.size(), *query.shiny);
     }
-    else if (gen == "7")
+    if (query.game >= 0)
     {
-        WC7* wc7 = new WC7(mysteryGiftData + offset, entry["type"].get<std::string>().find("full") != std::string::npos);
-        return std::unique_ptr<WCX>(wc7);
+        if ((size_t)query.game >= gameNames.size())
+        {
+            return {};
+        }
+        intersect(result, facets.data() + (FACET_GAMES + query.game) * result.size(), true);
     }
-    else if (gen == "LGPE")
+
+    std::vector<u32> bitmap(result.size());
+    if (query.species)
     {
-        WB7* wb7 = new WB7(mysteryGiftData + offset, entry["type"].get<std::string>().find("full") != std::string::npos);
-        return std::unique_ptr<WCX>(wb7);
+        auto species = std::lower_bound(speciesPostings.begin(), speciesPostings.end(), *query.species,
+            [](const SpeciesRecord& record, u16 species) { return record.species < species; });
+        if (species != speciesPostings.end() && species->species == *query.species)
+        {
+            setPostings(bitmap, species->postings, species->count);
+        }
+        intersect(result, bitmap.data(), true);
     }
-    else
+
+    std::u16string text = StringUtils::fold(query.text);
+    for (size_t start = 0; start < text.size();)
     {
-        return nullptr;
+        size_t end = start;
+        while (end < text.size() && !isSeparator(text[end]))
+        {
+            end++;
+        }
+        if (end > start)
+        {
+            auto before = [&](const TokenRecord& token) { return comparePrefix(token, text.data() + start, end - start) < 0; };
+            auto within = [&](const TokenRecord& token) { return comparePrefix(token, text.data() + start, end - start) == 0; };
+            auto first  = std::partition_point(tokens.begin(), tokens.end(), before);
+            auto last   = std::partition_point(first, tokens.end(), within);
+            std::fill(bitmap.begin(), bitmap.end(), 0);
+            for (; first != last; ++first)
+            {
+                setPostings(bitmap, first->postings, first->count);
+            }
+            intersect(result, bitmap.data(), true);
+        }
+        start = end + 1;
     }
+
+    std::vector<size_t> ret;
+    for (size_t i = 0; i < result.size(); i++)
+    {
+        for (u32 word = result[i]; word != 0; word &= word - 1)
+        {
+            ret.push_back(i * 32 + __builtin_ctz(word));
+        }
+    }
+    return ret;
 }
 
-void MysteryGift::exit(void)
+MysteryGift::giftData MysteryGift::wondercardInfo(size_t index)
 {
-    delete[] mysteryGiftData;
-    mysteryGiftSheet.clear();
+    if (index >= cards.size())
+    {
+        return giftData();
+    }
+    const CardRecord& card = cards[index];
+    return giftData(poolString(card.name), poolString(card.game), card.species, card.form, card.gender);
 }
 
-std::vector<nlohmann::json> MysteryGift::wondercards()
+bool MysteryGift::giftMatch::contains(Language lang) const
 {
-    return mysteryGiftSheet["matches"];
+    return index(lang) != NO_CARD;
 }
 
-MysteryGift::giftData MysteryGift::wondercardInfo(size_t index)
+u16 MysteryGift::giftMatch::index(Language lang) const
 {
-    nlohmann::json entry = mysteryGiftSheet["wondercards"][index];
-    giftData ret(entry["name"].get<std::string>(), entry["game"].get<std::string>(), entry["species"].get<int>(), entry["form"].get<int>());
-    return ret;
+    for (size_t i = 0; i < indices.size(); i++)
+    {
+        if (matchLangs[i] == lang)
+        {
+            return indices[i];
+        }
+    }
+    return NO_CARD;
+}
+
+Language MysteryGift::giftMatch::language(void) const
+{
+    for (size_t i = 0; i < indices.size(); i++)
+    {
+        if (indices[i] != NO_CARD)
+        {
+            return matchLangs[i];
+        }
+    }
+    return Language::UNUSED;
 }
@@ -54,6 +54,7 @@ struct LibraryFunction UnixFunctions[] =
     { net_udp_receiver,     "int net_udp_recv(char* buffer, int size, int* received);" },
     // i18n
     { i18n_species,         "char* i18n_species(int species);" },
+    { i18n_search,          "int i18n_search(enum Search_Category category, enum Generation gen, char* query, int substring, int* out, int max);" },
     // text conversion
     { pksm_utf16_to_utf8,   "char* utf16_to_utf8(char* data);" },
     { pksm_utf8_to_utf16,   "char* utf8_to_utf16(char* data);" },
@@ -78,5 +79,6 @@ void PlatformLibraryInit(Picoc *pc)
                     "SAV_LANGUAGE, SAV_MONEY, SAV_BP, SAV_HOURS, SAV_MINUTES, SAV_SECONDS, SAV_ITEM };"
     "enum SAV_MaxField { MAX_SLOTS, MAX_BOXES, MAX_WONDER_CARDS, MAX_SPECIES, MAX_MOVE, MAX_ITEM,"
                     "MAX_ABILITY, MAX_BALL, MAX_FORM };"
+    "enum Search_Category { SEARCH_SPECIES, SEARCH_MOVES, SEARCH_ITEMS, SEARCH_LOCATIONS };"
     "enum Pouch { NormalItem, KeyItem, TM, Mail, Medicine, Berry, Ball, Battle, Candy, ZCrystals };");
 }
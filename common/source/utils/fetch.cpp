@@ -25,13 +25,96 @@
  */
 
 #include "fetch.hpp"
+#include "platform.h"
+#include <array>
 #include <errno.h>
 #include <stdarg.h>
 #include <stdio.h>
 #include <time.h>
+#include <vector>
 
 #define SPEED_TOO_SLOW 300
 #define CALLS_TOO_SLOW 100
+#define MAX_IDLE_HANDLES 4
+
+namespace
+{
+    struct HandlePool
+    {
+        HandlePool()
+        {
+            LightLock_Init(&lock);
+            for (auto& shareLock : shareLocks)
+            {
+                LightLock_Init(&shareLock);
+            }
+        }
+        LightLock lock;
+        // One per kind of shared data, as libcurl asks for them independently
+        std::array<LightLock, CURL_LOCK_DATA_LAST> shareLocks;
+        std::vector<CURL*> idle;
+        CURLSH* share = nullptr;
+        bool closed   = false;
+    } pool;
+
+    void lockShare(CURL*, curl_lock_data data, curl_lock_access, void*)
+    {
+        LightLock_Lock(&pool.shareLocks[data]);
+    }
+
+    void unlockShare(CURL*, curl_lock_data data, void*)
+    {
+        LightLock_Unlock(&pool.shareLocks[data]);
+    }
+
+    // Must be called with the pool locked
+    CURLSH* shareHandle(void)
+    {
+        if (!pool.share && !pool.closed)
+        {
+            pool.share = curl_share_init();
+            if (pool.share)
+            {
+                curl_share_setopt(pool.share, CURLSHOPT_LOCKFUNC, lockShare);
+                curl_share_setopt(pool.share, CURLSHOPT_UNLOCKFUNC, unlockShare);
+                curl_share_setopt(pool.share, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+                curl_share_setopt(pool.share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+            }
+        }
+        return pool.share;
+    }
+
+    CURL* acquireHandle(CURLSH** share)
+    {
+        CURL* handle = nullptr;
+        LightLock_Lock(&pool.lock);
+        if (!pool.idle.empty())
+        {
+            handle = pool.idle.back();
+            pool.idle.pop_back();
+        }
+        *share = shareHandle();
+        LightLock_Unlock(&pool.lock);
+        return handle ? handle : curl_easy_init();
+    }
+
+    void releaseHandle(CURL* handle)
+    {
+        // Drops every option, and with them any pointers into the caller's buffers, while keeping the handle's caches
+        curl_easy_reset(handle);
+        LightLock_Lock(&pool.lock);
+        if (!pool.closed && pool.idle.size() < MAX_IDLE_HANDLES)
+        {
+            pool.idle.push_back(handle);
+            handle = nullptr;
+        }
+        LightLock_Unlock(&pool.lock);
+        if (handle)
+        {
+            curl_easy_cleanup(handle);
+        }
+    }
+}
 
 static size_t string_write_callback(char* ptr, size_t size, size_t nmemb, void* userdata)
 {
@@ -43,10 +126,12 @@ static size_t string_write_callback(char* ptr, size_t size, size_t nmemb, void*
 std::unique_ptr<Fetch> Fetch::init(
     const std::string& url, bool post, bool ssl, std::string* writeData, struct curl_slist* headers, const std::string& postdata)
 {
-    auto fetch  = std::unique_ptr<Fetch>(new Fetch);
-    fetch->curl = std::unique_ptr<CURL, decltype(curl_easy_cleanup)*>(curl_easy_init(), &curl_easy_cleanup);
+    CURLSH* share = nullptr;
+    auto fetch    = std::unique_ptr<Fetch>(new Fetch);
+    fetch->curl   = std::unique_ptr<CURL, decltype(curl_easy_cleanup)*>(acquireHandle(&share), &releaseHandle);
     if (fetch->curl)
     {
+        fetch->setopt(CURLOPT_SHARE, share);
         fetch->setopt(CURLOPT_URL, url.c_str());
         fetch->setopt(CURLOPT_HTTPHEADER, headers);
         if (ssl)
@@ -68,6 +153,9 @@ std::unique_ptr<Fetch> Fetch::init(
         fetch->setopt(CURLOPT_FOLLOWLOCATION, 1L);
         fetch->setopt(CURLOPT_LOW_SPEED_LIMIT, 300L);
         fetch->setopt(CURLOPT_LOW_SPEED_TIME, 30);
+        fetch->setopt(CURLOPT_TCP_KEEPALIVE, 1L);
+        fetch->setopt(CURLOPT_TCP_KEEPIDLE, 30L);
+        fetch->setopt(CURLOPT_TCP_KEEPINTVL, 15L);
     }
     else
     {
@@ -153,6 +241,27 @@ Result Fetch::download(
     return 0;
 }
 
+void Fetch::exit(void)
+{
+    LightLock_Lock(&pool.lock);
+    pool.closed             = true;
+    std::vector<CURL*> idle = std::move(pool.idle);
+    CURLSH* share           = pool.share;
+    pool.idle.clear();
+    pool.share = nullptr;
+    LightLock_Unlock(&pool.lock);
+
+    for (auto handle : idle)
+    {
+        curl_easy_cleanup(handle);
+    }
+    // Fails if a Fetch is still alive somewhere; the share is then simply left to the OS along with it
+    if (share)
+    {
+        curl_share_cleanup(share);
+    }
+}
+
 std::unique_ptr<curl_mime, decltype(curl_mime_free)*> Fetch::mimeInit()
 {
     if (curl)
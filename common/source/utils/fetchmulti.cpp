@@ -0,0 +1,244 @@
+/*
+ *   This file is part of PKSM
+ *   Copyright (C) 2016-2019 Bernardo Giordano, Admiral Fish, piepie62, Allen Lydiard
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+ *       * Requiring preservation of specified reasonable legal notices or
+ *         author attributions in that material or in the Appropriate Legal
+ *         Notices displayed by works containing it.
+ *       * Prohibiting misrepresentation of the origin of that material,
+ *         or requiring that modified versions of such material be marked in
+ *         reasonable ways as different from the original version.
+ */
+
+#include "fetchmulti.hpp"
+#include "thread.hpp"
+#include <algorithm>
+#include <list>
+#include <stdio.h>
+#include <vector>
+
+// How long the worker waits on its sockets before checking for newly added transfers, in milliseconds
+#define POLL_INTERVAL 50
+
+namespace
+{
+    CURLM* multi  = nullptr;
+    Thread worker = nullptr;
+    size_t maxActive;
+    // Everything below is guarded by queueLock
+    LightLock queueLock;
+    LightEvent queueEvent;
+    std::list<std::shared_ptr<FetchMulti::Request>> queue;
+    bool running = false;
+    bool exiting = false;
+}
+
+FetchMulti::Request::Request(std::unique_ptr<Fetch> fetch, Callback callback) : handle(std::move(fetch)), callback(std::move(callback))
+{
+    LightEvent_Init(&event, RESET_STICKY);
+}
+
+CURLcode FetchMulti::Request::wait(void)
+{
+    LightEvent_Wait(&event);
+    return result;
+}
+
+void FetchMulti::Request::finish(CURLcode code)
+{
+    result = code;
+    if (callback)
+    {
+        callback(code, *handle);
+    }
+    finished = true;
+    LightEvent_Signal(&event);
+}
+
+void FetchMulti::workerMain(void*)
+{
+    std::vector<std::shared_ptr<FetchMulti::Request>> active;
+    LightLock_Lock(&queueLock);
+    while (!exiting)
+    {
+        while (!queue.empty() && active.size() < maxActive)
+        {
+            active.emplace_back(std::move(queue.front()));
+            queue.pop_front();
+            curl_easy_setopt(active.back()->handle->curl.get(), CURLOPT_PRIVATE, active.back().get());
+            curl_multi_add_handle(multi, active.back()->handle->curl.get());
+        }
+        LightLock_Unlock(&queueLock);
+
+        if (active.empty())
+        {
+            LightEvent_Wait(&queueEvent);
+        }
+        else
+        {
+            int stillRunning;
+            curl_multi_perform(multi, &stillRunning);
+
+            CURLMsg* msg;
+            int left;
+            while ((msg = curl_multi_info_read(multi, &left)))
+            {
+                if (msg->msg == CURLMSG_DONE)
+                {
+                    CURL* easy      = msg->easy_handle;
+                    CURLcode result = msg->data.result;
+                    FetchMulti::Request* request;
+                    curl_easy_getinfo(easy, CURLINFO_PRIVATE, &request);
+                    curl_multi_remove_handle(multi, easy);
+
+                    auto found = std::find_if(active.begin(), active.end(), [request](const auto& entry) { return entry.get() == request; });
+                    std::shared_ptr<FetchMulti::Request> done = std::move(*found);
+                    active.erase(found);
+                    done->finish(result);
+                }
+            }
+
+            if (!active.empty())
+            {
+                curl_multi_wait(multi, nullptr, 0, POLL_INTERVAL, nullptr);
+            }
+        }
+
+        LightLock_Lock(&queueLock);
+    }
+    LightLock_Unlock(&queueLock);
+
+    for (auto& request : active)
+    {
+        curl_multi_remove_handle(multi, request->handle->curl.get());
+        request->finish(CURLE_ABORTED_BY_CALLBACK);
+    }
+}
+
+Result FetchMulti::init(size_t maxTransfers)
+{
+    if (worker)
+    {
+        return 0;
+    }
+
+    LightLock_Init(&queueLock);
+    LightEvent_Init(&queueEvent, RESET_ONESHOT);
+    maxActive = std::max(maxTransfers, (size_t)1);
+    exiting   = false;
+    if (!(multi = curl_multi_init()))
+    {
+        return -1;
+    }
+
+    if (!(worker = Threads::createNetwork(workerMain)))
+    {
+        curl_multi_cleanup(multi);
+        multi = nullptr;
+        return -1;
+    }
+    running = true;
+    return 0;
+}
+
+void FetchMulti::exit(void)
+{
+    if (!worker)
+    {
+        return;
+    }
+
+    LightLock_Lock(&queueLock);
+    exiting = true;
+    running = false;
+    std::list<std::shared_ptr<Request>> unstarted = std::move(queue);
+    queue.clear();
+    LightLock_Unlock(&queueLock);
+    LightEvent_Signal(&queueEvent);
+
+    threadJoin(worker, U64_MAX);
+    threadFree(worker);
+    worker = nullptr;
+    curl_multi_cleanup(multi);
+    multi = nullptr;
+
+    for (auto& request : unstarted)
+    {
+        request->finish(CURLE_ABORTED_BY_CALLBACK);
+    }
+}
+
+std::shared_ptr<FetchMulti::Request> FetchMulti::add(std::unique_ptr<Fetch> fetch, Callback callback)
+{
+    if (!fetch)
+    {
+        return nullptr;
+    }
+
+    auto request = std::shared_ptr<Request>(new Request(std::move(fetch), callback));
+    bool queued  = false;
+    if (worker)
+    {
+        LightLock_Lock(&queueLock);
+        if ((queued = running))
+        {
+            queue.push_back(request);
+        }
+        LightLock_Unlock(&queueLock);
+    }
+
+    if (queued)
+    {
+        LightEvent_Signal(&queueEvent);
+    }
+    else
+    {
+        request->finish(request->handle->perform());
+    }
+    return request;
+}
+
+std::shared_ptr<FetchMulti::Request> FetchMulti::download(const std::string& url, const std::string& path, Callback callback)
+{
+    FILE* file = fopen(path.c_str(), "wb");
+    if (!file)
+    {
+        return nullptr;
+    }
+
+    auto fetch = Fetch::init(url, false, true, nullptr, nullptr, "");
+    if (!fetch)
+    {
+        fclose(file);
+        remove(path.c_str());
+        return nullptr;
+    }
+    fetch->setopt(CURLOPT_WRITEFUNCTION, fwrite);
+    fetch->setopt(CURLOPT_WRITEDATA, file);
+
+    return add(std::move(fetch), [file, path, callback](CURLcode result, Fetch& fetch) {
+        fclose(file);
+        if (result != CURLE_OK)
+        {
+            remove(path.c_str());
+        }
+        if (callback)
+        {
+            callback(result, fetch);
+        }
+    });
+}
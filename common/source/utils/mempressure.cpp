@@ -0,0 +1,54 @@
+/*
+ *   This file is part of PKSM
+ *   Copyright (C) 2016-2019 Bernardo Giordano, Admiral Fish, piepie62
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+ *       * Requiring preservation of specified reasonable legal notices or
+ *         author attributions in that material or in the Appropriate Legal
+ *         Notices displayed by works containing it.
+ *       * Prohibiting misrepresentation of the origin of that material,
+ *         or requiring that modified versions of such material be marked in
+ *         reasonable ways as different from the original version.
+ */
+
+#include "mempressure.hpp"
+#include <algorithm>
+#include <vector>
+
+static std::vector<MemoryPressure::Handler> handlers;
+
+void MemoryPressure::addHandler(Handler handler)
+{
+    if (std::find(handlers.begin(), handlers.end(), handler) == handlers.end())
+    {
+        handlers.push_back(handler);
+    }
+}
+
+void MemoryPressure::removeHandler(Handler handler)
+{
+    handlers.erase(std::remove(handlers.begin(), handlers.end(), handler), handlers.end());
+}
+
+size_t MemoryPressure::release(size_t bytes)
+{
+    size_t freed = 0;
+    for (size_t i = 0; i < handlers.size() && freed < bytes; i++)
+    {
+        freed += handlers[i](bytes - freed);
+    }
+    return freed;
+}
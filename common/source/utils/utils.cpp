@@ -37,6 +37,107 @@
 #include <switch.h>
 #endif
 
+namespace
+{
+    // Gen 4 character values are dense up to here; only the terminator lies beyond
+    constexpr size_t G4_DECODE_SIZE = G4Values[G4TEXT_LENGTH - 2] + 1;
+
+    struct G4DecodeTable
+    {
+        char16_t chars[G4_DECODE_SIZE];
+    };
+
+    constexpr G4DecodeTable makeG4Decode(void)
+    {
+        G4DecodeTable ret{};
+        for (size_t i = 0; i < G4_DECODE_SIZE; i++)
+        {
+            ret.chars[i] = 0xFFFF;
+        }
+        for (size_t i = 0; i < G4TEXT_LENGTH - 1; i++)
+        {
+            ret.chars[G4Values[i]] = G4Chars[i];
+        }
+        return ret;
+    }
+
+    constexpr size_t countG4Pages(void)
+    {
+        bool used[256] = {};
+        size_t count   = 0;
+        for (size_t i = 0; i < G4TEXT_LENGTH; i++)
+        {
+            if (!used[G4Chars[i] >> 8])
+            {
+                used[G4Chars[i] >> 8] = true;
+                count++;
+            }
+        }
+        return count;
+    }
+
+    // Code points are looked up by their high byte, then their low byte. Page 0 stays empty for the high bytes with no
+    // Gen 4 characters at all
+    constexpr size_t G4_ENCODE_PAGES = countG4Pages() + 1;
+
+    struct G4EncodeTable
+    {
+        u8 pages[256];
+        u16 values[G4_ENCODE_PAGES][256];
+    };
+
+    constexpr G4EncodeTable makeG4Encode(void)
+    {
+        G4EncodeTable ret{};
+        size_t nextPage = 1;
+        for (size_t i = 0; i < G4TEXT_LENGTH; i++)
+        {
+            u8& page = ret.pages[G4Chars[i] >> 8];
+            if (!page)
+            {
+                page = nextPage++;
+            }
+            // Some characters have more than one value; the first one wins
+            u16& value = ret.values[page][G4Chars[i] & 0xFF];
+            if (!value)
+            {
+                value = G4Values[i];
+            }
+        }
+        return ret;
+    }
+
+    constexpr G4DecodeTable g4Decode = makeG4Decode();
+    constexpr G4EncodeTable g4Encode = makeG4Encode();
+}
+
+// Unknown values decode as the terminator
+static char16_t g4ToCodepoint(u16 value)
+{
+    return value < G4_DECODE_SIZE ? g4Decode.chars[value] : 0xFFFF;
+}
+
+// Code points with no Gen 4 character encode as 0
+static u16 codepointToG4(char16_t codepoint)
+{
+    return g4Encode.values[g4Encode.pages[codepoint >> 8]][codepoint & 0xFF];
+}
+
+// Decodes at most len characters, stopping at the terminator. Returns how many were written to out
+static size_t decodeG4(const u8* data, int len, char16_t* out)
+{
+    for (int i = 0; i < len; i++)
+    {
+        char16_t codepoint = g4ToCodepoint(*(const u16*)(data + i * 2));
+        if (codepoint == 0xFFFF)
+        {
+            return i;
+        }
+        out[i] = codepoint;
+    }
+    return len;
+}
+
 std::string StringUtils::format(std::string fmt_str, ...)
 {
     va_list ap;
@@ -48,69 +149,170 @@ std::string StringUtils::format(std::string fmt_str, ...)
     return std::string(formatted.get());
 }
 
-std::u16string StringUtils::UTF8toUTF16(const std::string& src)
+// ASCII is copied eight bytes (or four UTF-16 code units) at a time; anything else goes one code point at a time
+size_t StringUtils::UTF8toUTF16(const char* src, size_t srcSize, char16_t* dst, size_t dstSize)
 {
-    std::u16string ret;
-    ret.reserve(src.size());
-    for (size_t i = 0; i < src.size(); i++)
+    size_t in = 0, out = 0;
+    while (in < srcSize && out < dstSize)
     {
-        u16 codepoint = 0xFFFD;
-        int iMod      = 0;
-        if (src[i] & 0x80 && src[i] & 0x40 && src[i] & 0x20 && !(src[i] & 0x10) && i + 2 < src.size())
+        if (in + 8 <= srcSize && out + 8 <= dstSize)
+        {
+            u64 block;
+            memcpy(&block, src + in, 8);
+            if (!(block & 0x8080808080808080))
+            {
+                for (size_t i = 0; i < 8; i++)
+                {
+                    dst[out + i] = src[in + i];
+                }
+                in += 8;
+                out += 8;
+                continue;
+            }
+        }
+
+        u8 lead          = src[in];
+        u32 codepoint    = 0xFFFD;
+        size_t consumed  = 1;
+        size_t remaining = srcSize - in;
+        if (lead < 0x80)
         {
-            codepoint = src[i] & 0x0F;
-            codepoint = codepoint << 6 | (src[i + 1] & 0x3F);
-            codepoint = codepoint << 6 | (src[i + 2] & 0x3F);
-            iMod      = 2;
+            codepoint = lead;
         }
-        else if (src[i] & 0x80 && src[i] & 0x40 && !(src[i] & 0x20) && i + 1 < src.size())
+        else if ((lead & 0xE0) == 0xC0 && remaining >= 2 && (src[in + 1] & 0xC0) == 0x80)
         {
-            codepoint = src[i] & 0x1F;
-            codepoint = codepoint << 6 | (src[i + 1] & 0x3F);
-            iMod      = 1;
+            codepoint = (lead & 0x1F) << 6 | (src[in + 1] & 0x3F);
+            consumed  = 2;
         }
-        else if (!(src[i] & 0x80))
+        else if ((lead & 0xF0) == 0xE0 && remaining >= 3 && (src[in + 1] & 0xC0) == 0x80 && (src[in + 2] & 0xC0) == 0x80)
         {
-            codepoint = src[i];
+            codepoint = (lead & 0x0F) << 12 | (src[in + 1] & 0x3F) << 6 | (src[in + 2] & 0x3F);
+            consumed  = 3;
+        }
+        else if ((lead & 0xF8) == 0xF0 && remaining >= 4 && (src[in + 1] & 0xC0) == 0x80 && (src[in + 2] & 0xC0) == 0x80 &&
+                 (src[in + 3] & 0xC0) == 0x80)
+        {
+            codepoint = (lead & 0x07) << 18 | (src[in + 1] & 0x3F) << 12 | (src[in + 2] & 0x3F) << 6 | (src[in + 3] & 0x3F);
+            consumed  = 4;
+        }
+        if ((codepoint >= 0xD800 && codepoint <= 0xDFFF) || codepoint > 0x10FFFF)
+        {
+            codepoint = 0xFFFD;
         }
 
-        ret.push_back((char16_t)codepoint);
-        i += iMod;
+        if (codepoint >= 0x10000)
+        {
+            if (out + 2 > dstSize)
+            {
+                break;
+            }
+            codepoint -= 0x10000;
+            dst[out++] = 0xD800 | (codepoint >> 10);
+            dst[out++] = 0xDC00 | (codepoint & 0x3FF);
+        }
+        else
+        {
+            dst[out++] = codepoint;
+        }
+        in += consumed;
     }
-    return ret;
+    return out;
 }
 
-static std::string utf16DataToUtf8(const char16_t* data, size_t size, char16_t delim = 0)
+size_t StringUtils::UTF16toUTF8(const char16_t* src, size_t srcSize, char* dst, size_t dstSize, char16_t term)
 {
-    std::string ret;
-    ret.reserve(size);
-    char addChar[4] = {0};
-    for (size_t i = 0; i < size; i++)
+    // Lets four code units be compared with term at once
+    const u64 terms = (u64)term * 0x0001000100010001;
+    size_t in       = 0, out = 0;
+    while (in < srcSize && out < dstSize)
     {
-        if (data[i] == delim)
+        if (in + 4 <= srcSize && out + 4 <= dstSize)
         {
-            return ret;
+            u64 block;
+            memcpy(&block, src + in, 8);
+            u64 diff = block ^ terms;
+            // All four are ASCII and none of them is NUL or term
+            if (!(block & 0xFF80FF80FF80FF80) && !((block - 0x0001000100010001) & ~block & 0x8000800080008000) &&
+                !((diff - 0x0001000100010001) & ~diff & 0x8000800080008000))
+            {
+                for (size_t i = 0; i < 4; i++)
+                {
+                    dst[out + i] = src[in + i];
+                }
+                in += 4;
+                out += 4;
+                continue;
+            }
         }
-        else if (data[i] < 0x0080)
+
+        if (src[in] == term || src[in] == 0)
         {
-            addChar[0] = data[i];
-            addChar[1] = '\0';
+            break;
         }
-        else if (data[i] < 0x0800)
+        u32 codepoint   = src[in];
+        size_t consumed = 1;
+        if (codepoint >= 0xD800 && codepoint <= 0xDBFF && in + 1 < srcSize && src[in + 1] >= 0xDC00 && src[in + 1] <= 0xDFFF)
         {
-            addChar[0] = 0xC0 | ((data[i] >> 6) & 0x1F);
-            addChar[1] = 0x80 | (data[i] & 0x3F);
-            addChar[2] = '\0';
+            codepoint = 0x10000 + ((codepoint - 0xD800) << 10 | (src[in + 1] - 0xDC00));
+            consumed  = 2;
+        }
+        else if (codepoint >= 0xD800 && codepoint <= 0xDFFF)
+        {
+            codepoint = 0xFFFD;
+        }
+
+        if (codepoint < 0x80)
+        {
+            dst[out++] = codepoint;
+        }
+        else if (codepoint < 0x800)
+        {
+            if (out + 2 > dstSize)
+            {
+                break;
+            }
+            dst[out++] = 0xC0 | (codepoint >> 6);
+            dst[out++] = 0x80 | (codepoint & 0x3F);
+        }
+        else if (codepoint < 0x10000)
+        {
+            if (out + 3 > dstSize)
+            {
+                break;
+            }
+            dst[out++] = 0xE0 | (codepoint >> 12);
+            dst[out++] = 0x80 | ((codepoint >> 6) & 0x3F);
+            dst[out++] = 0x80 | (codepoint & 0x3F);
         }
         else
         {
-            addChar[0] = 0xE0 | ((data[i] >> 12) & 0x0F);
-            addChar[1] = 0x80 | ((data[i] >> 6) & 0x3F);
-            addChar[2] = 0x80 | (data[i] & 0x3F);
-            addChar[3] = '\0';
+            if (out + 4 > dstSize)
+            {
+                break;
+            }
+            dst[out++] = 0xF0 | (codepoint >> 18);
+            dst[out++] = 0x80 | ((codepoint >> 12) & 0x3F);
+            dst[out++] = 0x80 | ((codepoint >> 6) & 0x3F);
+            dst[out++] = 0x80 | (codepoint & 0x3F);
         }
-        ret.append(addChar);
+        in += consumed;
     }
+    return out;
+}
+
+std::u16string StringUtils::UTF8toUTF16(const std::string& src)
+{
+    // Never more UTF-16 code units than there are UTF-8 bytes
+    std::u16string ret(src.size(), u'\0');
+    ret.resize(UTF8toUTF16(src.data(), src.size(), &ret[0], ret.size()));
+    return ret;
+}
+
+static std::string utf16DataToUtf8(const char16_t* data, size_t size, char16_t delim = 0)
+{
+    // Never more than three UTF-8 bytes per UTF-16 code unit
+    std::string ret(size * 3, '\0');
+    ret.resize(StringUtils::UTF16toUTF8(data, size, &ret[0], ret.size(), delim));
     return ret;
 }
 
@@ -137,13 +339,15 @@ std::u16string StringUtils::getU16String(const u8* data, int ofs, int len, char1
 
 std::string StringUtils::getString(const u8* data, int ofs, int len, char16_t term)
 {
-    return utf16DataToUtf8((char16_t*)(data + ofs), len, term);
+    // Names are short enough for this to live on the stack and fit the returned string's small buffer
+    char buf[len * 3];
+    return std::string(buf, UTF16toUTF8((const char16_t*)(data + ofs), len, buf, len * 3, term));
 }
 
-void StringUtils::setString(u8* data, const std::u16string& v, int ofs, int len, char16_t terminator, char16_t padding)
+static void writeString(u8* data, const char16_t* v, int size, int ofs, int len, char16_t terminator, char16_t padding)
 {
     int i = 0;
-    for (; i < std::min(len - 1, (int)v.size()); i++) // len includes terminator
+    for (; i < std::min(len - 1, size); i++) // len includes terminator
     {
         *(u16*)(data + ofs + i * 2) = v[i];
     }
@@ -154,48 +358,33 @@ void StringUtils::setString(u8* data, const std::u16string& v, int ofs, int len,
     }
 }
 
+void StringUtils::setString(u8* data, const std::u16string& v, int ofs, int len, char16_t terminator, char16_t padding)
+{
+    writeString(data, v.data(), v.size(), ofs, len, terminator, padding);
+}
+
 void StringUtils::setString(u8* data, const std::string& v, int ofs, int len, char16_t terminator, char16_t padding)
 {
-    setString(data, UTF8toUTF16(v), ofs, len, terminator, padding);
+    char16_t buf[len];
+    writeString(data, buf, UTF8toUTF16(v.data(), v.size(), buf, len - 1), ofs, len, terminator, padding);
 }
 
 std::string StringUtils::getString4(const u8* data, int ofs, int len)
 {
-    std::string output;
-    len *= 2;
-    u16 temp;
-    u16 codepoint;
-    char addChar[4];
-    for (u8 i = 0; i < len; i += 2)
+    char16_t chars[len];
+    return utf16DataToUtf8(chars, decodeG4(data + ofs, len, chars));
+}
+
+std::vector<std::string> StringUtils::getStrings4(const u8* data, int ofs, int stride, int count, int len)
+{
+    std::vector<std::string> ret;
+    ret.reserve(count);
+    char16_t chars[len];
+    for (int i = 0; i < count; i++)
     {
-        temp = *(u16*)(data + ofs + i);
-        if (temp == 0xFFFF)
-            break;
-        u16 index = std::distance(G4Values, std::find(G4Values, G4Values + G4TEXT_LENGTH, temp));
-        codepoint = G4Chars[index];
-        if (codepoint == 0xFFFF)
-            break;
-        if (codepoint < 0x0080)
-        {
-            addChar[0] = codepoint;
-            addChar[1] = '\0';
-        }
-        else if (codepoint < 0x0800)
-        {
-            addChar[0] = 0xC0 | ((codepoint >> 6) & 0x1F);
-            addChar[1] = 0x80 | (codepoint & 0x3F);
-            addChar[2] = '\0';
-        }
-        else
-        {
-            addChar[0] = 0xE0 | ((codepoint >> 12) & 0x0F);
-            addChar[1] = 0x80 | ((codepoint >> 6) & 0x3F);
-            addChar[2] = 0x80 | (codepoint & 0x3F);
-            addChar[3] = '\0';
-        }
-        output.append(addChar);
+        ret.emplace_back(utf16DataToUtf8(chars, decodeG4(data + ofs + i * stride, len, chars)));
     }
-    return output;
+    return ret;
 }
 
 std::vector<u16> StringUtils::stringToG4(const std::string& v)
@@ -219,13 +408,11 @@ std::vector<u16> StringUtils::stringToG4(const std::string& v)
                 codepoint = codepoint << 6 | (v[charIndex + 1] & 0x3F);
                 charIndex += 1;
             }
-            size_t index = std::distance(G4Chars, std::find(G4Chars, G4Chars + G4TEXT_LENGTH, codepoint));
-            ret.push_back(index < G4TEXT_LENGTH ? G4Values[index] : 0x0000);
+            ret.push_back(codepointToG4(codepoint));
         }
         else
         {
-            size_t index = std::distance(G4Chars, std::find(G4Chars, G4Chars + G4TEXT_LENGTH, v[charIndex]));
-            ret.push_back(index < G4TEXT_LENGTH ? G4Values[index] : 0x0000);
+            ret.push_back(codepointToG4(v[charIndex]));
         }
     }
     if (ret.back() != 0xFFFF)
@@ -257,13 +444,11 @@ void StringUtils::setString4(u8* data, const std::string& v, int ofs, int len)
                 codepoint = codepoint << 6 | (v[charIndex + 1] & 0x3F);
                 charIndex += 1;
             }
-            size_t index     = std::distance(G4Chars, std::find(G4Chars, G4Chars + G4TEXT_LENGTH, codepoint));
-            output[outIndex] = (index < G4TEXT_LENGTH ? G4Values[index] : 0x0000);
+            output[outIndex] = codepointToG4(codepoint);
         }
         else
         {
-            size_t index     = std::distance(G4Chars, std::find(G4Chars, G4Chars + G4TEXT_LENGTH, v[charIndex]));
-            output[outIndex] = (index < G4TEXT_LENGTH ? G4Values[index] : 0x0000);
+            output[outIndex] = codepointToG4(v[charIndex]);
         }
     }
     output[outIndex >= len ? len - 1 : outIndex] = 0xFFFF;
@@ -304,6 +489,59 @@ std::string& StringUtils::toLower(std::string& in)
     return in;
 }
 
+static char16_t foldCodepoint(char16_t codepoint)
+{
+    if (codepoint >= u'\uFF01' && codepoint <= u'\uFF5E') // Fullwidth ASCII
+    {
+        codepoint -= 0xFEE0;
+    }
+    else if (codepoint == u'\u3000') // Ideographic space
+    {
+        return u' ';
+    }
+
+    if (codepoint < 0x80)
+    {
+        return codepoint >= u'A' && codepoint <= u'Z' ? codepoint + 0x20 : codepoint;
+    }
+    else if ((codepoint >= u'\u00C0' && codepoint <= u'\u00DE' && codepoint != u'\u00D7') ||
+             (codepoint >= u'\u0391' && codepoint <= u'\u03AB' && codepoint != u'\u03A2') || (codepoint >= u'\u0410' && codepoint <= u'\u042F'))
+    {
+        return codepoint + 0x20;
+    }
+    else if (codepoint >= u'\u0400' && codepoint <= u'\u040F')
+    {
+        return codepoint + 0x50;
+    }
+    else if ((codepoint >= u'\u0100' && codepoint <= u'\u0137') || (codepoint >= u'\u014A' && codepoint <= u'\u0177'))
+    {
+        return codepoint | 1;
+    }
+    else if ((codepoint >= u'\u0139' && codepoint <= u'\u0148') || (codepoint >= u'\u0179' && codepoint <= u'\u017E'))
+    {
+        return codepoint & 1 ? codepoint + 1 : codepoint;
+    }
+    else if (codepoint == u'\u0178')
+    {
+        return u'\u00FF';
+    }
+    else if (codepoint >= u'\u3041' && codepoint <= u'\u3096') // Hiragana to katakana
+    {
+        return codepoint + 0x60;
+    }
+    return codepoint;
+}
+
+std::u16string StringUtils::fold(const std::string& in)
+{
+    std::u16string ret = UTF8toUTF16(in);
+    for (auto& codepoint : ret)
+    {
+        codepoint = foldCodepoint(codepoint);
+    }
+    return ret;
+}
+
 static u32 swapCodepoints45(u32 codepoint)
 {
     switch (codepoint)
@@ -673,3 +911,56 @@ std::u16string StringUtils::transString67(const std::u16string& str)
     }
     return ret;
 }
+
+// Code point at position i of the name as its getter would decode it, or 0 once the name has ended
+static char16_t nameChar(const StringUtils::RawName& name, int i)
+{
+    if (i >= name.length)
+    {
+        return 0;
+    }
+    u16 raw = *(const u16*)(name.data + i * 2);
+    switch (name.encoding)
+    {
+        case StringUtils::RawName::GEN4:
+        {
+            char16_t codepoint = g4ToCodepoint(raw);
+            return codepoint == 0xFFFF ? 0 : swapCodepoints45(codepoint);
+        }
+        case StringUtils::RawName::GEN5:
+            return raw == name.terminator ? 0 : swapCodepoints45(raw);
+        case StringUtils::RawName::GEN67:
+            return raw == name.terminator ? 0 : swapCodepoints67(raw);
+        case StringUtils::RawName::UTF16:
+        default:
+            return raw == name.terminator ? 0 : raw;
+    }
+}
+
+bool StringUtils::nameEquals(const RawName& a, const RawName& b)
+{
+    for (int i = 0;; i++)
+    {
+        char16_t charA = nameChar(a, i);
+        if (charA != nameChar(b, i))
+        {
+            return false;
+        }
+        if (charA == 0)
+        {
+            return true;
+        }
+    }
+}
+
+u32 StringUtils::nameHash(const RawName& name)
+{
+    // FNV-1a
+    u32 hash = 0x811C9DC5;
+    for (int i = 0; char16_t codepoint = nameChar(name, i); i++)
+    {
+        hash = (hash ^ (codepoint & 0xFF)) * 0x01000193;
+        hash = (hash ^ (codepoint >> 8)) * 0x01000193;
+    }
+    return hash;
+}
@@ -0,0 +1,100 @@
+/*
+ *   This file is part of PKSM
+ *   Copyright (C) 2016-2019 Bernardo Giordano, Admiral Fish, piepie62
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+ *       * Requiring preservation of specified reasonable legal notices or
+ *         author attributions in that material or in the Appropriate Legal
+ *         Notices displayed by works containing it.
+ *       * Prohibiting misrepresentation of the origin of that material,
+ *         or requiring that modified versions of such material be marked in
+ *         reasonable ways as different from the original version.
+ */
+
+#ifndef IDTABLE_HPP
+#define IDTABLE_HPP
+
+#include "types.h"
+#include <algorithm>
+#include <string>
+#include <vector>
+
+// Names sorted by id, for tables too sparse to index directly (locations, countries, subregions). Ids and names are
+// kept in separate arrays so a lookup only binary searches a small array of integers
+template <typename T>
+class IdTable
+{
+public:
+    // Tables are almost always filled in ascending order, which just appends. A repeated id replaces the old name
+    void add(T id, const std::string& name)
+    {
+        if (ids.empty() || ids.back() < id)
+        {
+            ids.push_back(id);
+            names.push_back(name);
+            return;
+        }
+        size_t i = std::lower_bound(ids.begin(), ids.end(), id) - ids.begin();
+        if (ids[i] == id)
+        {
+            names[i] = name;
+        }
+        else
+        {
+            ids.insert(ids.begin() + i, id);
+            names.insert(names.begin() + i, name);
+        }
+    }
+    void reserve(size_t size)
+    {
+        ids.reserve(size);
+        names.reserve(size);
+    }
+
+    // Position of id in the table, or size() if it isn't there
+    size_t indexOf(T id) const
+    {
+        size_t i = std::lower_bound(ids.begin(), ids.end(), id) - ids.begin();
+        return i < ids.size() && ids[i] == id ? i : ids.size();
+    }
+    const std::string* find(T id) const
+    {
+        size_t i = indexOf(id);
+        return i < names.size() ? &names[i] : nullptr;
+    }
+    bool contains(T id) const { return indexOf(id) < ids.size(); }
+
+    size_t size(void) const { return ids.size(); }
+    bool empty(void) const { return ids.empty(); }
+    T id(size_t i) const { return ids[i]; }
+    const std::string& name(size_t i) const { return names[i]; }
+    // Heap memory held by the table, roughly
+    size_t memoryUsage(void) const
+    {
+        size_t ret = ids.capacity() * sizeof(T) + names.capacity() * sizeof(std::string);
+        for (const auto& name : names)
+        {
+            ret += name.capacity();
+        }
+        return ret;
+    }
+
+private:
+    std::vector<T> ids;
+    std::vector<std::string> names;
+};
+
+#endif
@@ -27,11 +27,16 @@
 #ifndef LANGUAGESTRINGS_HPP
 #define LANGUAGESTRINGS_HPP
 
+#include "IdTable.hpp"
+#include "SearchIndex.hpp"
+#include "StringId.hpp"
 #include "generation.hpp"
 #include "io.hpp"
 #include "json.hpp"
 #include "types.h"
 #include <algorithm>
+#include <array>
+#include <memory>
 #include <stdio.h>
 #include <string>
 #include <unordered_map>
@@ -67,18 +72,39 @@ protected:
     std::vector<std::string> natures;
     std::vector<std::string> speciess;
     std::vector<std::string> games;
-    std::map<u16, std::string> locations4;
-    std::map<u16, std::string> locations5;
-    std::map<u16, std::string> locations6;
-    std::map<u16, std::string> locations7;
-    std::map<u16, std::string> locationsLGPE;
-    std::map<u8, std::string> countries;
-    std::map<u8, std::map<u8, std::string>> subregions;
-    nlohmann::json gui;
+    IdTable<u16> locations4;
+    IdTable<u16> locations5;
+    IdTable<u16> locations6;
+    IdTable<u16> locations7;
+    IdTable<u16> locationsLGPE;
+    IdTable<u8> countries;
+    // Indexed by country, filled in one country at a time when first asked for; there are far too many files to read them all up front
+    mutable std::array<std::unique_ptr<IdTable<u8>>, 256> subregions;
+    // Indexed by StringId
+    std::vector<std::string> gui;
+    // gui.json keys without a StringId, and the placeholders handed out for unknown keys; only scripts ask for these
+    mutable std::map<std::string, std::string> extraGui;
+    Language lang;
+    // Built the first time each is searched
+    mutable std::array<std::unique_ptr<SearchIndex>, (size_t)SearchCategory::LOCATIONSLGPE + 1> searchIndices;
+
+    // Location of a table inside strings.bin
+    struct PackedTable
+    {
+        u32 count;
+        u32 offset;
+        u32 size;
+    };
+    std::string packedPath;
+    std::map<u8, PackedTable> packedSubregions;
+
+    const IdTable<u8>* countrySubregions(u8 country) const;
+    bool loadPacked(void);
+    void loadGui(void);
 
     static void load(Language lang, const std::string& name, std::vector<std::string>& array);
     template <typename T>
-    static void load(Language lang, const std::string& name, std::map<T, std::string>& map)
+    static void load(Language lang, const std::string& name, IdTable<T>& table)
     {
         static constexpr const char* base = "romfs:/i18n/";
         std::string path                  = io::exists(base + folder(lang) + name) ? base + folder(lang) + name : base + folder(Language::EN) + name;
@@ -102,8 +128,8 @@ protected:
                     tmp = std::string(data);
                     tmp = tmp.substr(0, tmp.find('\n'));
                     // 0 automatically deduces the base: 0x prefix makes it hexadecimal, 0 prefix makes it octal
-                    T val    = std::stoi(tmp.substr(0, tmp.find('|')), 0, 0);
-                    map[val] = tmp.substr(0, tmp.find('\r')).substr(tmp.find('|') + 1);
+                    T val = std::stoi(tmp.substr(0, tmp.find('|')), 0, 0);
+                    table.add(val, tmp.substr(0, tmp.find('\r')).substr(tmp.find('|') + 1));
                 }
                 else
                 {
@@ -122,10 +148,13 @@ public:
 
     const std::vector<std::string>& rawItems() const;
     const std::vector<std::string>& rawMoves() const;
-    const std::map<u16, std::string>& locations(Generation g) const;
-    const std::map<u8, std::string>& rawCountries() const;
-    const std::map<u8, std::string>& rawSubregions(u8 country) const;
+    const IdTable<u16>& locations(Generation g) const;
+    const IdTable<u8>& rawCountries() const;
+    const IdTable<u8>& rawSubregions(u8 country) const;
     size_t numGameStrings() const;
+    // Heap memory held by the loaded tables, roughly; search indices and script-only strings aren't counted
+    size_t memoryUsage() const;
+    const SearchIndex& searchIndex(SearchCategory category) const;
 
     const std::string& ability(u8 v) const;
     const std::string& ball(u8 v) const;
@@ -140,6 +169,7 @@ public:
     const std::string& subregion(u8 country, u8 v) const;
     const std::string& country(u8 v) const;
 
+    const std::string& localize(StringId v) const;
     const std::string& localize(const std::string& v) const;
 };
 
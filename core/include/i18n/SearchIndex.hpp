@@ -0,0 +1,75 @@
+/*
+ *   This file is part of PKSM
+ *   Copyright (C) 2016-2019 Bernardo Giordano, Admiral Fish, piepie62
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+ *       * Requiring preservation of specified reasonable legal notices or
+ *         author attributions in that material or in the Appropriate Legal
+ *         Notices displayed by works containing it.
+ *       * Prohibiting misrepresentation of the origin of that material,
+ *         or requiring that modified versions of such material be marked in
+ *         reasonable ways as different from the original version.
+ */
+
+#ifndef SEARCHINDEX_HPP
+#define SEARCHINDEX_HPP
+
+#include "types.h"
+#include <string>
+#include <utility>
+#include <vector>
+
+enum class SearchCategory : u8
+{
+    SPECIES,
+    MOVES,
+    ITEMS,
+    LOCATIONS4,
+    LOCATIONS5,
+    LOCATIONS6,
+    LOCATIONS7,
+    LOCATIONSLGPE
+};
+
+// Suffix array over the case folded names of one category, so searches don't have to fold and scan every name per keystroke
+class SearchIndex
+{
+public:
+    // Call build once every name has been added
+    void add(u16 value, const std::string& name);
+    void build(void);
+
+    // Values of the entries whose name starts with query, in ascending order. Every value if query is empty
+    std::vector<u16> prefix(const std::string& query) const;
+    // Values of the entries whose name contains query, in ascending order. Every value if query is empty
+    std::vector<u16> substring(const std::string& query) const;
+    size_t size(void) const { return values.size(); }
+
+private:
+    std::pair<size_t, size_t> range(const std::vector<u32>& sorted, const std::u16string& key) const;
+    std::vector<u16> collect(const std::vector<u32>& sorted, const std::pair<size_t, size_t>& bounds) const;
+
+    // Every folded name, each NUL terminated
+    std::u16string text;
+    // Entry each character of text belongs to
+    std::vector<u16> owners;
+    std::vector<u16> values;
+    // Offsets in text of the start of every name and of every suffix of every name, each sorted by the text they point to
+    std::vector<u32> names;
+    std::vector<u32> suffixes;
+};
+
+#endif
@@ -0,0 +1,680 @@
+/*
+ *   This file is part of PKSM
+ *   Copyright (C) 2016-2019 Bernardo Giordano, Admiral Fish, piepie62
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+ *       * Requiring preservation of specified reasonable legal notices or
+ *         author attributions in that material or in the Appropriate Legal
+ *         Notices displayed by works containing it.
+ *       * Prohibiting misrepresentation of the origin of that material,
+ *         or requiring that modified versions of such material be marked in
+ *         reasonable ways as different from the original version.
+ */
+
+// Generated by common/gen_string_ids.py from assets/romfs/i18n/en/gui.json. Do not edit by hand
+
+#ifndef STRINGID_HPP
+#define STRINGID_HPP
+
+#include "types.h"
+#include <stddef.h>
+
+enum class StringId : u16
+{
+    _3DS_REGION,
+    _3DS_REGION_ID,
+    ABILITY,
+    ABILITY_NUMBER,
+    ABILITY_RIBBON,
+    ADAPT_LANGUAGE,
+    ALERT_RIBBON,
+    ALOLA_CHAMPION_RIBBON,
+    ALPHA_UPDATES,
+    AN_OPENING_OF_LIGHTING_QUICK_ATTACKS,
+    ARTIST_RIBBON,
+    ASCENDING,
+    ATTACK,
+    ATTACK_EV,
+    ATTACK_IV,
+    ATTACK_LEVEL_1,
+    ATTACK_LEVEL_2,
+    ATTACK_LEVEL_3,
+    AUS,
+    AUTO_LEGALIZE_ERROR,
+    AWAKENED,
+    AWAKENED_ATTACK,
+    AWAKENED_DEFENSE,
+    AWAKENED_HP,
+    AWAKENED_SPATK,
+    AWAKENED_SPDEF,
+    AWAKENED_SPEED,
+    A_ADD_SAVE,
+    A_BARRAGE_OF_BITBOTS,
+    A_BOX_NAME,
+    A_CHOOSE_GROUP,
+    A_ITEM_EDIT,
+    A_PICKUP,
+    A_SELECT,
+    BACKUP_FAIL_SAVE_1,
+    BACKUP_FAIL_SAVE_2,
+    BADGES,
+    BAD_CIA_FILE,
+    BAD_INJECT,
+    BAD_OPEN_BACKUP,
+    BAD_OPEN_SAVE,
+    BAG,
+    BALL,
+    BALLS,
+    BANK_BACKUP,
+    BANK_BAD_CONVERT,
+    BANK_BOX_NAME,
+    BANK_CONFIRM_CLEAR,
+    BANK_CONFIRM_DUMP,
+    BANK_CONFIRM_RELEASE,
+    BANK_CONVERT,
+    BANK_CORRUPT,
+    BANK_CREATE,
+    BANK_DELETE,
+    BANK_FAILED_EXIT,
+    BANK_LOAD,
+    BANK_NAME,
+    BANK_NAME_ERROR,
+    BANK_SAVE,
+    BANK_SAVE_CHANGES,
+    BANK_SAVE_ERROR,
+    BANK_SWITCH,
+    BATTLE_CHAMPION_RIBBON,
+    BATTLE_ITEMS,
+    BATTLE_MEMORY_RIBBON_COUNT,
+    BATTLE_ROYAL_RIBBON,
+    BATTLE_TREE_GREAT_RIBBON,
+    BATTLE_TREE_MASTER_RIBBON,
+    BEAUTY_CONTEST_VALUE,
+    BEAUTY_MASTER_RIBBON,
+    BEAUTY_RIBBON,
+    BEAUTY_RIBBON_GREAT,
+    BEAUTY_RIBBON_HYPER,
+    BEAUTY_RIBBON_MASTER,
+    BEAUTY_RIBBON_SUPER,
+    BEAUTY_RIBBON_ULTRA,
+    BERRIES,
+    BEST_FRIENDS_RIBBON,
+    BIRTHDAY_RIBBON,
+    BLUE_RIBBON,
+    BOX,
+    BOX_JUMP,
+    BOX_NAME,
+    BOX_SWAP,
+    BP,
+    BRIDGE_SHOULD_SEND_1,
+    BRIDGE_SHOULD_SEND_2,
+    BURNED,
+    B_BACK,
+    CANDIES,
+    CAPSULE_INDEX_SEALS,
+    CARELESS_RIBBON,
+    CARNIVAL_RIBBON,
+    CATCHING_ITEMS,
+    CHAMPION_RIBBON,
+    CHANGE_FORM,
+    CHANGE_SPECIES,
+    CHECKSUM,
+    CHN,
+    CIA_INSTALL_FINISH_FAIL,
+    CIA_INSTALL_START_FAIL,
+    CIA_UPDATE_READ_FAIL,
+    CIA_UPDATE_WRITE_FAIL,
+    CIRCLE,
+    CLASSIC_RIBBON,
+    CLEAR,
+    CLEVERNESS_MASTER_RIBBON,
+    CLONE,
+    CLOUD_BOX,
+    CLOUD_SORT_FILTER,
+    CONFIGURATION_FILE_CORRUPTED_1,
+    CONFIGURATION_INCORRECT_FORMAT,
+    CONFIGURATION_USING_DEFAULT,
+    CONFIG_AUTO_UPDATE,
+    CONFIG_BACKUP_INJECTION,
+    CONFIG_BACKUP_SAVE,
+    CONFIG_EDIT_TRANSFERS,
+    CONFIG_RANDOM_MUSIC,
+    CONFIG_SAVE_INFO,
+    CONFIG_SHOW_BACKUPS,
+    CONFIG_USE_EXTDATA,
+    CONTEST_MEMORY_RIBBON_COUNT,
+    CONTEST_STAR_RIBBON,
+    CONTEST_VALUE_BEAUTY,
+    CONTEST_VALUE_COOL,
+    CONTEST_VALUE_CUTE,
+    CONTEST_VALUE_SHEEN,
+    CONTEST_VALUE_SMART,
+    CONTEST_VALUE_TOUGH,
+    CONTINUE,
+    CONTINUE_CANCEL,
+    COOLNESS_MASTER_RIBBON,
+    COOL_CONTEST_VALUE,
+    COOL_RIBBON,
+    COOL_RIBBON_GREAT,
+    COOL_RIBBON_HYPER,
+    COOL_RIBBON_MASTER,
+    COOL_RIBBON_SUPER,
+    COOL_RIBBON_ULTRA,
+    COUNTRY,
+    COUNTRY_ID,
+    COUNTRY_RIBBON,
+    CRITICAL_BANK_ERROR_1,
+    CRITICAL_BANK_ERROR_2,
+    CTOT_FSHIP,
+    CURL_ERROR,
+    CURRENT_HANDLER,
+    CURRENT_HP,
+    CURRENT_TRAINER_AFFECTION,
+    CURRENT_TRAINER_FRIENDSHIP,
+    CURRENT_TRAINER_GENDER,
+    CURRENT_TRAINER_MEMORY_FEELING,
+    CURRENT_TRAINER_MEMORY_INTENSITY,
+    CURRENT_TRAINER_MEMORY_LINE,
+    CURRENT_TRAINER_MEMORY_TEXTVAR,
+    CURRENT_TRAINER_NAME,
+    CUTENESS_MASTER_RIBBON,
+    CUTE_CONTEST_VALUE,
+    CUTE_RIBBON,
+    CUTE_RIBBON_GREAT,
+    CUTE_RIBBON_HYPER,
+    CUTE_RIBBON_MASTER,
+    CUTE_RIBBON_SUPER,
+    CUTE_RIBBON_ULTRA,
+    DANGER_ZIPPED_UP_TIGHT,
+    DATA_RECEIVE_FAIL,
+    DATA_SEND_FAIL,
+    DATE,
+    DAY,
+    DAZZLING_DIZZYING_DANCE_SPOONS,
+    DEFAULTS,
+    DEFENSE,
+    DEFENSE_EV,
+    DEFENSE_IV,
+    DEFENSE_LEVEL_1,
+    DEFENSE_LEVEL_2,
+    DEFENSE_LEVEL_3,
+    DELETE_EXTRASAVE_ENTRY,
+    DESCENDING,
+    DEX_CAUGHT,
+    DEX_SEEN,
+    DIAMOND,
+    DIRT_LOCATION,
+    DIRT_TYPE,
+    DISTRIBUTION_SUPER_TRAINING_FLAGS,
+    DOUBLE_ABILITY_RIBBON,
+    DOWNCAST_RIBBON,
+    DOWNLOADING_FILE,
+    DOWN_SCROLL_DOWN,
+    DO_NOT_DOWNGRADE,
+    DRAG_DOWN_HYDREIGON,
+    DUMP,
+    EARTH_RIBBON,
+    EDIT,
+    EDITOR,
+    EDITOR_CHECK_EXIT,
+    EDITOR_CP,
+    EDITOR_HIDDEN_POWER,
+    EDITOR_IDS,
+    EDITOR_INST,
+    EDITOR_MISC,
+    EDITOR_MOVES,
+    EDITOR_NOT_APPLICABLE_GEN,
+    EDITOR_SAVE,
+    EDITOR_STATS,
+    EFFORT_RIBBON,
+    EGG,
+    EGG_DATE,
+    EGG_DAY,
+    EGG_LOCATION,
+    EGG_LOCATION_DIAMOND_PEARL,
+    EGG_LOCATION_PLATINUM,
+    EGG_MONTH,
+    EGG_RECEIVED_DATE,
+    EGG_YEAR,
+    EMPTY,
+    ENCOUNTER_TYPE,
+    ENCRYPTION_KEY,
+    ENJOYMENT,
+    ERROR_CODE,
+    ESV_TSV,
+    EUR,
+    EV,
+    EVENTS,
+    EVENT_DATABASE,
+    EVENT_RIBBON,
+    EXPERIENCE,
+    EXPERT_BATTLER_RIBBON,
+    EXTRASAVES_CONFIGURE_INSTRUCTIONS,
+    EXTRA_SAVES,
+    FAILED_OPEN_DUMP,
+    FAIL_SAVE_COMMIT,
+    FATEFUL_ENCOUNTER,
+    FEARSOME_TWIN_TALES_OF_JUTTING_JAWS,
+    FEMALE_OT,
+    FESTIVAL_RIBBON,
+    FILE_CONFIRM_CHOICE,
+    FILTER,
+    FILTER_OPTIONS,
+    FOLDER_DOESNT_EXIST,
+    FOLLOW_THOSE_FLEEING_GOALS,
+    FOOTPRINT_RIBBON,
+    FORM,
+    FRIENDSHIP,
+    FROZEN,
+    FULLNESS,
+    GAME,
+    GENDER,
+    GENDER_FORMS,
+    GENDER_FATEFUL_ENCOUNTER_FORM,
+    GENERATION,
+    GEN_4_ENCOUNTER_TYPE,
+    GEN_CHANGE_1,
+    GEN_CHANGE_2,
+    GEOLOCATION_1,
+    GEOLOCATION_2,
+    GEOLOCATION_3,
+    GEOLOCATION_4,
+    GEOLOCATION_5,
+    GORGEOUS_RIBBON,
+    GORGEOUS_ROYAL_RIBBON,
+    GPSS_BROWSE,
+    GPSS_DOWNLOAD,
+    GREAT_ABILITY_RIBBON,
+    GREEN_RIBBON,
+    GROUP_CHOICE_INSTR,
+    HEART,
+    HELD_ITEM,
+    HEX_EDIT,
+    HEX_SELECTED_BYTE,
+    HGSS_POKEBALL,
+    HIDDEN_ABILITY,
+    HIDDEN_POWER,
+    HISTORY_RIBBON,
+    HOENN_CHAMPION_RIBBON,
+    HOENN_RIBBONS,
+    HP,
+    HP_EV,
+    HP_IV,
+    HP_LEVEL_1,
+    HP_LEVEL_2,
+    HP_LEVEL_3,
+    HTTP_OFFLINE,
+    HTTP_UNKNOWN_ERROR,
+    HT_AFFECTION,
+    HT_EGG,
+    HYPER_ATTACK,
+    HYPER_DEFENSE,
+    HYPER_HP,
+    HYPER_SPATK,
+    HYPER_SPDEF,
+    HYPER_SPEED,
+    HYPER_TRAIN_FLAGS,
+    INCIDENT_LOGGED,
+    INJECT_TO_SLOT,
+    INVALID_ABILITY,
+    INVALID_BALL,
+    INVALID_FORM,
+    INVALID_GAME,
+    INVALID_HP,
+    INVALID_ITEM,
+    INVALID_LOCATION,
+    INVALID_MOVE,
+    INVALID_NATURE,
+    INVALID_SPECIES,
+    ITEM,
+    ITEMS,
+    IV,
+    IVS,
+    IVS_EGG_AND_NICKNAMED_FLAGS,
+    JPN,
+    KALOS_CHAMP_RIBBON,
+    KEY_ITEMS,
+    KOR,
+    LANGUAGE,
+    LANGUAGES,
+    LATEST,
+    LEGALITY_ANY,
+    LEGALITY_ILLEGAL,
+    LEGALITY_LEGAL,
+    LEGEND_RIBBON,
+    LEVEL,
+    LGPE_HAS_TM,
+    LGPE_NO_PARTY_SLOT,
+    LGPE_TOO_MANY_PKM,
+    LOADER_BACKING_UP,
+    LOADER_CARTRIDGE,
+    LOADER_CRITICAL_ERROR,
+    LOADER_GAME_CARD,
+    LOADER_GAME_SAVE,
+    LOADER_ID,
+    LOADER_INSTALLED_GAMES,
+    LOADER_INSTRUCTIONS_BOTTOM,
+    LOADER_INSTRUCTIONS_TOP_ABSENT,
+    LOADER_INSTRUCTIONS_TOP_PRESENT,
+    LOADER_LOAD,
+    LOADER_MEDIA_TYPE,
+    LOADER_SD,
+    LOADER_WIRELESS,
+    LV,
+    LVL,
+    L_BOX_PREV,
+    L_PAGE_PREV,
+    L_POUCH,
+    MAIL,
+    MAIL_MESSAGE_OT_NAME,
+    MARKINGS,
+    MAX_HP,
+    MEDICINE,
+    MET_DATE,
+    MET_DAY,
+    MET_LEVEL,
+    MET_LEVEL_ORIGINAL_TRAINER_GENDER,
+    MET_LOCATION,
+    MET_LOCATION_DIAMOND_PEARL,
+    MET_LOCATION_PLATINUM,
+    MET_MONTH,
+    MET_YEAR,
+    MISC,
+    MISC_FLAGS,
+    MONTH,
+    MOVES,
+    MOVE_1,
+    MOVE_1_CURRENT_PP,
+    MOVE_1_ID,
+    MOVE_1_PP,
+    MOVE_1_PP_UPS,
+    MOVE_2,
+    MOVE_2_CURRENT_PP,
+    MOVE_2_ID,
+    MOVE_2_PP,
+    MOVE_2_PP_UPS,
+    MOVE_3,
+    MOVE_3_CURRENT_PP,
+    MOVE_3_ID,
+    MOVE_3_PP,
+    MOVE_3_PP_UPS,
+    MOVE_4,
+    MOVE_4_CURRENT_PP,
+    MOVE_4_ID,
+    MOVE_4_PP,
+    MOVE_4_PP_UPS,
+    MULTI_ABILITY_RIBBON,
+    NA,
+    NATIONAL_CHAMPION_RIBBON,
+    NATIONAL_RIBBON,
+    NATURE,
+    NEED_ONE_POKEMON,
+    NEUTRAL,
+    NEW_BANK,
+    NICKNAME,
+    NICKNAMED,
+    NO,
+    NONE,
+    NOT_A_BUG,
+    NOT_PATRON,
+    NO_DUPES,
+    NO_PARTY_EMPTY,
+    NO_SWAP_BULK,
+    NO_WONDERCARDS,
+    NS_POKEMON,
+    NULL_TERMINATOR,
+    OFFLINE_ERROR,
+    ORIGINAL_LANGUAGE,
+    ORIGINAL_TRAINER_AFFECTION,
+    ORIGINAL_TRAINER_FRIENDSHIP,
+    ORIGINAL_TRAINER_GAME_ID,
+    ORIGINAL_TRAINER_ID,
+    ORIGINAL_TRAINER_LANGUAGE_ID,
+    ORIGINAL_TRAINER_MEMORY_FEELING,
+    ORIGINAL_TRAINER_MEMORY_INTENSITY,
+    ORIGINAL_TRAINER_MEMORY_LINE,
+    ORIGINAL_TRAINER_MEMORY_TEXTVAR,
+    ORIGINAL_TRAINER_NAME,
+    ORIGINAL_TRAINER_SID,
+    ORIGIN_GAME,
+    OT,
+    OT_AFFECTION,
+    OT_ID,
+    OT_MET,
+    OT_NAME,
+    OT_SID,
+    OVERWRITE_WC,
+    PAIR_ABILITY_RIBBON,
+    PARALYZED,
+    PATRON_CODE,
+    PID,
+    PLEASE_WAIT,
+    POISONED,
+    POKEBALL,
+    POKERUS,
+    POPULAR,
+    PREMIER_RIBBON,
+    PRESS_TO_CLONE,
+    QR_SCANNER,
+    RECORD_RIBBON,
+    RED_RIBBON,
+    REGION,
+    REGIONAL_CHAMPION_RIBBON,
+    REGION_ID,
+    RELAX_RIBBON,
+    RELEARN_MOVES,
+    RELEARN_MOVE_1_ID,
+    RELEARN_MOVE_2_ID,
+    RELEARN_MOVE_3_ID,
+    RELEARN_MOVE_4_ID,
+    RELEASE,
+    REPORT_THIS,
+    REPORT_THIS_TO_FLAGBREW,
+    RIBBONS,
+    ROTOM_POWERS,
+    ROYAL_RIBBON,
+    R_BOX_NEXT,
+    R_ITEM,
+    R_PAGE_NEXT,
+    SANITY_PLACEHOLDER,
+    SAVE_CHANGES_1,
+    SAVE_CHANGES_2,
+    SAVE_INFO,
+    SAVE_INVALID,
+    SAVE_OVERWRITE_1,
+    SAVE_OVERWRITE_CARD,
+    SAVE_OVERWRITE_INSTALL,
+    SAVE_PROGRESS,
+    SAVING,
+    SCANNER_EXIT,
+    SCAN_SAVES,
+    SCATTERBUG_LUGS_BACK,
+    SCRIPTS,
+    SCRIPTS_CONFIRM_USE,
+    SCRIPTS_EXECUTION_ERROR,
+    SCRIPTS_FAILED_OPEN,
+    SCRIPTS_INST1,
+    SCRIPTS_INST2,
+    SCRIPTS_INVALID,
+    SCRIPTS_NOT_FOUND,
+    SEAL_COORDINATES,
+    SEARCH,
+    SECRET_SUPER_TRAINING,
+    SECRET_SUPER_TRAINING_FLAG,
+    SETTINGS,
+    SET_SAVE_INFO,
+    SHARE_CODE_ENTER_PROMPT,
+    SHARE_DOWNLOAD_CODE,
+    SHARE_ERROR_INCORRECT_VERSION,
+    SHARE_FAILED_CHECK,
+    SHARE_INVALID_CODE,
+    SHARE_SEND_CONFIRM,
+    SHEEN_CONTEST_VALUE,
+    SHINY,
+    SHINY_CROWN,
+    SHINY_LEAF,
+    SHINY_LEAVES_HGSS,
+    SHOCK_RIBBON,
+    SID,
+    SINNOH_CHAMP_RIBBON,
+    SKILLFUL_BATTLER_RIBBON,
+    SMART_CONTEST_VALUE,
+    SMART_RIBBON,
+    SMART_RIBBON_GREAT,
+    SMART_RIBBON_HYPER,
+    SMART_RIBBON_MASTER,
+    SMART_RIBBON_SUPER,
+    SMART_RIBBON_ULTRA,
+    SMILE_RIBBON,
+    SNOOZE_RIBBON,
+    SOCKET_ACCEPT_FAIL,
+    SOCKET_BIND_FAIL,
+    SOCKET_CONNECTION_FAIL,
+    SOCKET_CREATE_FAIL,
+    SOCKET_LISTEN_FAIL,
+    SORT,
+    SOUVENIR_RIBBON,
+    SPATK,
+    SPATK_SHORT,
+    SPATK_EV,
+    SPATK_IV,
+    SPATK_LEVEL_1,
+    SPATK_LEVEL_2,
+    SPATK_LEVEL_3,
+    SPDEF,
+    SPDEF_SHORT,
+    SPDEF_EV,
+    SPDEF_IV,
+    SPDEF_LEVEL_1,
+    SPDEF_LEVEL_2,
+    SPDEF_LEVEL_3,
+    SPECIAL_RIBBON,
+    SPECIES,
+    SPECIES_NAME,
+    SPEED,
+    SPEED_EV,
+    SPEED_IV,
+    SPEED_LEVEL_1,
+    SPEED_LEVEL_2,
+    SPEED_LEVEL_3,
+    SQUARE,
+    STAMPS,
+    STAR,
+    START_DELETE,
+    START_EXIT,
+    START_EXTRA_FUNC,
+    START_SORT_FILTER,
+    START_TO_INJECT,
+    STATUS_CONDITIONS,
+    STORAGE,
+    STORAGE_BAD_ABILITY,
+    STORAGE_BAD_BALL,
+    STORAGE_BAD_FORM,
+    STORAGE_BAD_ITEM,
+    STORAGE_BAD_MOVE,
+    STORAGE_BAD_SPECIES,
+    STORAGE_BAD_TRANFER,
+    STORAGE_CHECKBACK,
+    STORAGE_IMPLEMENTATION,
+    STORAGE_RESIZE,
+    STUCK_BETWEEN_STRONG_AND_STRONG,
+    SUBREGION,
+    SUPER_TRAINING_FLAGS,
+    THE_BATTLE_FOR_THE_BEST_VERSION_X_Y,
+    THE_FIRE_STONE_CUP_BEGINS,
+    THE_FUCK,
+    THE_LEAF_STONE_CUP_BEGINS,
+    THE_TROUBLES_KEEP_ON_COMING,
+    THE_WATER_STONE_CUP_BEGINS,
+    THOSE_LONG_SHOTS_ARE_NO_LONG_SHOT,
+    TID,
+    TID_SID,
+    TMHM,
+    TMS,
+    TOTAL,
+    TOUGHNESS_MASTER_RIBBON,
+    TOUGH_CONTEST_VALUE,
+    TOUGH_RIBBON,
+    TOUGH_RIBBON_GREAT,
+    TOUGH_RIBBON_HYPER,
+    TOUGH_RIBBON_MASTER,
+    TOUGH_RIBBON_SUPER,
+    TOUGH_RIBBON_ULTRA,
+    TOXIC,
+    TRAINER_NAME,
+    TRAINING_BAG_HITS_LEFT,
+    TRAINING_RIBBON,
+    TRIANGLE,
+    TWN,
+    TYPE,
+    TYPE1,
+    TYPE2,
+    UNKNOWN,
+    UNKNOWN_FLAGS,
+    UNUSED,
+    UPDATE_CHECKING,
+    UPDATE_CHECK_ERROR_BAD_JSON_1,
+    UPDATE_CHECK_ERROR_BAD_JSON_2,
+    UPDATE_FOUND,
+    UPDATE_FOUND_BUT_FAILED_DOWNLOAD,
+    UPDATE_INSTALLING,
+    UPDATE_SUCCESS_1,
+    UPDATE_SUCCESS_2,
+    UP_SCROLL_UP,
+    USA,
+    VICTORY_RIBBON,
+    VIEW,
+    WATCH_MULTIPLE_MEGA,
+    WATCH_OUT_THATS_ONE_TRICKY_SECOND_HALF,
+    WC_CHANGE_SLOT,
+    WC_DUMP1,
+    WC_DUMP2,
+    WC_INST1,
+    WC_LGPE,
+    WC_NUM,
+    WC_SWITCH,
+    WHAT_UPSTART_MAGIKARP_MOVING_UP,
+    WINNING_RIBBON,
+    WIRELESS_IP,
+    WIRELESS_WARNING,
+    WISHING_RIBBON,
+    WORLD_ABILITY_RIBBON,
+    WORLD_CHAMPION_RIBBON,
+    WORLD_RIBBON,
+    WRONG_SIZE,
+    X_CLONE,
+    X_DELETE_SAVE,
+    X_RENAME,
+    X_SETTINGS,
+    X_SHARE,
+    YEAR,
+    YES,
+    YOUR_OT_NAME,
+    Y_ABSENT,
+    Y_CURSOR_MODE,
+    Y_LEGALIZE,
+    Y_PRESENT,
+    Y_RESIZE,
+    Y_SEARCH,
+    ZCRYSTALS,
+};
+
+constexpr size_t STRING_ID_COUNT = 636;
+
+// gui.json key of every StringId, in the same (strcmp) order
+extern const char* const stringIdKeys[STRING_ID_COUNT];
+
+#endif
@@ -34,13 +34,21 @@ namespace i18n
 {
     void init(void);
     void exit(void);
+    // Languages are loaded on first use; load() just does it ahead of time
+    void load(u8 lang);
+    // Frees every language but the UI one and keep (normally the loaded save's). Those two are also the only ones kept when
+    // memory runs short; references previously returned for any other language can become invalid at any allocation
+    void trim(u8 keep = Language::UNUSED);
 
     const std::vector<std::string>& rawItems(u8 lang);
     const std::vector<std::string>& rawMoves(u8 lang);
-    const std::map<u16, std::string>& locations(u8 lang, Generation g);
-    const std::map<u8, std::string>& rawCountries(u8 lang);
-    const std::map<u8, std::string>& rawSubregions(u8 lang, u8 country);
+    const IdTable<u16>& locations(u8 lang, Generation g);
+    const IdTable<u8>& rawCountries(u8 lang);
+    const IdTable<u8>& rawSubregions(u8 lang, u8 country);
     size_t numGameStrings(u8 lang);
+    // Case folded name indices shared by the search overlays and scripts
+    const SearchIndex& searchIndex(u8 lang, SearchCategory category);
+    const SearchIndex& locationIndex(u8 lang, Generation g);
 
     const std::string& ability(u8 lang, u8 value);
     const std::string& ball(u8 lang, u8 value);
@@ -57,6 +65,9 @@ namespace i18n
     const std::string& country(u8 lang, u8 value);
 
     // Used for general GUI stuff; not for PKM values
+    const std::string& localize(Language lang, StringId index);
+    const std::string& localize(StringId index);
+    // Looks the key up at runtime; for keys that aren't known at compile time, like those from scripts
     const std::string& localize(Language lang, const std::string& index);
     const std::string& localize(const std::string& index);
     const std::string& langString(Language l);
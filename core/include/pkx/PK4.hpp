@@ -138,6 +138,7 @@ public:
 
     std::string otName(void) const override;
     void otName(const std::string& v) override;
+    StringUtils::RawName rawOtName(void) const override;
     u8 eggYear(void) const override;
     void eggYear(u8 v) override;
     u8 eggMonth(void) const override;
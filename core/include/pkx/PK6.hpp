@@ -140,6 +140,7 @@ public:
 
     std::string htName(void) const;
     void htName(const std::string& v);
+    StringUtils::RawName rawHtName(void) const;
     u8 htGender(void) const;
     void htGender(u8 v);
     u8 currentHandler(void) const override;
@@ -167,6 +168,7 @@ public:
 
     std::string otName(void) const override;
     void otName(const std::string& v) override;
+    StringUtils::RawName rawOtName(void) const override;
     u8 otFriendship(void) const override;
     void otFriendship(u8 v) override;
     u8 otAffection(void) const;
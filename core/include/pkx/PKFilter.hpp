@@ -28,8 +28,10 @@
 #define PKFILTER_HPP
 
 #include "generation.hpp"
+#include "types.h"
 #include <bitset>
 #include <string>
+#include <vector>
 
 #define MAKE_DEFN(name, type)                                                                                                                        \
 public:                                                                                                                                              \
@@ -60,6 +62,49 @@ private:
 
 class PKFilter
 {
+public:
+    // A single check against decrypted slot bytes: the field at offset is read as a size-byte integer, shifted right,
+    // masked, and compared to value. Derived fields (level, shininess, TSV...) use their own types
+    struct Op
+    {
+        enum class Type : u8
+        {
+            EQUAL,
+            AT_LEAST,
+            NATURE_PID,
+            BALL_MAX,
+            LEVEL,
+            SHINY,
+            TSV
+        };
+        Type type;
+        u8 size;
+        u8 shift;
+        bool invert;
+        u16 offset;
+        u32 mask;
+        u32 value;
+    };
+
+    class Compiled
+    {
+    public:
+        Generation generation(void) const { return gen; }
+        const std::vector<Op>& ops(void) const { return program; }
+        // data must point to decrypted, unshuffled slot data of this generation
+        bool operator()(const u8* data) const;
+        // Evaluates count slots spaced stride bytes apart, appending one result per slot. Returns the number of matches
+        size_t match(const u8* data, size_t stride, size_t count, std::vector<bool>& out) const;
+
+    private:
+        friend class PKFilter;
+        Generation gen = Generation::UNUSED;
+        bool never     = false;
+        std::vector<Op> program;
+    };
+
+    Compiled compile(Generation gen) const;
+
     MAKE_DEFN(generation, Generation);
     MAKE_DEFN(species, u16);
     MAKE_DEFN(alternativeForm, u8);
@@ -43,7 +43,6 @@
 class PKX
 {
 protected:
-    u32 expTable(u8 row, u8 col) const;
     u8 blockPosition(u8 index) const;
     u8 blockPositionInvert(u8 index) const;
     u32 seedStep(u32 seed);
@@ -178,6 +177,9 @@ public:
     virtual u8 language(void) const           = 0;
     virtual void language(u8 v)               = 0;
 
+    // otName as it's stored, for comparisons that shouldn't allocate
+    virtual StringUtils::RawName rawOtName(void) const = 0;
+
     virtual u8 currentFriendship(void) const = 0;
     virtual void currentFriendship(u8 v)     = 0;
     virtual void refreshChecksum(void)       = 0;
@@ -222,6 +224,7 @@ public:
 
     u32 getLength(void) const { return length; }
     static u8 genFromBytes(u8* data, size_t length, bool ekx = false);
+    static u32 expTable(u8 row, u8 col);
 
     // Personal interface
     virtual u8 baseHP(void) const         = 0;
@@ -0,0 +1,61 @@
+/*
+ *   This file is part of PKSM
+ *   Copyright (C) 2016-2019 Bernardo Giordano, Admiral Fish, piepie62
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+ *       * Requiring preservation of specified reasonable legal notices or
+ *         author attributions in that material or in the Appropriate Legal
+ *         Notices displayed by works containing it.
+ *       * Prohibiting misrepresentation of the origin of that material,
+ *         or requiring that modified versions of such material be marked in
+ *         reasonable ways as different from the original version.
+ */
+
+#ifndef PKXCACHE_HPP
+#define PKXCACHE_HPP
+
+#include "types.h"
+#include <memory>
+#include <vector>
+
+class PKX;
+
+// Direct-mapped cache of decoded slots, keyed by box * 30 + slot. Consecutive slots never collide, so any two
+// adjacent boxes stay resident with the default capacity
+class PKXCache
+{
+public:
+    PKXCache(size_t capacity = 64) : entries(capacity) {}
+    std::shared_ptr<const PKX> find(u32 index) const;
+    void insert(u32 index, std::shared_ptr<const PKX> pkm) const;
+    void invalidate(u32 index);
+    void invalidate(void);
+    u32 hits(void) const { return hitCount; }
+    u32 misses(void) const { return missCount; }
+    void resetCounters(void) const { hitCount = missCount = 0; }
+
+private:
+    struct Entry
+    {
+        u32 index = 0xFFFFFFFF;
+        std::shared_ptr<const PKX> pkm;
+    };
+    mutable std::vector<Entry> entries;
+    mutable u32 hitCount  = 0;
+    mutable u32 missCount = 0;
+};
+
+#endif
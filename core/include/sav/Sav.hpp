@@ -29,6 +29,7 @@
 
 #include "Item.hpp"
 #include "PKX.hpp"
+#include "PKXCache.hpp"
 #include "WCX.hpp"
 #include "game.hpp"
 #include "generation.hpp"
@@ -78,6 +79,8 @@ protected:
     u8* data;
     u32 length = 0;
     Game game;
+    // Must be invalidated by everything that writes box data
+    PKXCache boxCache;
     static u16 ccitt16(const u8* buf, u32 len);
     static std::unique_ptr<Sav> checkDSType(u8* dt);
     static bool validSequence(u8* dt, u8* pattern, int shift = 0);
@@ -121,6 +124,9 @@ public:
     virtual u8 playedSeconds(void) const      = 0;
     virtual void playedSeconds(u8 v)          = 0;
 
+    // otName as it's stored, for comparisons that shouldn't allocate
+    virtual StringUtils::RawName rawOtName(void) const = 0;
+
     u32 displayTID(void) const;
     u32 displaySID(void) const;
 
@@ -133,9 +139,16 @@ public:
     virtual void pkm(std::shared_ptr<PKX> pk, u8 slot)                          = 0;
     virtual std::shared_ptr<PKX> pkm(u8 box, u8 slot, bool ekx = false) const   = 0;
     virtual void pkm(std::shared_ptr<PKX> pk, u8 box, u8 slot, bool applyTrade) = 0;
+    // Decoded once and shared until the slot is written. Use pkm() to get a copy that can be modified
+    std::shared_ptr<const PKX> cachedPkm(u8 box, u8 slot) const;
+    // For anything that writes box data behind the save's back, like scripts
+    void invalidateCache(void) { boxCache.invalidate(); }
+    const PKXCache& cache(void) const { return boxCache; }
     void transfer(std::shared_ptr<PKX>& pk);
     virtual void trade(std::shared_ptr<PKX> pk)   = 0; // Look into bank boolean parameter
     virtual std::shared_ptr<PKX> emptyPkm() const = 0;
+    // Box data must be decrypted (see cryptBoxData). One result per box slot, in box-major order
+    std::vector<bool> filterBoxes(const PKFilter& filter) const;
 
     virtual void dex(std::shared_ptr<PKX> pk)                           = 0;
     virtual int dexSeen(void) const                                     = 0;
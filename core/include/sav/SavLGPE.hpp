@@ -80,6 +80,7 @@ public:
     void language(u8 v) override;
     std::string otName(void) const override;
     void otName(const std::string& v) override;
+    StringUtils::RawName rawOtName(void) const override;
     u32 money(void) const override;
     void money(u32 v) override;
     u32 BP(void) const override { return 0; } // TODO
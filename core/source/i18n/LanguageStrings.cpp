@@ -26,25 +26,185 @@
 
 #include "LanguageStrings.hpp"
 #include "utils.hpp"
+#include <array>
 
-static nlohmann::json& formJson()
+// Table ids written by common/pack_i18n.py
+enum PackedId : u32
 {
-    static nlohmann::json forms;
-    static bool first = true;
-    if (first)
+    ABILITIES,
+    BALLS,
+    FORMS,
+    HP,
+    ITEMS,
+    MOVES,
+    NATURES,
+    SPECIES,
+    GAMES,
+    LOCATIONS4,
+    LOCATIONS5,
+    LOCATIONS6,
+    LOCATIONS7,
+    LOCATIONSLGPE,
+    COUNTRIES,
+    SUBREGIONS = 0x100
+};
+
+static constexpr u32 PACKED_VERSION = 1;
+
+static bool packedEntry(const u8* table, u32 size, u32 i, u32& key, const char*& value)
+{
+    if ((i + 1) * 12 > size)
+    {
+        return false;
+    }
+    key        = *(const u32*)(table + i * 12);
+    u32 offset = *(const u32*)(table + i * 12 + 4);
+    u32 length = *(const u32*)(table + i * 12 + 8);
+    if ((u64)offset + length >= size || table[offset + length] != '\0')
+    {
+        return false;
+    }
+    value = (const char*)table + offset;
+    return true;
+}
+
+static void readPacked(const u8* table, u32 size, u32 count, std::vector<std::string>& array)
+{
+    array.reserve(count);
+    u32 key;
+    const char* value;
+    for (u32 i = 0; i < count && packedEntry(table, size, i, key, value); i++)
+    {
+        array.emplace_back(value);
+    }
+}
+
+template <typename T>
+static void readPacked(const u8* table, u32 size, u32 count, IdTable<T>& ids)
+{
+    ids.reserve(count);
+    u32 key;
+    const char* value;
+    for (u32 i = 0; i < count && packedEntry(table, size, i, key, value); i++)
+    {
+        // Keys are written in ascending order, so every entry is appended
+        ids.add((T)key, value);
+    }
+}
+
+namespace
+{
+    // Form name indices of one species in one generation: formIndices[start, start + count)
+    struct FormRange
+    {
+        u16 start = 0;
+        u8 count  = 0;
+    };
+
+    // One column per generation, plus a last one for anything else (which only species with generation-independent forms use)
+    constexpr size_t FORM_GENERATIONS = (size_t)Generation::LGPE + 2;
+
+    // forms.json flattened once into plain arrays. formSlots maps a species to its row in formRanges, with 0 meaning it has
+    // no form names at all, so a lookup is two array loads instead of a JSON object search per call
+    struct FormTable
     {
-        FILE* in = fopen("romfs:/i18n/forms.json", "rt");
-        if (in)
+        std::vector<u16> formSlots;
+        std::vector<std::array<FormRange, FORM_GENERATIONS>> formRanges;
+        std::vector<u16> formIndices;
+
+        FormTable()
         {
-            if (!ferror(in))
+            nlohmann::json forms;
+            FILE* in = fopen("romfs:/i18n/forms.json", "rt");
+            if (in)
+            {
+                if (!ferror(in))
+                {
+                    forms = nlohmann::json::parse(in, nullptr, false);
+                }
+                fclose(in);
+            }
+            if (!forms.is_object())
             {
-                forms = nlohmann::json::parse(in, nullptr, false);
+                return;
             }
-            fclose(in);
+
+            formRanges.emplace_back();
+            for (auto i = forms.begin(); i != forms.end(); i++)
+            {
+                if (i.key() == "megas")
+                {
+                    // Megas only ever have their base form and the generic "Mega" name
+                    for (int species : i.value())
+                    {
+                        if (forms.contains(std::to_string(species)))
+                        {
+                            continue;
+                        }
+                        std::array<FormRange, FORM_GENERATIONS> ranges;
+                        ranges.fill(FormRange{add({0, 146}), 2});
+                        assign(species, ranges);
+                    }
+                    continue;
+                }
+
+                std::array<FormRange, FORM_GENERATIONS> ranges;
+                if (i.value().is_object())
+                {
+                    for (size_t gen = 0; gen < FORM_GENERATIONS - 1; gen++)
+                    {
+                        auto indices = i.value().find(genToString((Generation)gen));
+                        if (indices != i.value().end())
+                        {
+                            std::vector<int> values = indices->get<std::vector<int>>();
+                            ranges[gen]             = FormRange{add(values), (u8)values.size()};
+                        }
+                    }
+                }
+                else
+                {
+                    std::vector<int> values = i.value().get<std::vector<int>>();
+                    ranges.fill(FormRange{add(values), (u8)values.size()});
+                }
+                assign(std::stoi(i.key()), ranges);
+            }
+        }
+
+        u16 add(const std::vector<int>& values)
+        {
+            u16 start = formIndices.size();
+            formIndices.insert(formIndices.end(), values.begin(), values.end());
+            return start;
         }
-        first = false;
+
+        void assign(int species, const std::array<FormRange, FORM_GENERATIONS>& ranges)
+        {
+            if (species < 0)
+            {
+                return;
+            }
+            if ((size_t)species >= formSlots.size())
+            {
+                formSlots.resize(species + 1, 0);
+            }
+            formSlots[species] = formRanges.size();
+            formRanges.emplace_back(ranges);
+        }
+    };
+
+    const FormTable& formTable()
+    {
+        static FormTable table;
+        return table;
     }
-    return forms;
+}
+
+// Index of the StringId for a gui.json key, or -1 if it doesn't have one
+static int stringId(const std::string& key)
+{
+    auto i = std::lower_bound(stringIdKeys, stringIdKeys + STRING_ID_COUNT, key.c_str(),
+        [](const char* a, const char* b) { return strcmp(a, b) < 0; });
+    return i != stringIdKeys + STRING_ID_COUNT && key == *i ? i - stringIdKeys : -1;
 }
 
 std::string LanguageStrings::folder(Language lang)
@@ -82,8 +242,14 @@ std::string LanguageStrings::folder(Language lang)
     return "en";
 }
 
-LanguageStrings::LanguageStrings(Language lang)
+LanguageStrings::LanguageStrings(Language lang) : lang(lang)
 {
+    if (loadPacked())
+    {
+        loadGui();
+        return;
+    }
+
     load(lang, "/abilities.txt", abilities);
     load(lang, "/balls.txt", balls);
     load(lang, "/forms.txt", forms);
@@ -100,12 +266,151 @@ LanguageStrings::LanguageStrings(Language lang)
     load(lang, "/locationsLGPE.txt", locationsLGPE);
     countries = {};
     load(lang, "/countries.txt", countries);
-    for (auto i = countries.begin(); i != countries.end(); i++)
+    loadGui();
+}
+
+// strings.bin holds every text table of a language, so one read replaces the dozens of files the text loaders go through.
+// Missing or malformed files make the caller fall back to those loaders
+bool LanguageStrings::loadPacked(void)
+{
+    static const std::string base = "romfs:/i18n/";
+    packedPath                    = base + folder(lang) + "/strings.bin";
+    if (!io::exists(packedPath))
+    {
+        // Languages without any translated files of their own use English for everything
+        if (io::exists(base + folder(lang)))
+        {
+            return false;
+        }
+        packedPath = base + folder(Language::EN) + "/strings.bin";
+    }
+
+    FILE* in = fopen(packedPath.c_str(), "rb");
+    if (!in)
+    {
+        return false;
+    }
+    fseek(in, 0, SEEK_END);
+    long size = ftell(in);
+    fseek(in, 0, SEEK_SET);
+    if (size < 12)
+    {
+        fclose(in);
+        return false;
+    }
+    std::unique_ptr<u8[]> data = std::unique_ptr<u8[]>(new u8[size]);
+    bool good                  = fread(data.get(), 1, size, in) == (size_t)size;
+    fclose(in);
+
+    u32 tables = *(u32*)(data.get() + 8);
+    if (!good || memcmp(data.get(), "I18N", 4) || *(u32*)(data.get() + 4) != PACKED_VERSION || 12 + (u64)tables * 16 > (u64)size)
     {
-        subregions[i->first] = {};
-        load(lang, StringUtils::format("/subregions/%03i.txt", (int)i->first), subregions[i->first]);
+        return false;
+    }
+
+    for (u32 i = 0; i < tables; i++)
+    {
+        const u32* entry = (u32*)(data.get() + 12 + i * 16);
+        PackedTable table{entry[1], entry[2], entry[3]};
+        if ((u64)table.offset + table.size > (u64)size)
+        {
+            continue;
+        }
+        const u8* tableData = data.get() + table.offset;
+        switch (entry[0])
+        {
+            case ABILITIES:
+                readPacked(tableData, table.size, table.count, abilities);
+                break;
+            case BALLS:
+                readPacked(tableData, table.size, table.count, balls);
+                break;
+            case FORMS:
+                readPacked(tableData, table.size, table.count, forms);
+                break;
+            case HP:
+                readPacked(tableData, table.size, table.count, hps);
+                break;
+            case ITEMS:
+                readPacked(tableData, table.size, table.count, items);
+                break;
+            case MOVES:
+                readPacked(tableData, table.size, table.count, moves);
+                break;
+            case NATURES:
+                readPacked(tableData, table.size, table.count, natures);
+                break;
+            case SPECIES:
+                readPacked(tableData, table.size, table.count, speciess);
+                break;
+            case GAMES:
+                readPacked(tableData, table.size, table.count, games);
+                break;
+            case LOCATIONS4:
+                readPacked(tableData, table.size, table.count, locations4);
+                break;
+            case LOCATIONS5:
+                readPacked(tableData, table.size, table.count, locations5);
+                break;
+            case LOCATIONS6:
+                readPacked(tableData, table.size, table.count, locations6);
+                break;
+            case LOCATIONS7:
+                readPacked(tableData, table.size, table.count, locations7);
+                break;
+            case LOCATIONSLGPE:
+                readPacked(tableData, table.size, table.count, locationsLGPE);
+                break;
+            case COUNTRIES:
+                readPacked(tableData, table.size, table.count, countries);
+                break;
+            default:
+                // Subregions stay on disk until a country's are asked for
+                if (entry[0] >= SUBREGIONS && entry[0] - SUBREGIONS <= 0xFF)
+                {
+                    packedSubregions[entry[0] - SUBREGIONS] = table;
+                }
+                break;
+        }
+    }
+    return true;
+}
+
+// gui.json is only parsed once; every string then lives at its StringId so that localize doesn't have to search for it
+void LanguageStrings::loadGui(void)
+{
+    nlohmann::json json;
+    load(lang, "/gui.json", json);
+
+    gui.resize(STRING_ID_COUNT);
+    std::vector<bool> found(STRING_ID_COUNT, false);
+    if (json.is_object())
+    {
+        for (auto i = json.begin(); i != json.end(); i++)
+        {
+            if (!i.value().is_string())
+            {
+                continue;
+            }
+            int id = stringId(i.key());
+            if (id >= 0)
+            {
+                gui[id]   = i.value().get<std::string>();
+                found[id] = true;
+            }
+            else
+            {
+                extraGui[i.key()] = i.value().get<std::string>();
+            }
+        }
+    }
+    for (size_t i = 0; i < STRING_ID_COUNT; i++)
+    {
+        if (!found[i])
+        {
+            gui[i] = "MISSING: " + std::string(stringIdKeys[i]);
+        }
     }
-    load(lang, "/gui.json", gui);
 }
 
 void LanguageStrings::load(Language lang, const std::string& name, std::vector<std::string>& array)
@@ -158,98 +463,72 @@ void LanguageStrings::load(Language lang, const std::string& name, nlohmann::jso
 
 const std::string& LanguageStrings::ability(u8 v) const
 {
-    return v < abilities.size() ? abilities.at(v) : localize("INVALID_ABILITY");
+    return v < abilities.size() ? abilities.at(v) : localize(StringId::INVALID_ABILITY);
 }
 
 const std::string& LanguageStrings::ball(u8 v) const
 {
-    return v < balls.size() ? balls.at(v) : localize("INVALID_BALL");
+    return v < balls.size() ? balls.at(v) : localize(StringId::INVALID_BALL);
 }
 
 const std::string& LanguageStrings::form(u16 species, u8 form, Generation generation) const
 {
-    std::string sSpecies = std::to_string((int)species);
-    if (!formJson().contains(sSpecies))
-    {
-        // Not sure how the json sorts it, so just do a linear search. Aren't that many (only 44) anyways
-        for (int i : formJson()["megas"])
-        {
-            if (i == species)
-            {
-                if (form == 1)
-                {
-                    return forms.at(146);
-                }
-                else if (form == 0)
-                {
-                    return forms.at(0);
-                }
-                else
-                {
-                    return localize("INVALID_FORM");
-                }
-            }
-        }
-    }
-    else
+    const FormTable& table = formTable();
+    if (species < table.formSlots.size())
     {
-        std::vector<int> formIndices;
-        if (formJson()[sSpecies].is_object())
-        {
-            if (formJson()[sSpecies].find(genToString(generation)) != formJson()[sSpecies].end())
-            {
-                formIndices = formJson()[sSpecies][genToString(generation)].get<std::vector<int>>();
-            }
-        }
-        else
+        size_t column          = std::min((size_t)generation, FORM_GENERATIONS - 1);
+        const FormRange& range = table.formRanges[table.formSlots[species]][column];
+        if (form < range.count && table.formIndices[range.start + form] < forms.size())
         {
-            formIndices = formJson()[sSpecies].get<std::vector<int>>();
-        }
-
-        if (form < formIndices.size())
-        {
-            size_t formNameIndex = formIndices[form];
-            if (formNameIndex < forms.size())
-            {
-                return forms.at(formNameIndex);
-            }
+            return forms[table.formIndices[range.start + form]];
         }
     }
-    return localize("INVALID_FORM");
+    return localize(StringId::INVALID_FORM);
 }
 
 const std::string& LanguageStrings::hp(u8 v) const
 {
-    return v < hps.size() ? hps.at(v) : localize("INVALID_HP");
+    return v < hps.size() ? hps.at(v) : localize(StringId::INVALID_HP);
 }
 
 const std::string& LanguageStrings::item(u16 v) const
 {
-    return v < items.size() ? items.at(v) : localize("INVALID_ITEM");
+    return v < items.size() ? items.at(v) : localize(StringId::INVALID_ITEM);
 }
 
 const std::string& LanguageStrings::move(u16 v) const
 {
-    return v < moves.size() ? moves.at(v) : localize("INVALID_MOVE");
+    return v < moves.size() ? moves.at(v) : localize(StringId::INVALID_MOVE);
 }
 
 const std::string& LanguageStrings::nature(u8 v) const
 {
-    return v < natures.size() ? natures.at(v) : localize("INVALID_NATURE");
+    return v < natures.size() ? natures.at(v) : localize(StringId::INVALID_NATURE);
 }
 
 const std::string& LanguageStrings::species(u16 v) const
 {
-    return v < speciess.size() ? speciess.at(v) : localize("INVALID_SPECIES");
+    return v < speciess.size() ? speciess.at(v) : localize(StringId::INVALID_SPECIES);
+}
+
+const std::string& LanguageStrings::localize(StringId v) const
+{
+    return gui[(size_t)v];
 }
 
 const std::string& LanguageStrings::localize(const std::string& v) const
 {
-    if (!gui.contains(v))
+    int id = stringId(v);
+    if (id >= 0)
     {
-        const_cast<nlohmann::json&>(gui)[v] = "MISSING: " + v;
+        return gui[id];
     }
-    return gui.at(v).get_ref<const std::string&>();
+    auto i = extraGui.find(v);
+    if (i == extraGui.end())
+    {
+        i = extraGui.emplace(v, "MISSING: " + v).first;
+    }
+    return i->second;
 }
 
 const std::vector<std::string>& LanguageStrings::rawItems() const
@@ -262,15 +541,46 @@ const std::vector<std::string>& LanguageStrings::rawMoves() const
     return moves;
 }
 
+const IdTable<u8>* LanguageStrings::countrySubregions(u8 country) const
+{
+    std::unique_ptr<IdTable<u8>>& regions = subregions[country];
+    if (!regions)
+    {
+        if (!countries.contains(country))
+        {
+            return nullptr;
+        }
+        regions = std::make_unique<IdTable<u8>>();
+        if (packedSubregions.empty())
+        {
+            load(lang, StringUtils::format("/subregions/%03i.txt", (int)country), *regions);
+        }
+        else
+        {
+            auto table = packedSubregions.find(country);
+            FILE* in   = table != packedSubregions.end() ? fopen(packedPath.c_str(), "rb") : nullptr;
+            if (in)
+            {
+                std::unique_ptr<u8[]> data = std::unique_ptr<u8[]>(new u8[table->second.size]);
+                if (fseek(in, table->second.offset, SEEK_SET) == 0 && fread(data.get(), 1, table->second.size, in) == table->second.size)
+                {
+                    readPacked(data.get(), table->second.size, table->second.count, *regions);
+                }
+                fclose(in);
+            }
+        }
+    }
+    return regions.get();
+}
+
 const std::string& LanguageStrings::subregion(u8 country, u8 v) const
 {
-    auto i = subregions.find(country);
-    if (i != subregions.end())
+    auto regions = countrySubregions(country);
+    if (regions)
     {
-        auto j = i->second.find(v);
-        if (j != i->second.end())
+        if (const std::string* name = regions->find(v))
         {
-            return j->second;
+            return *name;
         }
         return localize("INVALID_SUBREGION");
     }
@@ -279,53 +589,20 @@ const std::string& LanguageStrings::subregion(u8 country, u8 v) const
 
 const std::string& LanguageStrings::country(u8 v) const
 {
-    auto i = countries.find(v);
-    if (i != countries.end())
+    if (const std::string* name = countries.find(v))
     {
-        return i->second;
+        return *name;
     }
     return localize("INVALID_COUNTRY");
 }
 
 const std::string& LanguageStrings::location(u16 v, Generation generation) const
 {
-    std::map<u16, std::string>::const_iterator i;
-    switch (generation)
+    if (const std::string* name = locations(generation).find(v))
     {
-        case Generation::FOUR:
-            if ((i = locations4.find(v)) != locations4.end())
-            {
-                return i->second;
-            }
-            break;
-        case Generation::FIVE:
-            if ((i = locations5.find(v)) != locations5.end())
-            {
-                return i->second;
-            }
-            break;
-        case Generation::SIX:
-            if ((i = locations6.find(v)) != locations6.end())
-            {
-                return i->second;
-            }
-            break;
-        case Generation::SEVEN:
-            if ((i = locations7.find(v)) != locations7.end())
-            {
-                return i->second;
-            }
-            break;
-        case Generation::LGPE:
-            if ((i = locationsLGPE.find(v)) != locationsLGPE.end())
-            {
-                return i->second;
-            }
-            break;
-        default:
-            break;
+        return *name;
     }
-    return localize("INVALID_LOCATION");
+    return localize(StringId::INVALID_LOCATION);
 }
 
 const std::string& LanguageStrings::game(u8 v) const
@@ -334,12 +611,12 @@ const std::string& LanguageStrings::game(u8 v) const
     {
         return games.at(v);
     }
-    return localize("INVALID_GAME");
+    return localize(StringId::INVALID_GAME);
 }
 
-const std::map<u16, std::string>& LanguageStrings::locations(Generation g) const
+const IdTable<u16>& LanguageStrings::locations(Generation g) const
 {
-    static std::map<u16, std::string> emptyMap;
+    static IdTable<u16> emptyTable;
     switch (g)
     {
         case Generation::FOUR:
@@ -353,8 +630,64 @@ const std::map<u16, std::string>& LanguageStrings::locations(Generation g) const
         case Generation::LGPE:
             return locationsLGPE;
         default:
-            return emptyMap;
+            return emptyTable;
+    }
+}
+
+template <typename T>
+static void addAll(SearchIndex& index, const IdTable<T>& table)
+{
+    for (size_t i = 0; i < table.size(); i++)
+    {
+        index.add(table.id(i), table.name(i));
+    }
+}
+
+const SearchIndex& LanguageStrings::searchIndex(SearchCategory category) const
+{
+    std::unique_ptr<SearchIndex>& index = searchIndices[(size_t)category];
+    if (!index)
+    {
+        index = std::make_unique<SearchIndex>();
+        switch (category)
+        {
+            case SearchCategory::SPECIES:
+                for (size_t i = 0; i < speciess.size(); i++)
+                {
+                    index->add(i, speciess[i]);
+                }
+                break;
+            case SearchCategory::MOVES:
+                for (size_t i = 0; i < moves.size(); i++)
+                {
+                    index->add(i, moves[i]);
+                }
+                break;
+            case SearchCategory::ITEMS:
+                for (size_t i = 0; i < items.size(); i++)
+                {
+                    index->add(i, items[i]);
+                }
+                break;
+            case SearchCategory::LOCATIONS4:
+                addAll(*index, locations4);
+                break;
+            case SearchCategory::LOCATIONS5:
+                addAll(*index, locations5);
+                break;
+            case SearchCategory::LOCATIONS6:
+                addAll(*index, locations6);
+                break;
+            case SearchCategory::LOCATIONS7:
+                addAll(*index, locations7);
+                break;
+            case SearchCategory::LOCATIONSLGPE:
+                addAll(*index, locationsLGPE);
+                break;
+        }
+        index->build();
     }
+    return *index;
 }
 
 size_t LanguageStrings::numGameStrings() const
@@ -362,18 +695,50 @@ size_t LanguageStrings::numGameStrings() const
     return games.size();
 }
 
-const std::map<u8, std::string>& LanguageStrings::rawCountries() const
+static size_t memoryUsage(const std::vector<std::string>& strings)
+{
+    size_t ret = strings.capacity() * sizeof(std::string);
+    for (const auto& str : strings)
+    {
+        ret += str.capacity();
+    }
+    return ret;
+}
+
+size_t LanguageStrings::memoryUsage() const
+{
+    size_t ret = sizeof(LanguageStrings);
+    for (auto array : {&abilities, &balls, &forms, &hps, &items, &moves, &natures, &speciess, &games, &gui})
+    {
+        ret += ::memoryUsage(*array);
+    }
+    for (auto table : {&locations4, &locations5, &locations6, &locations7, &locationsLGPE})
+    {
+        ret += table->memoryUsage();
+    }
+    ret += countries.memoryUsage();
+    for (const auto& table : subregions)
+    {
+        if (table)
+        {
+            ret += table->memoryUsage();
+        }
+    }
+    return ret;
+}
+
+const IdTable<u8>& LanguageStrings::rawCountries() const
 {
     return countries;
 }
 
-const std::map<u8, std::string>& LanguageStrings::rawSubregions(u8 country) const
+const IdTable<u8>& LanguageStrings::rawSubregions(u8 country) const
 {
-    static std::map<u8, std::string> emptyMap;
-    auto i = subregions.find(country);
-    if (i == subregions.end())
+    static IdTable<u8> emptyTable;
+    auto regions = countrySubregions(country);
+    if (!regions)
     {
-        return emptyMap;
+        return emptyTable;
     }
-    return i->second;
+    return *regions;
 }
@@ -0,0 +1,112 @@
+/*
+ *   This file is part of PKSM
+ *   Copyright (C) 2016-2019 Bernardo Giordano, Admiral Fish, piepie62
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+ *       * Requiring preservation of specified reasonable legal notices or
+ *         author attributions in that material or in the Appropriate Legal
+ *         Notices displayed by works containing it.
+ *       * Prohibiting misrepresentation of the origin of that material,
+ *         or requiring that modified versions of such material be marked in
+ *         reasonable ways as different from the original version.
+ */
+
+#include "SearchIndex.hpp"
+#include "utils.hpp"
+#include <algorithm>
+
+// Compares the NUL terminated string at str with key, only looking at as many characters as key has; 0 means str starts with key
+static int compareKey(const char16_t* str, const std::u16string& key)
+{
+    for (size_t i = 0; i < key.size(); i++)
+    {
+        if (str[i] != key[i])
+        {
+            return str[i] < key[i] ? -1 : 1;
+        }
+    }
+    return 0;
+}
+
+void SearchIndex::add(u16 value, const std::string& name)
+{
+    std::u16string folded = StringUtils::fold(name);
+    u32 start             = text.size();
+    names.push_back(start);
+    for (size_t i = 0; i < folded.size(); i++)
+    {
+        suffixes.push_back(start + i);
+    }
+    owners.insert(owners.end(), folded.size() + 1, values.size());
+    values.push_back(value);
+    text += folded;
+    text += u'\0';
+}
+
+void SearchIndex::build(void)
+{
+    // Stopping at the terminators keeps every comparison inside one name
+    const char16_t* data = text.data();
+    auto less            = [data](u32 a, u32 b) {
+        while (data[a] && data[a] == data[b])
+        {
+            a++;
+            b++;
+        }
+        return data[a] < data[b];
+    };
+    std::sort(names.begin(), names.end(), less);
+    std::sort(suffixes.begin(), suffixes.end(), less);
+}
+
+std::pair<size_t, size_t> SearchIndex::range(const std::vector<u32>& sorted, const std::u16string& key) const
+{
+    const char16_t* data = text.data();
+    auto begin           = std::lower_bound(sorted.begin(), sorted.end(), key, [data](u32 offset, const std::u16string& key) {
+        return compareKey(data + offset, key) < 0;
+    });
+    auto end             = std::upper_bound(begin, sorted.end(), key, [data](const std::u16string& key, u32 offset) {
+        return compareKey(data + offset, key) > 0;
+    });
+    return {begin - sorted.begin(), end - sorted.begin()};
+}
+
+std::vector<u16> SearchIndex::collect(const std::vector<u32>& sorted, const std::pair<size_t, size_t>& bounds) const
+{
+    std::vector<u16> ret;
+    ret.reserve(bounds.second - bounds.first);
+    for (size_t i = bounds.first; i < bounds.second; i++)
+    {
+        ret.push_back(values[owners[sorted[i]]]);
+    }
+    std::sort(ret.begin(), ret.end());
+    ret.erase(std::unique(ret.begin(), ret.end()), ret.end());
+    return ret;
+}
+
+std::vector<u16> SearchIndex::prefix(const std::string& query) const
+{
+    return collect(names, range(names, StringUtils::fold(query)));
+}
+
+std::vector<u16> SearchIndex::substring(const std::string& query) const
+{
+    if (query.empty())
+    {
+        return prefix(query);
+    }
+    return collect(suffixes, range(suffixes, StringUtils::fold(query)));
+}
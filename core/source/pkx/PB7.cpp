@@ -398,6 +398,10 @@ void PB7::htName(const std::string& v)
 {
     StringUtils::setString(data, v, 0x78, 12);
 }
+StringUtils::RawName PB7::rawHtName(void) const
+{
+    return {data + 0x78, 12, StringUtils::RawName::UTF16, 0};
+}
 
 u8 PB7::htGender(void) const
 {
@@ -515,6 +519,10 @@ void PB7::otName(const std::string& v)
 {
     StringUtils::setString(data, v, 0xB0, 12);
 }
+StringUtils::RawName PB7::rawOtName(void) const
+{
+    return {data + 0xB0, 12, StringUtils::RawName::UTF16, 0};
+}
 
 u8 PB7::otFriendship(void) const
 {
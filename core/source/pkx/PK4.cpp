@@ -459,6 +459,10 @@ void PK4::otName(const std::string& v)
 {
     StringUtils::setString4(data, StringUtils::transString45(v), 0x68, 8);
 }
+StringUtils::RawName PK4::rawOtName(void) const
+{
+    return {data + 0x68, 8, StringUtils::RawName::GEN4, u'\uFFFF'};
+}
 
 u8 PK4::eggYear(void) const
 {
@@ -456,6 +456,10 @@ void PK5::otName(const std::string& v)
 {
     StringUtils::setString(data, StringUtils::transString45(v), 0x68, 8, u'\uFFFF', 0);
 }
+StringUtils::RawName PK5::rawOtName(void) const
+{
+    return {data + 0x68, 8, StringUtils::RawName::GEN5, u'\uFFFF'};
+}
 
 u8 PK5::eggYear(void) const
 {
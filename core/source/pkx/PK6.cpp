@@ -454,6 +454,10 @@ void PK6::htName(const std::string& v)
 {
     StringUtils::setString(data, StringUtils::transString67(v), 0x78, 12);
 }
+StringUtils::RawName PK6::rawHtName(void) const
+{
+    return {data + 0x78, 12, StringUtils::RawName::GEN67, 0};
+}
 
 u8 PK6::htGender(void) const
 {
@@ -571,6 +575,10 @@ void PK6::otName(const std::string& v)
 {
     StringUtils::setString(data, StringUtils::transString67(v), 0xB0, 13);
 }
+StringUtils::RawName PK6::rawOtName(void) const
+{
+    return {data + 0xB0, 13, StringUtils::RawName::GEN67, 0};
+}
 
 u8 PK6::otFriendship(void) const
 {
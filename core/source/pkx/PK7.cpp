@@ -400,6 +400,10 @@ void PK7::htName(const std::string& v)
 {
     StringUtils::setString(data, StringUtils::transString67(v), 0x78, 12);
 }
+StringUtils::RawName PK7::rawHtName(void) const
+{
+    return {data + 0x78, 12, StringUtils::RawName::GEN67, 0};
+}
 
 u8 PK7::htGender(void) const
 {
@@ -517,6 +521,10 @@ void PK7::otName(const std::string& v)
 {
     StringUtils::setString(data, StringUtils::transString67(v), 0xB0, 13);
 }
+StringUtils::RawName PK7::rawOtName(void) const
+{
+    return {data + 0xB0, 13, StringUtils::RawName::GEN67, 0};
+}
 
 u8 PK7::otFriendship(void) const
 {
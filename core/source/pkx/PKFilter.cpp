@@ -0,0 +1,322 @@
+/*
+ *   This file is part of PKSM
+ *   Copyright (C) 2016-2019 Bernardo Giordano, Admiral Fish, piepie62
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+ *       * Requiring preservation of specified reasonable legal notices or
+ *         author attributions in that material or in the Appropriate Legal
+ *         Notices displayed by works containing it.
+ *       * Prohibiting misrepresentation of the origin of that material,
+ *         or requiring that modified versions of such material be marked in
+ *         reasonable ways as different from the original version.
+ */
+
+#include "PKFilter.hpp"
+#include "PKX.hpp"
+#include "personal.hpp"
+
+namespace
+{
+    struct Layout
+    {
+        u16 ability;
+        u16 nature; // 0 means derived from the PID
+        u16 genderForm;
+        u16 moves;
+        u16 relearnMoves; // 0 means not present
+        u16 ivs;
+        u16 ball;
+        u16 ball2; // 0 means not present
+        u16 language;
+        u16 pid;
+        u8 svShift;
+    };
+
+    constexpr Layout layout4  = {0x15, 0, 0x40, 0x28, 0, 0x38, 0x83, 0x86, 0x17, 0x00, 3};
+    constexpr Layout layout5  = {0x15, 0x41, 0x40, 0x28, 0, 0x38, 0x83, 0, 0x17, 0x00, 3};
+    constexpr Layout layout67 = {0x14, 0x1C, 0x1D, 0x5A, 0x6A, 0x74, 0xDC, 0, 0xE3, 0x18, 4};
+    constexpr u16 SPECIES     = 0x08;
+    constexpr u16 HELD_ITEM   = 0x0A;
+    constexpr u16 TID_SID     = 0x0C;
+    constexpr u16 EXPERIENCE  = 0x10;
+
+    const Layout* layoutFor(Generation gen)
+    {
+        switch (gen)
+        {
+            case Generation::FOUR:
+                return &layout4;
+            case Generation::FIVE:
+                return &layout5;
+            case Generation::SIX:
+            case Generation::SEVEN:
+            case Generation::LGPE:
+                return &layout67;
+            default:
+                return nullptr;
+        }
+    }
+
+    inline u32 read(const u8* data, u16 offset, u8 size)
+    {
+        switch (size)
+        {
+            case 1:
+                return data[offset];
+            case 2:
+                return *(const u16*)(data + offset);
+            default:
+                return *(const u32*)(data + offset);
+        }
+    }
+
+    template <u8 (*FormCount)(u16), u16 (*FormStatIndex)(u16), u8 (*ExpType)(u16)>
+    u8 expType(u16 species, u8 form)
+    {
+        u8 formcount = FormCount(species);
+        if (form && form < formcount)
+        {
+            u16 formSpecies = FormStatIndex(species);
+            if (formSpecies)
+            {
+                species = formSpecies + form - 1;
+            }
+        }
+        return ExpType(species);
+    }
+
+    u8 level(Generation gen, const u8* data, u16 genderForm)
+    {
+        u16 species = *(const u16*)(data + SPECIES);
+        u8 form     = data[genderForm] >> 3;
+        u8 xpType;
+        switch (gen)
+        {
+            case Generation::FOUR:
+                xpType = expType<PersonalDPPtHGSS::formCount, PersonalDPPtHGSS::formStatIndex, PersonalDPPtHGSS::expType>(species, form);
+                break;
+            case Generation::FIVE:
+                xpType = expType<PersonalBWB2W2::formCount, PersonalBWB2W2::formStatIndex, PersonalBWB2W2::expType>(species, form);
+                break;
+            case Generation::SIX:
+                xpType = expType<PersonalXYORAS::formCount, PersonalXYORAS::formStatIndex, PersonalXYORAS::expType>(species, form);
+                break;
+            case Generation::SEVEN:
+                xpType = expType<PersonalSMUSUM::formCount, PersonalSMUSUM::formStatIndex, PersonalSMUSUM::expType>(species, form);
+                break;
+            case Generation::LGPE:
+            default:
+                xpType = expType<PersonalLGPE::formCount, PersonalLGPE::formStatIndex, PersonalLGPE::expType>(species, form);
+                break;
+        }
+        u32 experience = *(const u32*)(data + EXPERIENCE);
+        u8 i           = 1;
+        while (experience >= PKX::expTable(i, xpType) && ++i < 100)
+            ;
+        return i;
+    }
+
+    inline u16 tsv(const u8* data, u8 shift)
+    {
+        u32 ids = *(const u32*)(data + TID_SID);
+        return ((ids & 0xFFFF) ^ (ids >> 16)) >> shift;
+    }
+
+    inline bool evaluate(Generation gen, const PKFilter::Op& op, const u8* data)
+    {
+        bool result;
+        switch (op.type)
+        {
+            case PKFilter::Op::Type::EQUAL:
+                result = ((read(data, op.offset, op.size) >> op.shift) & op.mask) == op.value;
+                break;
+            case PKFilter::Op::Type::AT_LEAST:
+                result = ((read(data, op.offset, op.size) >> op.shift) & op.mask) >= op.value;
+                break;
+            case PKFilter::Op::Type::NATURE_PID:
+                result = *(const u32*)(data + op.offset) % 25 == op.value;
+                break;
+            case PKFilter::Op::Type::BALL_MAX:
+                result = std::max(data[op.offset], data[op.mask]) == op.value;
+                break;
+            case PKFilter::Op::Type::LEVEL:
+                result = level(gen, data, op.mask) == op.value;
+                break;
+            case PKFilter::Op::Type::SHINY:
+            {
+                u32 pid = *(const u32*)(data + op.offset);
+                result  = (tsv(data, op.shift) == (((pid >> 16) ^ (pid & 0xFFFF)) >> op.shift)) == (op.value != 0);
+                break;
+            }
+            case PKFilter::Op::Type::TSV:
+                result = tsv(data, op.shift) == op.value;
+                break;
+            default:
+                result = false;
+                break;
+        }
+        return result != op.invert;
+    }
+}
+
+PKFilter::Compiled PKFilter::compile(Generation gen) const
+{
+    Compiled ret;
+    ret.gen              = gen;
+    const Layout* layout = layoutFor(gen);
+    if (!layout || (generationEnabled() && (generationInversed() != (gen != generation()))))
+    {
+        ret.never = true;
+        return ret;
+    }
+
+    auto field = [&ret](u16 offset, u8 size, u8 shift, u32 mask, u32 value, bool invert, Op::Type type = Op::Type::EQUAL) {
+        ret.program.push_back({type, size, shift, invert, offset, mask, value});
+    };
+
+    // Most selective checks go first so that the common case bails out early
+    if (speciesEnabled())
+    {
+        field(SPECIES, 2, 0, 0xFFFF, species(), speciesInversed());
+    }
+    if (alternativeFormEnabled())
+    {
+        field(layout->genderForm, 1, 3, 0x1F, alternativeForm(), alternativeFormInversed());
+    }
+    if (shinyEnabled())
+    {
+        field(layout->pid, 4, layout->svShift, 0, shiny() ? 1 : 0, shinyInversed(), Op::Type::SHINY);
+    }
+    if (heldItemEnabled())
+    {
+        field(HELD_ITEM, 2, 0, 0xFFFF, heldItem(), heldItemInversed());
+    }
+    if (abilityEnabled())
+    {
+        field(layout->ability, 1, 0, 0xFF, ability(), abilityInversed());
+    }
+    if (TSVEnabled())
+    {
+        field(TID_SID, 4, layout->svShift, 0, TSV(), TSVInversed(), Op::Type::TSV);
+    }
+    if (natureEnabled())
+    {
+        if (layout->nature)
+        {
+            field(layout->nature, 1, 0, 0xFF, nature(), natureInversed());
+        }
+        else
+        {
+            field(layout->pid, 4, 0, 0, nature(), natureInversed(), Op::Type::NATURE_PID);
+        }
+    }
+    if (genderEnabled())
+    {
+        field(layout->genderForm, 1, 1, 0x3, gender(), genderInversed());
+    }
+    if (ballEnabled())
+    {
+        if (layout->ball2)
+        {
+            field(layout->ball, 1, 0, layout->ball2, ball(), ballInversed(), Op::Type::BALL_MAX);
+        }
+        else
+        {
+            field(layout->ball, 1, 0, 0xFF, ball(), ballInversed());
+        }
+    }
+    if (languageEnabled())
+    {
+        field(layout->language, 1, 0, 0xFF, language(), languageInversed());
+    }
+    if (eggEnabled())
+    {
+        field(layout->ivs, 4, 30, 0x1, egg() ? 1 : 0, eggInversed());
+    }
+    for (u8 i = 0; i < 4; i++)
+    {
+        if (moveEnabled(i))
+        {
+            field(layout->moves + i * 2, 2, 0, 0xFFFF, move(i), moveInversed(i));
+        }
+        if (relearnMoveEnabled(i))
+        {
+            if (!layout->relearnMoves)
+            {
+                ret.never = true;
+                ret.program.clear();
+                return ret;
+            }
+            field(layout->relearnMoves + i * 2, 2, 0, 0xFFFF, relearnMove(i), relearnMoveInversed(i));
+        }
+    }
+    for (u8 i = 0; i < 6; i++)
+    {
+        if (ivEnabled(i))
+        {
+            field(layout->ivs, 4, 5 * i, 0x1F, iv(i), ivInversed(i), Op::Type::AT_LEAST);
+        }
+    }
+    // Needs a personal lookup and an experience table walk, so it goes last
+    if (levelEnabled())
+    {
+        field(SPECIES, 2, 0, layout->genderForm, level(), levelInversed(), Op::Type::LEVEL);
+    }
+
+    return ret;
+}
+
+bool PKFilter::Compiled::operator()(const u8* data) const
+{
+    if (never)
+    {
+        return false;
+    }
+    for (auto& op : program)
+    {
+        if (!evaluate(gen, op, data))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+size_t PKFilter::Compiled::match(const u8* data, size_t stride, size_t count, std::vector<bool>& out) const
+{
+    size_t matches = 0;
+    out.reserve(out.size() + count);
+    if (never)
+    {
+        out.insert(out.end(), count, false);
+        return 0;
+    }
+    for (size_t i = 0; i < count; i++, data += stride)
+    {
+        bool result = true;
+        for (auto& op : program)
+        {
+            if (!evaluate(gen, op, data))
+            {
+                result = false;
+                break;
+            }
+        }
+        out.push_back(result);
+        matches += result ? 1 : 0;
+    }
+    return matches;
+}
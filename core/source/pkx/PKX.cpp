@@ -31,7 +31,7 @@
 #include "PK6.hpp"
 #include "PK7.hpp"
 
-u32 PKX::expTable(u8 row, u8 col) const
+u32 PKX::expTable(u8 row, u8 col)
 {
     static constexpr u32 table[100][6] = {{0, 0, 0, 0, 0, 0}, {8, 15, 4, 9, 6, 10}, {27, 52, 13, 57, 21, 33}, {64, 122, 32, 96, 51, 80},
         {125, 237, 65, 135, 100, 156}, {216, 406, 112, 179, 172, 270}, {343, 637, 178, 236, 274, 428}, {512, 942, 276, 314, 409, 640},
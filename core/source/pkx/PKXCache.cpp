@@ -0,0 +1,66 @@
+/*
+ *   This file is part of PKSM
+ *   Copyright (C) 2016-2019 Bernardo Giordano, Admiral Fish, piepie62
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+ *       * Requiring preservation of specified reasonable legal notices or
+ *         author attributions in that material or in the Appropriate Legal
+ *         Notices displayed by works containing it.
+ *       * Prohibiting misrepresentation of the origin of that material,
+ *         or requiring that modified versions of such material be marked in
+ *         reasonable ways as different from the original version.
+ */
+
+#include "PKXCache.hpp"
+#include "PKX.hpp"
+
+std::shared_ptr<const PKX> PKXCache::find(u32 index) const
+{
+    const Entry& entry = entries[index % entries.size()];
+    if (entry.index == index)
+    {
+        hitCount++;
+        return entry.pkm;
+    }
+    missCount++;
+    return nullptr;
+}
+
+void PKXCache::insert(u32 index, std::shared_ptr<const PKX> pkm) const
+{
+    Entry& entry = entries[index % entries.size()];
+    entry.index  = index;
+    entry.pkm    = pkm;
+}
+
+void PKXCache::invalidate(u32 index)
+{
+    Entry& entry = entries[index % entries.size()];
+    if (entry.index == index)
+    {
+        entry.index = 0xFFFFFFFF;
+        entry.pkm   = nullptr;
+    }
+}
+
+void PKXCache::invalidate(void)
+{
+    for (auto& entry : entries)
+    {
+        entry.index = 0xFFFFFFFF;
+        entry.pkm   = nullptr;
+    }
+}
@@ -176,6 +176,31 @@ void Sav::transfer(std::shared_ptr<PKX>& pk)
     }
 }
 
+std::shared_ptr<const PKX> Sav::cachedPkm(u8 box, u8 slot) const
+{
+    u32 index                      = box * 30 + slot;
+    std::shared_ptr<const PKX> ret = boxCache.find(index);
+    if (!ret)
+    {
+        ret = pkm(box, slot);
+        boxCache.insert(index, ret);
+    }
+    return ret;
+}
+
+std::vector<bool> Sav::filterBoxes(const PKFilter& filter) const
+{
+    std::vector<bool> ret;
+    ret.reserve(maxSlot());
+    PKFilter::Compiled compiled = filter.compile(generation());
+    for (u8 box = 0; box < boxes && box * 30 < maxSlot(); box++)
+    {
+        u32 base = boxOffset(box, 0);
+        compiled.match(data + base, boxOffset(box, 1) - base, std::min(30, maxSlot() - box * 30), ret);
+    }
+    return ret;
+}
+
 void Sav::fixParty()
 {
     // Poor man's bubble sort-like thing
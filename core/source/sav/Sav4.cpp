@@ -178,6 +178,10 @@ void Sav4::otName(const std::string& v)
 {
     StringUtils::setString4(data, StringUtils::transString45(v), Trainer1, 8);
 }
+StringUtils::RawName Sav4::rawOtName(void) const
+{
+    return {data + Trainer1, 8, StringUtils::RawName::GEN4, u'\uFFFF'};
+}
 
 u32 Sav4::money(void) const
 {
@@ -304,11 +308,13 @@ void Sav4::pkm(std::shared_ptr<PKX> pk, u8 box, u8 slot, bool applyTrade)
     }
 
     std::copy(pk->rawData(), pk->rawData() + 136, data + boxOffset(box, slot));
+    boxCache.invalidate(box * 30 + slot);
 }
 
 void Sav4::trade(std::shared_ptr<PKX> pk)
 {
-    if (pk->egg() && (otName() != pk->otName() || TID() != pk->TID() || SID() != pk->SID() || gender() != pk->otGender()))
+    if (pk->egg() &&
+        (!StringUtils::nameEquals(rawOtName(), pk->rawOtName()) || TID() != pk->TID() || SID() != pk->SID() || gender() != pk->otGender()))
     {
         pk->metDay(Configuration::getInstance().day());
         pk->metMonth(Configuration::getInstance().month());
@@ -319,6 +325,7 @@ void Sav4::trade(std::shared_ptr<PKX> pk)
 
 void Sav4::cryptBoxData(bool crypted)
 {
+    boxCache.invalidate();
     for (u8 box = 0; box < boxes; box++)
     {
         for (u8 slot = 0; slot < 30; slot++)
@@ -874,21 +881,21 @@ std::string Sav4::pouchName(Pouch pouch) const
     switch (pouch)
     {
         case NormalItem:
-            return i18n::localize("ITEMS");
+            return i18n::localize(StringId::ITEMS);
         case KeyItem:
-            return i18n::localize("KEY_ITEMS");
+            return i18n::localize(StringId::KEY_ITEMS);
         case TM:
-            return i18n::localize("TMHM");
+            return i18n::localize(StringId::TMHM);
         case Mail:
-            return i18n::localize("MAIL");
+            return i18n::localize(StringId::MAIL);
         case Medicine:
-            return i18n::localize("MEDICINE");
+            return i18n::localize(StringId::MEDICINE);
         case Berry:
-            return i18n::localize("BERRIES");
+            return i18n::localize(StringId::BERRIES);
         case Ball:
-            return i18n::localize("BALLS");
+            return i18n::localize(StringId::BALLS);
         case Battle:
-            return i18n::localize("BATTLE_ITEMS");
+            return i18n::localize(StringId::BATTLE_ITEMS);
         default:
             return "";
     }
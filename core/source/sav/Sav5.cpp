@@ -106,6 +106,10 @@ void Sav5::otName(const std::string& v)
 {
     StringUtils::setString(data, StringUtils::transString45(v), Trainer1 + 0x4, 8, u'\uFFFF', 0);
 }
+StringUtils::RawName Sav5::rawOtName(void) const
+{
+    return {data + Trainer1 + 0x4, 8, StringUtils::RawName::GEN5, u'\uFFFF'};
+}
 
 u32 Sav5::money(void) const
 {
@@ -221,11 +225,13 @@ void Sav5::pkm(std::shared_ptr<PKX> pk, u8 box, u8 slot, bool applyTrade)
     }
 
     std::copy(pk->rawData(), pk->rawData() + 136, data + boxOffset(box, slot));
+    boxCache.invalidate(box * 30 + slot);
 }
 
 void Sav5::trade(std::shared_ptr<PKX> pk)
 {
-    if (pk->egg() && (otName() != pk->otName() || TID() != pk->TID() || SID() != pk->SID() || gender() != pk->otGender()))
+    if (pk->egg() &&
+        (!StringUtils::nameEquals(rawOtName(), pk->rawOtName()) || TID() != pk->TID() || SID() != pk->SID() || gender() != pk->otGender()))
     {
         pk->metDay(Configuration::getInstance().day());
         pk->metMonth(Configuration::getInstance().month());
@@ -236,6 +242,7 @@ void Sav5::trade(std::shared_ptr<PKX> pk)
 
 void Sav5::cryptBoxData(bool crypted)
 {
+    boxCache.invalidate();
     for (u8 box = 0; box < boxes; box++)
     {
         for (u8 slot = 0; slot < 30; slot++)
@@ -559,15 +566,15 @@ std::string Sav5::pouchName(Pouch pouch) const
     switch (pouch)
     {
         case NormalItem:
-            return i18n::localize("ITEMS");
+            return i18n::localize(StringId::ITEMS);
         case KeyItem:
-            return i18n::localize("KEY_ITEMS");
+            return i18n::localize(StringId::KEY_ITEMS);
         case TM:
-            return i18n::localize("TMHM");
+            return i18n::localize(StringId::TMHM);
         case Medicine:
-            return i18n::localize("MEDICINE");
+            return i18n::localize(StringId::MEDICINE);
         case Berry:
-            return i18n::localize("BERRIES");
+            return i18n::localize(StringId::BERRIES);
         default:
             return "";
     }
@@ -106,6 +106,10 @@ void Sav6::otName(const std::string& v)
 {
     StringUtils::setString(data, StringUtils::transString67(v), TrainerCard + 0x48, 13);
 }
+StringUtils::RawName Sav6::rawOtName(void) const
+{
+    return {data + TrainerCard + 0x48, 13, StringUtils::RawName::GEN67, 0};
+}
 
 u32 Sav6::money(void) const
 {
@@ -222,6 +226,7 @@ void Sav6::pkm(std::shared_ptr<PKX> pk, u8 box, u8 slot, bool applyTrade)
     }
 
     std::copy(pk->rawData(), pk->rawData() + 232, data + boxOffset(box, slot));
+    boxCache.invalidate(box * 30 + slot);
 }
 
 void Sav6::trade(std::shared_ptr<PKX> pk)
@@ -229,7 +234,7 @@ void Sav6::trade(std::shared_ptr<PKX> pk)
     PK6* pk6 = (PK6*)pk.get();
     if (pk6->egg())
     {
-        if (otName() != pk6->otName() || TID() != pk6->TID() || SID() != pk6->SID() || gender() != pk6->otGender())
+        if (!StringUtils::nameEquals(rawOtName(), pk6->rawOtName()) || TID() != pk6->TID() || SID() != pk6->SID() || gender() != pk6->otGender())
         {
             pk6->metDay(Configuration::getInstance().day());
             pk6->metMonth(Configuration::getInstance().month());
@@ -238,7 +243,7 @@ void Sav6::trade(std::shared_ptr<PKX> pk)
         }
         return;
     }
-    else if (otName() == pk6->otName() && TID() == pk6->TID() && SID() == pk6->SID() && gender() == pk6->otGender())
+    else if (StringUtils::nameEquals(rawOtName(), pk6->rawOtName()) && TID() == pk6->TID() && SID() == pk6->SID() && gender() == pk6->otGender())
     {
         pk6->currentHandler(0);
 
@@ -255,7 +260,8 @@ void Sav6::trade(std::shared_ptr<PKX> pk)
     }
     else
     {
-        if (otName() != pk6->htName() || gender() != pk6->htGender() || (pk6->geoCountry(0) == 0 && pk6->geoRegion(0) == 0 && !pk6->untradedEvent()))
+        if (!StringUtils::nameEquals(rawOtName(), pk6->rawHtName()) || gender() != pk6->htGender() ||
+            (pk6->geoCountry(0) == 0 && pk6->geoRegion(0) == 0 && !pk6->untradedEvent()))
         {
             for (int i = 4; i > 0; i--)
             {
@@ -266,7 +272,7 @@ void Sav6::trade(std::shared_ptr<PKX> pk)
             pk6->geoRegion(subRegion());
         }
 
-        if (pk6->htName() != otName())
+        if (!StringUtils::nameEquals(pk6->rawHtName(), rawOtName()))
         {
             pk6->htFriendship(pk6->baseFriendship());
             pk6->htAffection(0);
@@ -307,6 +313,7 @@ void Sav6::trade(std::shared_ptr<PKX> pk)
 
 void Sav6::cryptBoxData(bool crypted)
 {
+    boxCache.invalidate();
     for (u8 box = 0; box < boxes; box++)
     {
         for (u8 slot = 0; slot < 30; slot++)
@@ -755,15 +762,15 @@ std::string Sav6::pouchName(Pouch pouch) const
     switch (pouch)
     {
         case NormalItem:
-            return i18n::localize("ITEMS");
+            return i18n::localize(StringId::ITEMS);
         case KeyItem:
-            return i18n::localize("KEY_ITEMS");
+            return i18n::localize(StringId::KEY_ITEMS);
         case TM:
-            return i18n::localize("TMHM");
+            return i18n::localize(StringId::TMHM);
         case Medicine:
-            return i18n::localize("MEDICINE");
+            return i18n::localize(StringId::MEDICINE);
         case Berry:
-            return i18n::localize("BERRIES");
+            return i18n::localize(StringId::BERRIES);
         default:
             return "";
     }
@@ -122,6 +122,10 @@ void Sav7::otName(const std::string& v)
 {
     return StringUtils::setString(data, StringUtils::transString67(v), TrainerCard + 0x38, 13);
 }
+StringUtils::RawName Sav7::rawOtName(void) const
+{
+    return {data + TrainerCard + 0x38, 13, StringUtils::RawName::GEN67, 0};
+}
 
 u32 Sav7::money(void) const
 {
@@ -238,6 +242,7 @@ void Sav7::pkm(std::shared_ptr<PKX> pk, u8 box, u8 slot, bool applyTrade)
     }
 
     std::copy(pk->rawData(), pk->rawData() + 232, data + boxOffset(box, slot));
+    boxCache.invalidate(box * 30 + slot);
 }
 
 void Sav7::trade(std::shared_ptr<PKX> pk)
@@ -245,7 +250,7 @@ void Sav7::trade(std::shared_ptr<PKX> pk)
     PK7* pk7 = (PK7*)pk.get();
     if (pk7->egg())
     {
-        if (otName() != pk7->otName() || TID() != pk7->TID() || SID() != pk7->SID() || gender() != pk7->otGender())
+        if (!StringUtils::nameEquals(rawOtName(), pk7->rawOtName()) || TID() != pk7->TID() || SID() != pk7->SID() || gender() != pk7->otGender())
         {
             pk7->metDay(Configuration::getInstance().day());
             pk7->metMonth(Configuration::getInstance().month());
@@ -254,13 +259,13 @@ void Sav7::trade(std::shared_ptr<PKX> pk)
         }
         return;
     }
-    else if (otName() == pk7->otName() && TID() == pk7->TID() && SID() == pk7->SID() && gender() == pk7->otGender())
+    else if (StringUtils::nameEquals(rawOtName(), pk7->rawOtName()) && TID() == pk7->TID() && SID() == pk7->SID() && gender() == pk7->otGender())
     {
         pk7->currentHandler(0);
     }
     else
     {
-        if (pk7->htName() != otName())
+        if (!StringUtils::nameEquals(pk7->rawHtName(), rawOtName()))
         {
             pk7->htFriendship(pk7->baseFriendship());
             pk7->htAffection(0);
@@ -273,6 +278,7 @@ void Sav7::trade(std::shared_ptr<PKX> pk)
 
 void Sav7::cryptBoxData(bool crypted)
 {
+    boxCache.invalidate();
     for (u8 box = 0; box < boxes; box++)
     {
         for (u8 slot = 0; slot < 30; slot++)
@@ -638,19 +644,19 @@ std::string Sav7::pouchName(Pouch pouch) const
     switch (pouch)
     {
         case NormalItem:
-            return i18n::localize("ITEMS");
+            return i18n::localize(StringId::ITEMS);
         case KeyItem:
-            return i18n::localize("KEY_ITEMS");
+            return i18n::localize(StringId::KEY_ITEMS);
         case TM:
-            return i18n::localize("TMS");
+            return i18n::localize(StringId::TMS);
         case Medicine:
-            return i18n::localize("MEDICINE");
+            return i18n::localize(StringId::MEDICINE);
         case Berry:
-            return i18n::localize("BERRIES");
+            return i18n::localize(StringId::BERRIES);
         case ZCrystals:
-            return i18n::localize("ZCRYSTALS");
+            return i18n::localize(StringId::ZCRYSTALS);
         case Battle:
-            return i18n::localize("ROTOM_POWERS");
+            return i18n::localize(StringId::ROTOM_POWERS);
         default:
             return "";
     }
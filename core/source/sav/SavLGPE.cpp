@@ -130,6 +130,7 @@ static bool isPKM(u8* pkmData)
 
 void SavLGPE::compressBox()
 {
+    boxCache.invalidate();
     u16 emptyIndex    = 1001;
     u8 emptyData[260] = {0};
     for (u16 i = 0; i < 1000; i++)
@@ -249,6 +250,10 @@ void SavLGPE::otName(const std::string& v)
 {
     StringUtils::setString(data, v, 0x1000 + 0x38, 13);
 }
+StringUtils::RawName SavLGPE::rawOtName(void) const
+{
+    return {data + 0x1000 + 0x38, 13, StringUtils::RawName::UTF16, 0};
+}
 
 u32 SavLGPE::money() const
 {
@@ -334,10 +339,13 @@ void SavLGPE::pkm(std::shared_ptr<PKX> pk, u8 box, u8 slot, bool applyTrade)
         trade(pk);
     }
     std::copy(pk->rawData(), pk->rawData() + pk->getLength(), data + boxOffset(box, slot));
+    boxCache.invalidate(box * 30 + slot);
 }
 
 void SavLGPE::pkm(std::shared_ptr<PKX> pk, u8 slot)
 {
+    // Party slots live in box storage
+    boxCache.invalidate();
     u32 off     = partyOffset(slot);
     u16 newSlot = partyBoxSlot(slot);
     if (pk->species() == 0)
@@ -362,7 +370,7 @@ void SavLGPE::pkm(std::shared_ptr<PKX> pk, u8 slot)
         }
         if (off == 0)
         {
-            // Gui::warn(i18n::localize("LGPE_NO_PARTY_SLOT"));
+            // Gui::warn(i18n::localize(StringId::LGPE_NO_PARTY_SLOT));
             return;
         }
     }
@@ -374,20 +382,21 @@ void SavLGPE::pkm(std::shared_ptr<PKX> pk, u8 slot)
 void SavLGPE::trade(std::shared_ptr<PKX> pk)
 {
     PB7* pb7 = (PB7*)pk.get();
-    if (pb7->egg() && !(otName() == pb7->otName() && TID() == pb7->TID() && SID() == pb7->SID() && gender() == pb7->otGender()))
+    if (pb7->egg() &&
+        !(StringUtils::nameEquals(rawOtName(), pb7->rawOtName()) && TID() == pb7->TID() && SID() == pb7->SID() && gender() == pb7->otGender()))
     {
         pb7->metDay(Configuration::getInstance().day());
         pb7->metMonth(Configuration::getInstance().month());
         pb7->metYear(Configuration::getInstance().year() - 2000);
         pb7->metLocation(30002);
     }
-    else if (!(otName() == pb7->otName() && TID() == pb7->TID() && SID() == pb7->SID() && gender() == pb7->otGender()))
+    else if (!(StringUtils::nameEquals(rawOtName(), pb7->rawOtName()) && TID() == pb7->TID() && SID() == pb7->SID() && gender() == pb7->otGender()))
     {
         pb7->currentHandler(0);
     }
     else
     {
-        if (pb7->htName() != otName())
+        if (!StringUtils::nameEquals(pb7->rawHtName(), rawOtName()))
         {
             pb7->htFriendship(pb7->currentFriendship()); // copy friendship instead of resetting (don't alter CP)
             pb7->htAffection(0);
@@ -405,7 +414,7 @@ std::shared_ptr<PKX> SavLGPE::emptyPkm() const
 
 std::string SavLGPE::boxName(u8 box) const
 {
-    return i18n::localize("BOX") + " " + std::to_string((int)box + 1);
+    return i18n::localize(StringId::BOX) + " " + std::to_string((int)box + 1);
 }
 
 void SavLGPE::boxName(u8 box, const std::string& name)
@@ -604,6 +613,7 @@ int SavLGPE::dexCaught(void) const
 
 void SavLGPE::cryptBoxData(bool crypted)
 {
+    boxCache.invalidate();
     for (u8 box = 0; box < maxBoxes(); box++)
     {
         for (u8 slot = 0; slot < 30; slot++)
@@ -628,7 +638,7 @@ void SavLGPE::mysteryGift(WCX& wc, int& pos)
     {
         if (boxedPkm() == maxSlot())
         {
-            // Gui::warn(i18n::localize("LGPE_TOO_MANY_PKM"), i18n::localize("BAD_INJECT"));
+            // Gui::warn(i18n::localize(StringId::LGPE_TOO_MANY_PKM), i18n::localize(StringId::BAD_INJECT));
             return;
         }
         std::shared_ptr<PB7> pkm = std::make_shared<PB7>();
@@ -867,7 +877,7 @@ void SavLGPE::mysteryGift(WCX& wc, int& pos)
 
             if (slot == -2)
             {
-                // Gui::warn(i18n::localize("LGPE_HAS_TM"));
+                // Gui::warn(i18n::localize(StringId::LGPE_HAS_TM));
                 return;
             }
             else if (slot != -1)
@@ -986,7 +996,7 @@ void SavLGPE::item(Item& item, Pouch pouch, u16 slot)
             }
             else
             {
-                // Gui::warn(i18n::localize("THE_FUCK"), i18n::localize("REPORT_THIS") + " " + "(Medicine LGPE)");
+                // Gui::warn(i18n::localize(StringId::THE_FUCK), i18n::localize(StringId::REPORT_THIS) + " " + "(Medicine LGPE)");
             }
             break;
         case Pouch::TM:
@@ -996,7 +1006,7 @@ void SavLGPE::item(Item& item, Pouch pouch, u16 slot)
             }
             else
             {
-                // Gui::warn(i18n::localize("THE_FUCK"), i18n::localize("REPORT_THIS") + " " + "(TM LGPE)");
+                // Gui::warn(i18n::localize(StringId::THE_FUCK), i18n::localize(StringId::REPORT_THIS) + " " + "(TM LGPE)");
             }
             break;
         case Pouch::Candy:
@@ -1006,7 +1016,7 @@ void SavLGPE::item(Item& item, Pouch pouch, u16 slot)
             }
             else
             {
-                // Gui::warn(i18n::localize("THE_FUCK"), i18n::localize("REPORT_THIS") + " " + "(Candy LGPE)");
+                // Gui::warn(i18n::localize(StringId::THE_FUCK), i18n::localize(StringId::REPORT_THIS) + " " + "(Candy LGPE)");
             }
             break;
         case Pouch::ZCrystals:
@@ -1016,7 +1026,7 @@ void SavLGPE::item(Item& item, Pouch pouch, u16 slot)
             }
             else
             {
-                // Gui::warn(i18n::localize("THE_FUCK"), i18n::localize("REPORT_THIS") + " " + "(ZCrystals LGPE)");
+                // Gui::warn(i18n::localize(StringId::THE_FUCK), i18n::localize(StringId::REPORT_THIS) + " " + "(ZCrystals LGPE)");
             }
             break;
         case Pouch::Ball:
@@ -1026,7 +1036,7 @@ void SavLGPE::item(Item& item, Pouch pouch, u16 slot)
             }
             else
             {
-                // Gui::warn(i18n::localize("THE_FUCK"), i18n::localize("REPORT_THIS") + " " + "(Ball LGPE)");
+                // Gui::warn(i18n::localize(StringId::THE_FUCK), i18n::localize(StringId::REPORT_THIS) + " " + "(Ball LGPE)");
             }
             break;
         case Pouch::Battle:
@@ -1036,7 +1046,7 @@ void SavLGPE::item(Item& item, Pouch pouch, u16 slot)
             }
             else
             {
-                // Gui::warn(i18n::localize("THE_FUCK"), i18n::localize("REPORT_THIS") + " " + "(Battle LGPE)");
+                // Gui::warn(i18n::localize(StringId::THE_FUCK), i18n::localize(StringId::REPORT_THIS) + " " + "(Battle LGPE)");
             }
             break;
         case Pouch::KeyItem:
@@ -1047,11 +1057,11 @@ void SavLGPE::item(Item& item, Pouch pouch, u16 slot)
             }
             else
             {
-                // Gui::warn(i18n::localize("THE_FUCK"), i18n::localize("REPORT_THIS") + " " + "(Normal/Key LGPE)");
+                // Gui::warn(i18n::localize(StringId::THE_FUCK), i18n::localize(StringId::REPORT_THIS) + " " + "(Normal/Key LGPE)");
             }
             break;
         default:
-            // Gui::warn(i18n::localize("THE_FUCK"), std::to_string((int)pouch));
+            // Gui::warn(i18n::localize(StringId::THE_FUCK), std::to_string((int)pouch));
             break;
     }
 }
@@ -1114,19 +1124,19 @@ std::string SavLGPE::pouchName(Pouch pouch) const
     switch (pouch)
     {
         case Medicine:
-            return i18n::localize("MEDICINE");
+            return i18n::localize(StringId::MEDICINE);
         case TM:
-            return i18n::localize("TMS");
+            return i18n::localize(StringId::TMS);
         case Candy:
-            return i18n::localize("CANDIES");
+            return i18n::localize(StringId::CANDIES);
         case ZCrystals:
-            return i18n::localize("ZCRYSTALS");
+            return i18n::localize(StringId::ZCRYSTALS);
         case Ball:
-            return i18n::localize("CATCHING_ITEMS");
+            return i18n::localize(StringId::CATCHING_ITEMS);
         case Battle:
-            return i18n::localize("BATTLE_ITEMS");
+            return i18n::localize(StringId::BATTLE_ITEMS);
         case NormalItem:
-            return i18n::localize("ITEMS");
+            return i18n::localize(StringId::ITEMS);
         default:
             return "";
     }